@@ -0,0 +1,343 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
+#include "Acts/EventData/PackedMultiTrajectory.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainerBackendConcept.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Concepts.hpp"
+#include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+class TrackingGeometry;
+class MappedMultiTrajectory;
+class MappedTrackContainer;
+
+/// Fixed size representation of a source link in a mapped track file
+using SourceLinkRecord = std::array<std::uint64_t, 2>;
+
+namespace detail_mtc {
+
+using IndexType = MultiTrajectoryTraits::IndexType;
+
+/// Element types of the dynamic columns which can be stored
+enum class ColumnType : std::uint32_t {
+  UInt32,
+  UInt64,
+  Int32,
+  Int64,
+  Float,
+  Double,
+  Bool,
+};
+
+/// Read-only view of a column inside the mapped file
+template <typename T>
+struct ColumnView {
+  const T* data = nullptr;
+  std::size_t size = 0;
+
+  const T& operator[](std::size_t i) const { return data[i]; }
+};
+
+/// Read-only view of a dynamic column inside the mapped file
+struct DynamicColumnView {
+  const std::byte* data = nullptr;
+  ColumnType type = ColumnType::UInt32;
+
+  std::any get(std::size_t i) const;
+};
+
+}  // namespace detail_mtc
+
+template <>
+struct IsReadOnlyMultiTrajectory<MappedMultiTrajectory> : std::true_type {};
+
+/// Read-only track state backend on top of a memory mapped track file
+///
+/// The columns point directly into the mapped file and are not copied. Only
+/// the reference surfaces are resolved when the file is opened. Instances are
+/// owned by @c MappedTrackFile.
+class MappedMultiTrajectory final
+    : public MultiTrajectory<MappedMultiTrajectory> {
+#ifndef DOXYGEN
+  friend MultiTrajectory<MappedMultiTrajectory>;
+  friend class MappedTrackFile;
+#endif
+
+ public:
+  MappedMultiTrajectory(const MappedMultiTrajectory&) = delete;
+  MappedMultiTrajectory& operator=(const MappedMultiTrajectory&) = delete;
+
+  // BEGIN INTERFACE
+
+  IndexType calibratedSize_impl(IndexType istate) const {
+    return m_index[istate].measdim;
+  }
+
+  SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
+    return m_sourceLinkDecoder(m_sourceLinks[m_index[istate].iuncalibrated]);
+  }
+
+  const Surface* referenceSurface_impl(IndexType istate) const {
+    return m_referenceSurfaces[istate];
+  }
+
+  ConstTrackStateProxy::Parameters parameters_impl(IndexType parIdx) const {
+    return ConstTrackStateProxy::Parameters{m_params[parIdx].data()};
+  }
+
+  ConstTrackStateProxy::Covariance covariance_impl(IndexType parIdx) const {
+    return ConstTrackStateProxy::Covariance{m_cov[parIdx].data()};
+  }
+
+  ConstTrackStateProxy::Covariance jacobian_impl(IndexType istate) const {
+    IndexType jacIdx = m_index[istate].ijacobian;
+    return ConstTrackStateProxy::Covariance{m_jac[jacIdx].data()};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::Measurement<measdim> measurement_impl(
+      IndexType istate) const {
+    IndexType offset = m_measOffset[istate];
+    return ConstTrackStateProxy::Measurement<measdim>{&m_meas[offset]};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::MeasurementCovariance<measdim>
+  measurementCovariance_impl(IndexType istate) const {
+    IndexType offset = m_measCovOffset[istate];
+    return ConstTrackStateProxy::MeasurementCovariance<measdim>{
+        &m_measCov[offset]};
+  }
+
+  bool has_impl(HashedString key, IndexType istate) const;
+
+  IndexType size_impl() const { return m_index.size; }
+
+  std::any component_impl(HashedString key, IndexType istate) const;
+
+  bool hasColumn_impl(HashedString key) const;
+
+  // END INTERFACE
+
+ private:
+  using IndexData = detail_vmt::VectorMultiTrajectoryBase::IndexData;
+  using Coefficients = detail_lt::Types<eBoundSize>::Coefficients;
+  using Covariance = detail_lt::Types<eBoundSize>::Covariance;
+
+  MappedMultiTrajectory() = default;
+
+  /// Check that all indices stored in the columns point into the columns
+  bool validate() const;
+
+  detail_mtc::ColumnView<IndexData> m_index;
+  detail_mtc::ColumnView<Coefficients> m_params;
+  detail_mtc::ColumnView<Covariance> m_cov;
+  detail_mtc::ColumnView<double> m_meas;
+  detail_mtc::ColumnView<IndexType> m_measOffset;
+  detail_mtc::ColumnView<double> m_measCov;
+  detail_mtc::ColumnView<IndexType> m_measCovOffset;
+  detail_mtc::ColumnView<Covariance> m_jac;
+  detail_mtc::ColumnView<SourceLinkRecord> m_sourceLinks;
+  detail_mtc::ColumnView<std::uint8_t> m_sourceLinkValid;
+  detail_mtc::ColumnView<ProjectorBitset> m_projectors;
+  std::vector<const Surface*> m_referenceSurfaces;
+
+  std::unordered_map<HashedString, detail_mtc::DynamicColumnView> m_dynamic;
+
+  Delegate<SourceLink(const SourceLinkRecord&)> m_sourceLinkDecoder;
+};
+
+ACTS_STATIC_CHECK_CONCEPT(ConstMultiTrajectoryBackend, MappedMultiTrajectory);
+
+template <>
+struct IsReadOnlyTrackContainer<MappedTrackContainer> : std::true_type {};
+
+/// Read-only track backend on top of a memory mapped track file
+///
+/// The counterpart of @c MappedMultiTrajectory for the tracks.
+class MappedTrackContainer final {
+#ifndef DOXYGEN
+  friend class MappedTrackFile;
+#endif
+
+ public:
+  using IndexType = MultiTrajectoryTraits::IndexType;
+  using ConstParameters =
+      typename detail_lt::Types<eBoundSize, true>::CoefficientsMap;
+  using ConstCovariance =
+      typename detail_lt::Types<eBoundSize, true>::CovarianceMap;
+
+  MappedTrackContainer(const MappedTrackContainer&) = delete;
+  MappedTrackContainer& operator=(const MappedTrackContainer&) = delete;
+
+  // BEGIN INTERFACE
+
+  std::size_t size_impl() const { return m_tipIndex.size; }
+
+  std::any component_impl(HashedString key, IndexType itrack) const;
+
+  ConstParameters parameters(IndexType itrack) const {
+    return ConstParameters{m_params[itrack].data()};
+  }
+
+  ConstCovariance covariance(IndexType itrack) const {
+    return ConstCovariance{m_cov[itrack].data()};
+  }
+
+  bool hasColumn_impl(HashedString key) const {
+    return m_dynamic.find(key) != m_dynamic.end();
+  }
+
+  const Surface* referenceSurface_impl(IndexType itrack) const {
+    return m_referenceSurfaces[itrack];
+  }
+
+  // END INTERFACE
+
+ private:
+  using Coefficients = detail_lt::Types<eBoundSize>::Coefficients;
+  using Covariance = detail_lt::Types<eBoundSize>::Covariance;
+
+  MappedTrackContainer() = default;
+
+  /// Check that the columns are consistent and the tip indices point into a
+  /// trajectory with @p nStates track states
+  bool validate(std::size_t nStates) const;
+
+  detail_mtc::ColumnView<IndexType> m_tipIndex;
+  detail_mtc::ColumnView<Coefficients> m_params;
+  detail_mtc::ColumnView<Covariance> m_cov;
+  std::vector<const Surface*> m_referenceSurfaces;
+
+  detail_mtc::ColumnView<unsigned int> m_nMeasurements;
+  detail_mtc::ColumnView<unsigned int> m_nHoles;
+  detail_mtc::ColumnView<float> m_chi2;
+  detail_mtc::ColumnView<unsigned int> m_ndf;
+  detail_mtc::ColumnView<unsigned int> m_nOutliers;
+  detail_mtc::ColumnView<unsigned int> m_nSharedHits;
+
+  std::unordered_map<HashedString, detail_mtc::DynamicColumnView> m_dynamic;
+};
+
+ACTS_STATIC_CHECK_CONCEPT(ConstTrackContainerBackend, MappedTrackContainer);
+
+/// Columnar track file which is read through a memory mapping
+///
+/// The file contains the raw columns of a @c VectorTrackContainer and its
+/// @c VectorMultiTrajectory, including the dynamic columns. Opening it maps
+/// the file and exposes the columns in place through read-only backends, so
+/// there is no deserialization step and the pages can be shared between
+/// processes reading the same file.
+///
+/// Source links are type-erased and are stored through a user provided
+/// encoding into a @c SourceLinkRecord. Reference surfaces are stored by
+/// their geometry identifier and resolved in the tracking geometry when the
+/// file is opened. Perigee surfaces, which are usually not part of the
+/// geometry, are stored by their position and recreated.
+///
+/// @note The columns are stored in the native memory layout, so files can
+///       only be read on the same platform with the same Acts version.
+class MappedTrackFile {
+ public:
+  using SourceLinkEncoder = Delegate<SourceLinkRecord(const SourceLink&)>;
+  using SourceLinkDecoder = Delegate<SourceLink(const SourceLinkRecord&)>;
+
+  /// Write tracks and their track states to a file
+  ///
+  /// @param path The output file
+  /// @param gctx The geometry context used to place perigee surfaces
+  /// @param tracks The tracks to write
+  /// @param trajectory The track states of the tracks
+  /// @param encoder The source link encoding
+  static void write(const std::string& path, const GeometryContext& gctx,
+                    const VectorTrackContainer& tracks,
+                    const VectorMultiTrajectory& trajectory,
+                    const SourceLinkEncoder& encoder);
+
+  /// Write tracks and their packed track states to a file
+  ///
+  /// @param path The output file
+  /// @param gctx The geometry context used to place perigee surfaces
+  /// @param tracks The tracks to write
+  /// @param trajectory The track states of the tracks
+  /// @param encoder The source link encoding
+  /// @throw std::invalid_argument if @p trajectory has expanded values,
+  ///        call @c PackedMultiTrajectory::pack before writing
+  template <typename scalar_t>
+  static void write(const std::string& path, const GeometryContext& gctx,
+                    const VectorTrackContainer& tracks,
+                    const PackedMultiTrajectory<scalar_t>& trajectory,
+                    const SourceLinkEncoder& encoder);
+
+  /// Open and map a file
+  ///
+  /// @param path The input file
+  /// @param geometry The geometry to resolve the reference surfaces in
+  /// @param decoder The source link decoding
+  MappedTrackFile(const std::string& path, const TrackingGeometry& geometry,
+                  SourceLinkDecoder decoder);
+
+  MappedTrackFile(const MappedTrackFile&) = delete;
+  MappedTrackFile& operator=(const MappedTrackFile&) = delete;
+
+  ~MappedTrackFile();
+
+  /// The tracks of the file
+  const MappedTrackContainer& tracks() const { return m_tracks; }
+
+  /// The track states of the file
+  const MappedMultiTrajectory& trajectory() const { return m_trajectory; }
+
+ private:
+  using Coefficients = detail_lt::Types<eBoundSize>::Coefficients;
+  using Covariance = detail_lt::Types<eBoundSize>::Covariance;
+
+  template <typename trajectory_t>
+  static void writeImpl(const std::string& path, const GeometryContext& gctx,
+                        const VectorTrackContainer& tracks,
+                        const trajectory_t& trajectory,
+                        const SourceLinkEncoder& encoder);
+
+  const void* m_data = nullptr;
+  std::size_t m_size = 0;
+
+  MappedTrackContainer m_tracks;
+  MappedMultiTrajectory m_trajectory;
+
+  // Recreated surfaces which are not part of the geometry
+  std::vector<std::shared_ptr<const Surface>> m_surfaces;
+
+  // Expanded values of packed track states
+  std::vector<Coefficients> m_params;
+  std::vector<Covariance> m_cov;
+  std::vector<Covariance> m_jac;
+};
+
+}  // namespace Acts
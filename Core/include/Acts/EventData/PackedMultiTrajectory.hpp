@@ -0,0 +1,717 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/detail/DynamicColumn.hpp"
+#include "Acts/Utilities/Concepts.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <any>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+template <typename scalar_t>
+class PackedMultiTrajectory;
+class MappedTrackFile;
+
+namespace detail_pmt {
+
+/// Full precision values expanded from packed storage
+///
+/// Every entry is expanded at most once into its own allocation, which is
+/// owned by the column and keeps its address until @c release or @c clear
+/// is called. Entries are published with a compare-exchange, so concurrent
+/// readers are safe: if two threads expand the same entry, the second one
+/// discards its copy and uses the published one.
+template <typename value_t>
+class ExpandedColumn {
+ public:
+  ExpandedColumn() = default;
+
+  ExpandedColumn(const ExpandedColumn& other) {
+    for (const auto& entry : other.m_entries) {
+      const value_t* value = entry.load(std::memory_order_acquire);
+      m_entries.emplace_back(value != nullptr ? new value_t(*value) : nullptr);
+    }
+  }
+
+  ExpandedColumn(ExpandedColumn&& other) noexcept
+      : m_entries{std::move(other.m_entries)} {
+    other.m_entries.clear();
+  }
+
+  ExpandedColumn& operator=(const ExpandedColumn&) = delete;
+  ExpandedColumn& operator=(ExpandedColumn&&) = delete;
+
+  ~ExpandedColumn() { clear(); }
+
+  /// Add an entry which is not expanded
+  void push_back() { m_entries.emplace_back(nullptr); }
+
+  /// The expanded value of an entry or nullptr if it is not expanded
+  value_t* find(std::size_t i) const {
+    return m_entries[i].load(std::memory_order_acquire);
+  }
+
+  /// Get the expanded value, calling @p expand to fill it on first access
+  template <typename expand_t>
+  value_t& get(std::size_t i, expand_t&& expand) const {
+    value_t* value = find(i);
+    if (value == nullptr) {
+      auto expanded = std::make_unique<value_t>();
+      expand(*expanded);
+      // on failure, value is updated to the entry published by another thread
+      if (m_entries[i].compare_exchange_strong(value, expanded.get(),
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+        value = expanded.release();
+      }
+    }
+    return *value;
+  }
+
+  /// Number of expanded entries
+  std::size_t expandedSize() const {
+    std::size_t n = 0;
+    for (const auto& entry : m_entries) {
+      n += entry.load(std::memory_order_relaxed) != nullptr ? 1 : 0;
+    }
+    return n;
+  }
+
+  /// Destroy all expanded values and keep the entries
+  void release() {
+    for (auto& entry : m_entries) {
+      delete entry.exchange(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  /// Destroy all expanded values and remove the entries
+  void clear() {
+    release();
+    m_entries.clear();
+  }
+
+ private:
+  // a deque never moves its elements when growing at the end
+  mutable std::deque<std::atomic<value_t*>> m_entries;
+};
+
+}  // namespace detail_pmt
+
+template <typename scalar_t>
+struct IsReadOnlyMultiTrajectory<PackedMultiTrajectory<scalar_t>>
+    : std::false_type {};
+
+/// Track state storage with a reduced memory footprint
+///
+/// The bound parameters, covariances and Jacobians are stored with the
+/// scalar type @c scalar_t and only the upper triangle of the symmetric
+/// covariances is kept. Jacobians are dropped by @c pack unless requested.
+/// Measurements, source links and all other columns are stored as in
+/// @c VectorMultiTrajectory.
+///
+/// The track state proxies hand out maps to full double precision matrices.
+/// Covariances, and parameters and Jacobians in single precision, are
+/// expanded on first access into storage owned by the trajectory. The
+/// expanded values are used for all further reads and writes, so the maps
+/// stay valid and the values are not rounded while the track states are
+/// being filled. @c pack rounds them back into the packed storage and
+/// releases them. Reading a trajectory from multiple threads is safe.
+///
+/// @note Each expanded value is a separate allocation, so a trajectory that
+///       is being filled or read takes more memory than a
+///       @c VectorMultiTrajectory. Call @c pack once the tracks are finished,
+///       e.g. before writing them with @c MappedTrackFile::write.
+///
+/// @tparam scalar_t The scalar type used for the parameters, covariances and
+///                  Jacobians
+template <typename scalar_t = double>
+class PackedMultiTrajectory final
+    : public MultiTrajectory<PackedMultiTrajectory<scalar_t>> {
+#ifndef DOXYGEN
+  friend MultiTrajectory<PackedMultiTrajectory<scalar_t>>;
+  friend class MappedTrackFile;
+#endif
+
+  using Base = MultiTrajectory<PackedMultiTrajectory<scalar_t>>;
+
+ public:
+  using IndexType = MultiTrajectoryTraits::IndexType;
+  using TrackStateProxy = typename Base::TrackStateProxy;
+  using ConstTrackStateProxy = typename Base::ConstTrackStateProxy;
+  using Scalar = scalar_t;
+
+  /// Number of stored values per covariance
+  static constexpr std::size_t kPackedCovarianceSize =
+      eBoundSize * (eBoundSize + 1) / 2;
+
+  PackedMultiTrajectory() = default;
+
+  /// @param keepJacobians Whether @c pack keeps the Jacobians
+  explicit PackedMultiTrajectory(bool keepJacobians)
+      : m_keepJacobians{keepJacobians} {}
+
+  /// Pack the track states of a trajectory
+  ///
+  /// @param other The trajectory to pack
+  /// @param keepJacobians Whether to store the Jacobians
+  explicit PackedMultiTrajectory(const VectorMultiTrajectory& other,
+                                 bool keepJacobians = false)
+      : m_keepJacobians{keepJacobians},
+        m_index{other.m_index},
+        m_meas{other.m_meas},
+        m_measOffset{other.m_measOffset},
+        m_measCov{other.m_measCov},
+        m_measCovOffset{other.m_measCovOffset},
+        m_sourceLinks{other.m_sourceLinks},
+        m_projectors{other.m_projectors},
+        m_referenceSurfaces{other.m_referenceSurfaces} {
+    m_params.resize(other.m_params.size() * eBoundSize);
+    m_cov.resize(other.m_cov.size() * kPackedCovarianceSize);
+    for (std::size_t i = 0; i < other.m_params.size(); ++i) {
+      packParameters(other.m_params[i], &m_params[i * eBoundSize]);
+      packCovariance(other.m_cov[i], &m_cov[i * kPackedCovarianceSize]);
+      addExpandedParameters();
+    }
+
+    if (m_keepJacobians) {
+      m_jac.resize(other.m_jac.size() * eBoundSize * eBoundSize);
+      for (std::size_t i = 0; i < other.m_jac.size(); ++i) {
+        packJacobian(other.m_jac[i], &m_jac[i * eBoundSize * eBoundSize]);
+        addExpandedJacobian();
+      }
+    } else {
+      dropJacobians();
+    }
+
+    for (const auto& [key, value] : other.m_dynamic) {
+      m_dynamic.insert({key, value->clone()});
+    }
+  }
+
+  PackedMultiTrajectory(const PackedMultiTrajectory& other)
+      : m_keepJacobians{other.m_keepJacobians},
+        m_index{other.m_index},
+        m_params{other.m_params},
+        m_cov{other.m_cov},
+        m_jac{other.m_jac},
+        m_expandedParams{other.m_expandedParams},
+        m_expandedCov{other.m_expandedCov},
+        m_expandedJac{other.m_expandedJac},
+        m_meas{other.m_meas},
+        m_measOffset{other.m_measOffset},
+        m_measCov{other.m_measCov},
+        m_measCovOffset{other.m_measCovOffset},
+        m_sourceLinks{other.m_sourceLinks},
+        m_projectors{other.m_projectors},
+        m_referenceSurfaces{other.m_referenceSurfaces} {
+    for (const auto& [key, value] : other.m_dynamic) {
+      m_dynamic.insert({key, value->clone()});
+    }
+  }
+
+  PackedMultiTrajectory(PackedMultiTrajectory&&) = default;
+
+  /// Round the expanded values into the packed storage and release them
+  ///
+  /// Jacobians are dropped unless the trajectory keeps them.
+  ///
+  /// @note This invalidates all maps to parameters, covariances and
+  ///       Jacobians obtained from the track state proxies.
+  void pack() {
+    for (std::size_t i = 0; i < m_cov.size() / kPackedCovarianceSize; ++i) {
+      if constexpr (not kInPlace) {
+        if (const auto* params = m_expandedParams.find(i)) {
+          packParameters(*params, &m_params[i * eBoundSize]);
+        }
+      }
+      if (const auto* cov = m_expandedCov.find(i)) {
+        packCovariance(*cov, &m_cov[i * kPackedCovarianceSize]);
+      }
+    }
+    m_expandedParams.release();
+    m_expandedCov.release();
+
+    if (m_keepJacobians) {
+      if constexpr (not kInPlace) {
+        for (std::size_t i = 0; i < m_jac.size() / (eBoundSize * eBoundSize);
+             ++i) {
+          if (const auto* jac = m_expandedJac.find(i)) {
+            packJacobian(*jac, &m_jac[i * eBoundSize * eBoundSize]);
+          }
+        }
+        m_expandedJac.release();
+      }
+    } else {
+      dropJacobians();
+    }
+  }
+
+  /// Memory used by the packed parameters, covariances and Jacobians
+  std::size_t packedBytes() const {
+    return (m_params.size() + m_cov.size() + m_jac.size()) * sizeof(scalar_t);
+  }
+
+  /// Memory used by the expanded values which have not been packed yet
+  std::size_t expandedBytes() const {
+    return m_expandedParams.expandedSize() * sizeof(BoundVector) +
+           m_expandedCov.expandedSize() * sizeof(BoundSymMatrix) +
+           m_expandedJac.expandedSize() * sizeof(BoundMatrix);
+  }
+
+  /// Store the upper triangle of a covariance
+  ///
+  /// @param cov The covariance
+  /// @param packed Output for @c kPackedCovarianceSize values
+  static void packCovariance(const BoundSymMatrix& cov, scalar_t* packed) {
+    for (std::size_t r = 0; r < eBoundSize; ++r) {
+      for (std::size_t c = r; c < eBoundSize; ++c) {
+        *packed++ = static_cast<scalar_t>(cov(r, c));
+      }
+    }
+  }
+
+  /// Restore a covariance from its upper triangle
+  ///
+  /// @param packed The @c kPackedCovarianceSize stored values
+  /// @param cov Output covariance
+  static void unpackCovariance(const scalar_t* packed, BoundSymMatrix& cov) {
+    for (std::size_t r = 0; r < eBoundSize; ++r) {
+      for (std::size_t c = r; c < eBoundSize; ++c) {
+        cov(r, c) = cov(c, r) = *packed++;
+      }
+    }
+  }
+
+  // BEGIN INTERFACE
+
+  IndexType calibratedSize_impl(IndexType istate) const {
+    return m_index[istate].measdim;
+  }
+
+  SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
+    return m_sourceLinks[m_index[istate].iuncalibrated].value();
+  }
+
+  const Surface* referenceSurface_impl(IndexType istate) const {
+    return m_referenceSurfaces[istate].get();
+  }
+
+  typename TrackStateProxy::Parameters parameters_impl(IndexType parIdx) {
+    if constexpr (kInPlace) {
+      return typename TrackStateProxy::Parameters{
+          &m_params[parIdx * eBoundSize]};
+    } else {
+      return typename TrackStateProxy::Parameters{
+          expandParameters(parIdx).data()};
+    }
+  }
+
+  typename ConstTrackStateProxy::Parameters parameters_impl(
+      IndexType parIdx) const {
+    if constexpr (kInPlace) {
+      return typename ConstTrackStateProxy::Parameters{
+          &m_params[parIdx * eBoundSize]};
+    } else {
+      return typename ConstTrackStateProxy::Parameters{
+          expandParameters(parIdx).data()};
+    }
+  }
+
+  typename TrackStateProxy::Covariance covariance_impl(IndexType parIdx) {
+    return typename TrackStateProxy::Covariance{
+        expandCovariance(parIdx).data()};
+  }
+
+  typename ConstTrackStateProxy::Covariance covariance_impl(
+      IndexType parIdx) const {
+    return typename ConstTrackStateProxy::Covariance{
+        expandCovariance(parIdx).data()};
+  }
+
+  typename TrackStateProxy::Covariance jacobian_impl(IndexType istate) {
+    IndexType jacIdx = m_index[istate].ijacobian;
+    if constexpr (kInPlace) {
+      return typename TrackStateProxy::Covariance{
+          &m_jac[jacIdx * eBoundSize * eBoundSize]};
+    } else {
+      return typename TrackStateProxy::Covariance{
+          expandJacobian(jacIdx).data()};
+    }
+  }
+
+  typename ConstTrackStateProxy::Covariance jacobian_impl(
+      IndexType istate) const {
+    IndexType jacIdx = m_index[istate].ijacobian;
+    if constexpr (kInPlace) {
+      return typename ConstTrackStateProxy::Covariance{
+          &m_jac[jacIdx * eBoundSize * eBoundSize]};
+    } else {
+      return typename ConstTrackStateProxy::Covariance{
+          expandJacobian(jacIdx).data()};
+    }
+  }
+
+  template <std::size_t measdim>
+  typename TrackStateProxy::template Measurement<measdim> measurement_impl(
+      IndexType istate) {
+    IndexType offset = m_measOffset[istate];
+    return typename TrackStateProxy::template Measurement<measdim>{
+        &m_meas[offset]};
+  }
+
+  template <std::size_t measdim>
+  typename ConstTrackStateProxy::template Measurement<measdim>
+  measurement_impl(IndexType istate) const {
+    IndexType offset = m_measOffset[istate];
+    return typename ConstTrackStateProxy::template Measurement<measdim>{
+        &m_meas[offset]};
+  }
+
+  template <std::size_t measdim>
+  typename TrackStateProxy::template MeasurementCovariance<measdim>
+  measurementCovariance_impl(IndexType istate) {
+    IndexType offset = m_measCovOffset[istate];
+    return typename TrackStateProxy::template MeasurementCovariance<measdim>{
+        &m_measCov[offset]};
+  }
+
+  template <std::size_t measdim>
+  typename ConstTrackStateProxy::template MeasurementCovariance<measdim>
+  measurementCovariance_impl(IndexType istate) const {
+    IndexType offset = m_measCovOffset[istate];
+    return typename ConstTrackStateProxy::template MeasurementCovariance<
+        measdim>{&m_measCov[offset]};
+  }
+
+  IndexType addTrackState_impl(
+      TrackStatePropMask mask = TrackStatePropMask::All,
+      IndexType iprevious = kInvalid) {
+    using PropMask = TrackStatePropMask;
+
+    m_index.emplace_back();
+    auto& p = m_index.back();
+    IndexType index = m_index.size() - 1;
+
+    p.allocMask = mask;
+    if (iprevious != kInvalid) {
+      p.iprevious = iprevious;
+    }
+
+    // always set, but can be null
+    m_referenceSurfaces.emplace_back(nullptr);
+
+    if (ACTS_CHECK_BIT(mask, PropMask::Predicted)) {
+      p.ipredicted = addParameters();
+    }
+    if (ACTS_CHECK_BIT(mask, PropMask::Filtered)) {
+      p.ifiltered = addParameters();
+    }
+    if (ACTS_CHECK_BIT(mask, PropMask::Smoothed)) {
+      p.ismoothed = addParameters();
+    }
+
+    if (ACTS_CHECK_BIT(mask, PropMask::Jacobian)) {
+      p.ijacobian = m_jac.size() / (eBoundSize * eBoundSize);
+      m_jac.resize(m_jac.size() + eBoundSize * eBoundSize);
+      addExpandedJacobian();
+    }
+
+    m_sourceLinks.emplace_back(std::nullopt);
+    p.iuncalibrated = m_sourceLinks.size() - 1;
+
+    m_measOffset.push_back(kInvalid);
+    m_measCovOffset.push_back(kInvalid);
+
+    if (ACTS_CHECK_BIT(mask, PropMask::Calibrated)) {
+      m_sourceLinks.emplace_back(std::nullopt);
+      p.icalibratedsourcelink = m_sourceLinks.size() - 1;
+
+      m_projectors.emplace_back();
+      p.iprojector = m_projectors.size() - 1;
+    }
+
+    for (auto& [key, vec] : m_dynamic) {
+      vec->add();
+    }
+
+    return index;
+  }
+
+  void shareFrom_impl(IndexType iself, IndexType iother,
+                      TrackStatePropMask shareSource,
+                      TrackStatePropMask shareTarget) {
+    auto& self = m_index[iself];
+    const auto& other = m_index[iother];
+
+    using PM = TrackStatePropMask;
+
+    IndexType sourceIndex{kInvalid};
+    switch (shareSource) {
+      case PM::Predicted:
+        sourceIndex = other.ipredicted;
+        break;
+      case PM::Filtered:
+        sourceIndex = other.ifiltered;
+        break;
+      case PM::Smoothed:
+        sourceIndex = other.ismoothed;
+        break;
+      case PM::Jacobian:
+        sourceIndex = other.ijacobian;
+        break;
+      default:
+        throw std::domain_error{"Unable to share this component"};
+    }
+
+    assert(sourceIndex != kInvalid);
+
+    switch (shareTarget) {
+      case PM::Predicted:
+        assert(shareSource != PM::Jacobian);
+        self.ipredicted = sourceIndex;
+        break;
+      case PM::Filtered:
+        assert(shareSource != PM::Jacobian);
+        self.ifiltered = sourceIndex;
+        break;
+      case PM::Smoothed:
+        assert(shareSource != PM::Jacobian);
+        self.ismoothed = sourceIndex;
+        break;
+      case PM::Jacobian:
+        assert(shareSource == PM::Jacobian);
+        self.ijacobian = sourceIndex;
+        break;
+      default:
+        throw std::domain_error{"Unable to share this component"};
+    }
+  }
+
+  void unset_impl(TrackStatePropMask target, IndexType istate) {
+    using PM = TrackStatePropMask;
+
+    switch (target) {
+      case PM::Predicted:
+        m_index[istate].ipredicted = kInvalid;
+        break;
+      case PM::Filtered:
+        m_index[istate].ifiltered = kInvalid;
+        break;
+      case PM::Smoothed:
+        m_index[istate].ismoothed = kInvalid;
+        break;
+      case PM::Jacobian:
+        m_index[istate].ijacobian = kInvalid;
+        break;
+      case PM::Calibrated:
+        m_measOffset[istate] = kInvalid;
+        m_measCovOffset[istate] = kInvalid;
+        break;
+      default:
+        throw std::domain_error{"Unable to unset this component"};
+    }
+  }
+
+  constexpr bool has_impl(HashedString key, IndexType istate) const {
+    return detail_vmt::VectorMultiTrajectoryBase::has_impl(*this, key, istate);
+  }
+
+  IndexType size_impl() const { return m_index.size(); }
+
+  void clear_impl() {
+    m_index.clear();
+    m_params.clear();
+    m_cov.clear();
+    m_jac.clear();
+    m_expandedParams.clear();
+    m_expandedCov.clear();
+    m_expandedJac.clear();
+    m_meas.clear();
+    m_measOffset.clear();
+    m_measCov.clear();
+    m_measCovOffset.clear();
+    m_sourceLinks.clear();
+    m_projectors.clear();
+    m_referenceSurfaces.clear();
+    for (auto& [key, vec] : m_dynamic) {
+      vec->clear();
+    }
+  }
+
+  std::any component_impl(HashedString key, IndexType istate) {
+    return detail_vmt::VectorMultiTrajectoryBase::component_impl<false>(
+        *this, key, istate);
+  }
+
+  std::any component_impl(HashedString key, IndexType istate) const {
+    return detail_vmt::VectorMultiTrajectoryBase::component_impl<true>(
+        *this, key, istate);
+  }
+
+  template <typename T>
+  constexpr void addColumn_impl(const std::string& key) {
+    m_dynamic.insert(
+        {hashString(key), std::make_unique<detail::DynamicColumn<T>>()});
+  }
+
+  constexpr bool hasColumn_impl(HashedString key) const {
+    return detail_vmt::VectorMultiTrajectoryBase::hasColumn_impl(*this, key);
+  }
+
+  void allocateCalibrated_impl(IndexType istate, std::size_t measdim) {
+    if (m_measOffset[istate] != kInvalid &&
+        m_measCovOffset[istate] != kInvalid &&
+        m_index[istate].measdim == measdim) {
+      return;
+    }
+
+    m_index[istate].measdim = measdim;
+
+    m_measOffset[istate] = static_cast<IndexType>(m_meas.size());
+    m_meas.resize(m_meas.size() + measdim);
+
+    m_measCovOffset[istate] = static_cast<IndexType>(m_measCov.size());
+    m_measCov.resize(m_measCov.size() + measdim * measdim);
+  }
+
+  void setUncalibratedSourceLink_impl(IndexType istate, SourceLink sourceLink) {
+    m_sourceLinks[m_index[istate].iuncalibrated] = std::move(sourceLink);
+  }
+
+  void setReferenceSurface_impl(IndexType istate,
+                                std::shared_ptr<const Surface> surface) {
+    m_referenceSurfaces[istate] = std::move(surface);
+  }
+
+  // END INTERFACE
+
+ private:
+  friend detail_vmt::VectorMultiTrajectoryBase;
+
+  static constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
+
+  /// Whether parameters and Jacobians are mapped in the packed storage
+  static constexpr bool kInPlace = std::is_same_v<scalar_t, double>;
+
+  static void packParameters(const BoundVector& params, scalar_t* packed) {
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      packed[i] = static_cast<scalar_t>(params[i]);
+    }
+  }
+
+  static void packJacobian(const BoundMatrix& jac, scalar_t* packed) {
+    for (std::size_t i = 0; i < eBoundSize * eBoundSize; ++i) {
+      packed[i] = static_cast<scalar_t>(jac.data()[i]);
+    }
+  }
+
+  BoundVector& expandParameters(IndexType parIdx) const {
+    return m_expandedParams.get(parIdx, [&](BoundVector& params) {
+      const scalar_t* packed = &m_params[parIdx * eBoundSize];
+      for (std::size_t i = 0; i < eBoundSize; ++i) {
+        params[i] = packed[i];
+      }
+    });
+  }
+
+  BoundSymMatrix& expandCovariance(IndexType parIdx) const {
+    return m_expandedCov.get(parIdx, [&](BoundSymMatrix& cov) {
+      unpackCovariance(&m_cov[parIdx * kPackedCovarianceSize], cov);
+    });
+  }
+
+  BoundMatrix& expandJacobian(IndexType jacIdx) const {
+    return m_expandedJac.get(jacIdx, [&](BoundMatrix& jac) {
+      const scalar_t* packed = &m_jac[jacIdx * eBoundSize * eBoundSize];
+      for (std::size_t i = 0; i < eBoundSize * eBoundSize; ++i) {
+        jac.data()[i] = packed[i];
+      }
+    });
+  }
+
+  IndexType addParameters() {
+    IndexType parIdx = m_cov.size() / kPackedCovarianceSize;
+    m_params.resize(m_params.size() + eBoundSize);
+    m_cov.resize(m_cov.size() + kPackedCovarianceSize);
+    addExpandedParameters();
+    return parIdx;
+  }
+
+  void addExpandedParameters() {
+    if constexpr (not kInPlace) {
+      m_expandedParams.push_back();
+    }
+    m_expandedCov.push_back();
+  }
+
+  void addExpandedJacobian() {
+    if constexpr (not kInPlace) {
+      m_expandedJac.push_back();
+    }
+  }
+
+  void dropJacobians() {
+    for (auto& index : m_index) {
+      index.ijacobian = kInvalid;
+    }
+    m_jac.clear();
+    m_expandedJac.clear();
+  }
+
+  bool m_keepJacobians = false;
+
+  std::vector<detail_vmt::VectorMultiTrajectoryBase::IndexData> m_index;
+  std::vector<scalar_t> m_params;
+  std::vector<scalar_t> m_cov;
+  std::vector<scalar_t> m_jac;
+
+  detail_pmt::ExpandedColumn<BoundVector> m_expandedParams;
+  detail_pmt::ExpandedColumn<BoundSymMatrix> m_expandedCov;
+  detail_pmt::ExpandedColumn<BoundMatrix> m_expandedJac;
+
+  std::vector<double> m_meas;
+  std::vector<IndexType> m_measOffset;
+  std::vector<double> m_measCov;
+  std::vector<IndexType> m_measCovOffset;
+
+  std::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::vector<ProjectorBitset> m_projectors;
+  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+
+  std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
+      m_dynamic;
+};
+
+ACTS_STATIC_CHECK_CONCEPT(MutableMultiTrajectoryBackend,
+                          PackedMultiTrajectory<double>);
+ACTS_STATIC_CHECK_CONCEPT(MutableMultiTrajectoryBackend,
+                          PackedMultiTrajectory<float>);
+
+}  // namespace Acts
@@ -36,6 +36,10 @@ namespace Acts {
 class Surface;
 template <typename T>
 struct IsReadOnlyMultiTrajectory;
+template <typename scalar_t>
+class PackedMultiTrajectory;
+class MappedMultiTrajectory;
+class MappedTrackFile;
 
 namespace detail_vmt {
 
@@ -44,6 +48,13 @@ constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
 constexpr auto MeasurementSizeMax = MultiTrajectoryTraits::MeasurementSizeMax;
 
 class VectorMultiTrajectoryBase {
+#ifndef DOXYGEN
+  template <typename scalar_t>
+  friend class Acts::PackedMultiTrajectory;
+  friend class Acts::MappedMultiTrajectory;
+  friend class Acts::MappedTrackFile;
+#endif
+
  public:
   struct Statistics {
     using axis_t = boost::histogram::axis::variant<
@@ -411,6 +422,33 @@ class VectorMultiTrajectory final
 
   void reserve(std::size_t n);
 
+  /// Append all track states of another trajectory to this one
+  ///
+  /// The indices of the appended track states and of their components are
+  /// shifted, so that the links between them stay valid. The result is the
+  /// same as if the track states had been created in this trajectory.
+  /// Both trajectories need to have the same dynamic columns.
+  ///
+  /// @param other The trajectory to append
+  /// @return The index of the first appended track state in this trajectory
+  IndexType append(const VectorMultiTrajectory& other);
+
+  /// Remove the track states which are not reachable from the given tips
+  ///
+  /// The surviving states and the components they reference are moved into
+  /// densely packed storage, preserving their order, and all indices between
+  /// them are remapped. Only the states from @p begin on are considered; the
+  /// states before it and their components are left untouched, so that the
+  /// cost only scales with the number of considered states. The considered
+  /// states must not share components with the states before @p begin.
+  ///
+  /// @param tips The tips of the trajectories to keep
+  /// @param begin The index of the first state to consider
+  /// @return The new index of every considered state, indexed by
+  ///         `istate - begin`, or kInvalid if the state was removed
+  std::vector<IndexType> compact(const std::vector<IndexType>& tips,
+                                 IndexType begin = 0);
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
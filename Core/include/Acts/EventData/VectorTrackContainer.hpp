@@ -236,6 +236,17 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   void reserve(IndexType size);
   void clear();
 
+  /// Append all tracks of another container to this one
+  ///
+  /// The track states of @p other are expected to have been appended to
+  /// the trajectory of this container with @c VectorMultiTrajectory::append
+  /// before, the tip indices are shifted accordingly.
+  /// Both containers need to have the same dynamic columns.
+  ///
+  /// @param other The container to append
+  /// @param stateOffset The index of the first appended track state
+  void append(const VectorTrackContainer& other, IndexType stateOffset);
+
   void setReferenceSurface_impl(IndexType itrack,
                                 std::shared_ptr<const Surface> surface) {
     m_referenceSurfaces[itrack] = std::move(surface);
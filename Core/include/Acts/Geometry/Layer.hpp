@@ -14,6 +14,7 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/GeometryObject.hpp"
+#include "Acts/Geometry/SurfaceCandidateCache.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
@@ -173,6 +174,19 @@ class Layer : public virtual GeometryObject {
       const Vector3& direction,
       const NavigationOptions<Surface>& options) const;
 
+  /// Build the cache of the surface candidates per bin of the surface array
+  ///
+  /// Once built, @c compatibleSurfaces pre-selects the sensitive surfaces
+  /// with the cache before intersecting them. This is an opt-in acceleration
+  /// for the nominal geometry: for geometry contexts carrying a value, which
+  /// may move the surfaces, the uncached lookup is used.
+  ///
+  /// @param gctx The geometry context used to place the surfaces
+  void buildSurfaceCandidateCache(const GeometryContext& gctx);
+
+  /// Return the surface candidate cache, if it has been built
+  const SurfaceCandidateCache* surfaceCandidateCache() const;
+
   /// Surface seen on approach
   /// for layers without sub structure, this is the surfaceRepresentation
   /// for layers with sub structure, this is the approachSurface
@@ -246,6 +260,9 @@ class Layer : public virtual GeometryObject {
   ///
   std::unique_ptr<const SurfaceArray> m_surfaceArray = nullptr;
 
+  /// Optional cache of the surface candidates per bin of the surface array
+  std::unique_ptr<const SurfaceCandidateCache> m_candidateCache = nullptr;
+
   /// Thickness of the Layer
   double m_layerThickness = 0.;
 
@@ -50,6 +50,9 @@ class LayerCreator {
     double cylinderZtolerance{10.};
     /// cylinder module phi tolerance : it counts at same phi, if ...
     double cylinderPhiTolerance{0.1};
+    /// build the surface candidate cache of the layers, which speeds up the
+    /// navigation with the nominal (empty) geometry context
+    bool surfaceCandidateCache = false;
     /// standard constructor
     Config() = default;
   };
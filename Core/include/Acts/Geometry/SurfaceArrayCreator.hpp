@@ -88,6 +88,10 @@ class SurfaceArrayCreator {
     /// of bins to the lowest number of non-equivalent phi surfaces
     /// of all r-bins. If false, this step is skipped.
     bool doPhiBinningOptimization = true;
+
+    /// Build the flat neighbor lookup of the surface arrays, which avoids
+    /// the virtual grid lookup and the scattered bin contents in navigation
+    bool flatLookup = false;
   };
 
   /// Constructor with default config
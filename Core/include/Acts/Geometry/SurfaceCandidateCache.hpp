@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+class Surface;
+
+/// @class SurfaceCandidateCache
+///
+/// Per bin placement of the neighbor surfaces of a @c SurfaceArray, which
+/// allows to discard most of the candidate surfaces of a layer before they
+/// are intersected.
+///
+/// The unique surfaces of every bin and its neighbors are taken from the
+/// neighbor table of the surface array, which is shared with its flat lookup.
+/// In the same order, a structure of arrays holds their plane (normal and
+/// reference point) and a bounding circle of their bounds on the plane.
+///
+/// The selection intersects all planes of a bin in one loop and only keeps
+/// the surfaces which are within the path limits and whose bounding
+/// circle contains the intersection. The kept surfaces still have to be
+/// intersected exactly, the selection never rejects a surface which the
+/// exact intersection would accept.
+///
+/// Surfaces which are not planes or discs are always kept, planar surfaces
+/// with non-cartesian bounds (e.g. annulus bounds) or without bounds are only
+/// subject to the path limits.
+///
+/// @note The placement of the surfaces is taken from the geometry context
+/// given at construction. As geometry contexts can not be compared, the cache
+/// only applies to the nominal geometry, i.e. if neither this context nor
+/// the one of the query carry a value. See @c isValid.
+class SurfaceCandidateCache {
+ public:
+  /// The selected surfaces
+  using Candidates = boost::container::small_vector<const Surface*, 20>;
+
+  /// Constructor from a surface array
+  ///
+  /// @param gctx The geometry context which places the surfaces
+  /// @param surfaceArray The surface array to take the neighbor lookup from
+  SurfaceCandidateCache(const GeometryContext& gctx,
+                        const SurfaceArray& surfaceArray);
+
+  /// Select the candidate surfaces of a bin
+  ///
+  /// @param bin The global bin of the surface array
+  /// @param position The start position
+  /// @param direction The signed direction, the intersections in this
+  ///        direction have a positive path length
+  /// @param pathLimit The path limit, compared in absolute value
+  /// @param overstepLimit The overstep limit
+  /// @param tolerance Absolute tolerance of the boundary check, infinity if
+  ///        the bounds must not be used
+  /// @param [out] candidates The selected surfaces are appended to this
+  void select(std::size_t bin, const Vector3& position,
+              const Vector3& direction, double pathLimit, double overstepLimit,
+              double tolerance, Candidates& candidates) const;
+
+  /// Whether the cached placement can be used for a geometry context
+  ///
+  /// Contexts carrying a value may move the surfaces, e.g. for alignment,
+  /// in which case the candidates have to be taken from the surface array.
+  ///
+  /// @param gctx The geometry context of the query
+  bool isValid(const GeometryContext& gctx) const {
+    return m_nominalContext && !gctx.hasValue();
+  }
+
+  /// The number of bins
+  std::size_t size() const { return m_neighbors->size(); }
+
+  /// The surfaces stored for a bin, without selection
+  ///
+  /// @param bin The global bin of the surface array
+  std::vector<const Surface*> surfaces(std::size_t bin) const;
+
+ private:
+  /// The unique surfaces of every bin and its neighbors
+  std::shared_ptr<const SurfaceArray::NeighborTable> m_neighbors;
+
+  /// Reference point of the plane, center of the bounding circle
+  std::vector<double> m_centerX;
+  std::vector<double> m_centerY;
+  std::vector<double> m_centerZ;
+
+  /// Normal vector of the plane
+  std::vector<double> m_normalX;
+  std::vector<double> m_normalY;
+  std::vector<double> m_normalZ;
+
+  /// Radius of the bounding circle, infinity for unbounded and negative for
+  /// non planar surfaces
+  std::vector<double> m_radius;
+
+  /// Whether the cache was built with the nominal geometry context
+  bool m_nominalContext = false;
+};
+
+}  // namespace Acts
@@ -19,6 +19,10 @@ inline SurfaceArray* Layer::surfaceArray() {
   return const_cast<SurfaceArray*>(m_surfaceArray.get());
 }
 
+inline const SurfaceCandidateCache* Layer::surfaceCandidateCache() const {
+  return m_candidateCache.get();
+}
+
 inline double Layer::thickness() const {
   return m_layerThickness;
 }
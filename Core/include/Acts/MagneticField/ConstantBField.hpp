@@ -59,6 +59,17 @@ class ConstantBField final : public MagneticFieldProvider {
     return Result<Vector3>::success(m_BField);
   }
 
+  /// @copydoc MagneticFieldProvider::getFields(const std::vector<Vector3>&,std::vector<Vector3>&,MagneticFieldProvider::Cache&) const
+  ///
+  /// @note The field value is the same for all positions.
+  Result<void> getFields(const std::vector<Vector3>& positions,
+                         std::vector<Vector3>& fields,
+                         MagneticFieldProvider::Cache& cache) const override {
+    (void)cache;
+    fields.assign(positions.size(), m_BField);
+    return Result<void>::success();
+  }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   Acts::MagneticFieldProvider::Cache makeCache(
       const Acts::MagneticFieldContext& mctx) const override {
@@ -12,12 +12,15 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldError.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/detail/TrilinearFieldCells.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
 #include <functional>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
@@ -173,6 +176,19 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     /// @note Negative values for @p scale are accepted and will invert the
     ///       direction of the magnetic field.
     double scale = 1.;
+
+    /// @brief precompute the interpolation coefficients of all grid cells
+    ///
+    /// Only available for three dimensional maps with equidistant axes. The
+    /// lookups do not need the field cell cache anymore and the gradient is
+    /// calculated, at the cost of eight times the memory of the grid.
+    ///
+    /// @note The gradient is taken with respect to the grid coordinates, so
+    ///       this requires cartesian transformations, i.e. @c transformPos
+    ///       may at most translate the position and @c transformBField has to
+    ///       return the field unchanged. Other transformations are rejected
+    ///       by the constructor.
+    bool useCellCoefficients = false;
   };
 
   /// @brief default constructor
@@ -182,6 +198,19 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     minBin.fill(1);
     m_lowerLeft = m_cfg.grid.lowerLeftBinEdge(minBin);
     m_upperRight = m_cfg.grid.lowerLeftBinEdge(m_cfg.grid.numLocalBins());
+
+    if (m_cfg.useCellCoefficients) {
+      if constexpr (DIM_POS == 3 and std::is_same_v<FieldType, Vector3>) {
+        if (not hasCartesianTransforms()) {
+          throw std::invalid_argument(
+              "Cell coefficients require cartesian field map transformations");
+        }
+        m_cells.emplace(m_cfg.grid);
+      } else {
+        throw std::invalid_argument(
+            "Cell coefficients are only available for 3D field maps");
+      }
+    }
   }
 
   /// @brief retrieve field cell for given position
@@ -287,18 +316,20 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     }
 
     return Result<Vector3>::success(
-        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position));
+        m_cfg.transformBField(interpolateLocal(gridPosition), position));
   }
 
   Vector3 getFieldUnchecked(const Vector3& position) const final {
     const auto gridPosition = m_cfg.transformPos(position);
-    return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
-                                 position);
+    return m_cfg.transformBField(interpolateLocal(gridPosition), position);
   }
 
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const final {
+    if (m_cells) {
+      return getField(position);
+    }
     Cache& lcache = cache.get<Cache>();
     const auto gridPosition = m_cfg.transformPos(position);
     if (!lcache.fieldCell || !(*lcache.fieldCell).isInside(gridPosition)) {
@@ -313,19 +344,83 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
 
   /// @copydoc MagneticFieldProvider::getFieldGradient(const Vector3&,ActsMatrix<3,3>&,MagneticFieldProvider::Cache&) const
   ///
-  /// @note currently the derivative is not calculated
-  /// @note Cache is not used currently
-  /// @todo return derivative
+  /// @note the derivative is only calculated if the cell coefficients are
+  ///       used, otherwise it is left unchanged
   Result<Vector3> getFieldGradient(
       const Vector3& position, ActsMatrix<3, 3>& derivative,
       MagneticFieldProvider::Cache& cache) const final {
+    if constexpr (DIM_POS == 3 and std::is_same_v<FieldType, Vector3>) {
+      if (m_cells) {
+        const auto gridPosition = m_cfg.transformPos(position);
+        if (!isInsideLocal(gridPosition)) {
+          return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
+        }
+        Vector3 fraction;
+        const auto& cell = m_cells->cell(gridPosition, fraction);
+        // the field transformation is linear in the field
+        const ActsMatrix<3, 3> gradient = m_cells->gradient(cell, fraction);
+        for (unsigned int i = 0; i < 3; ++i) {
+          derivative.col(i) = m_cfg.transformBField(gradient.col(i), position);
+        }
+        return Result<Vector3>::success(m_cfg.transformBField(
+            detail::TrilinearFieldCells::field(cell, fraction), position));
+      }
+    }
     (void)derivative;
     return getField(position, cache);
   }
 
  private:
+  /// @brief check that the transformations are cartesian
+  ///
+  /// The transformations are probed at the corners and the center of the
+  /// grid. The position transformation may translate the position, its
+  /// Jacobian has to be the identity, and the field has to be unchanged.
+  bool hasCartesianTransforms() const {
+    const Vector3 lowerLeft(m_lowerLeft[0], m_lowerLeft[1], m_lowerLeft[2]);
+    const Vector3 upperRight(m_upperRight[0], m_upperRight[1],
+                             m_upperRight[2]);
+    const Vector3 center = 0.5 * (lowerLeft + upperRight);
+    const Vector3 gridCenter = m_cfg.transformPos(center);
+    const double tolerance = 1e-9 * (upperRight - lowerLeft).norm();
+    for (unsigned int corner = 0; corner < 8; ++corner) {
+      Vector3 position;
+      for (unsigned int i = 0; i < 3; ++i) {
+        position[i] = ((corner >> i) & 1) ? upperRight[i] : lowerLeft[i];
+      }
+      const Vector3 gridPosition = m_cfg.transformPos(position);
+      if (((gridPosition - gridCenter) - (position - center)).norm() >
+          tolerance) {
+        return false;
+      }
+    }
+    for (const Vector3& position : {lowerLeft, center, upperRight}) {
+      for (unsigned int i = 0; i < 3; ++i) {
+        const Vector3 unit = Vector3::Unit(i);
+        if ((m_cfg.transformBField(unit, position) - unit).norm() > 1e-9) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// @brief interpolate the local field at a position in grid coordinates
+  FieldType interpolateLocal(const ActsVector<DIM_POS>& gridPosition) const {
+    if constexpr (DIM_POS == 3 and std::is_same_v<FieldType, Vector3>) {
+      if (m_cells) {
+        Vector3 fraction;
+        const auto& cell = m_cells->cell(gridPosition, fraction);
+        return detail::TrilinearFieldCells::field(cell, fraction);
+      }
+    }
+    return m_cfg.grid.interpolate(gridPosition);
+  }
+
   Config m_cfg;
 
+  std::optional<detail::TrilinearFieldCells> m_cells;
+
   typename Grid::point_t m_lowerLeft;
   typename Grid::point_t m_upperRight;
 };
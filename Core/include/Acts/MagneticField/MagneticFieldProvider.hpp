@@ -15,6 +15,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 namespace Acts {
 
@@ -54,9 +55,38 @@ class MagneticFieldProvider {
                                            ActsMatrix<3, 3>& derivative,
                                            Cache& cache) const = 0;
 
+  /// Retrieve magnetic field values at several locations at once. Requires a
+  /// cache object created through makeCache(). Implementations can override
+  /// this to share the lookup work between the positions, the default calls
+  /// getField() for each position.
+  ///
+  /// @param [in] positions global 3D positions for the lookup
+  /// @param [out] fields magnetic field vectors at the given positions,
+  ///                     resized to the number of positions
+  /// @param [in,out] cache Field provider specific cache object
+  ///
+  /// @return the error of the first failed lookup, if any
+  virtual Result<void> getFields(const std::vector<Vector3>& positions,
+                                 std::vector<Vector3>& fields,
+                                 Cache& cache) const;
+
   virtual ~MagneticFieldProvider();
 };
 
+inline Result<void> MagneticFieldProvider::getFields(
+    const std::vector<Vector3>& positions, std::vector<Vector3>& fields,
+    Cache& cache) const {
+  fields.resize(positions.size());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto field = getField(positions[i], cache);
+    if (!field.ok()) {
+      return field.error();
+    }
+    fields[i] = *field;
+  }
+  return Result<void>::success();
+}
+
 inline MagneticFieldProvider::~MagneticFieldProvider() = default;
 
 }  // namespace Acts
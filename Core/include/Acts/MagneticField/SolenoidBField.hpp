@@ -15,6 +15,8 @@
 
 #include <cstddef>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -24,6 +26,12 @@ namespace Acts {
 /// Implements a multi-coil solenoid magnetic field. On every call, the field
 /// is evaluated at that exact position. The field has radially symmetry, the
 /// field vectors point in +z direction.
+/// Optionally, the field is tabulated in (r,z) at construction time and
+/// interpolated bilinearly, which avoids summing the elliptic integrals of
+/// all coils on every call. The table nodes are refined until the
+/// interpolation error at the node midpoints is below a configurable
+/// tolerance, which places most nodes around the coil ends. An estimate of
+/// the achieved error is available through @c tableErrorEstimate.
 /// The config exposes a target field value in the center. This value is used
 /// to empirically determine a scale factor which reproduces this field value
 /// in the center.
@@ -88,6 +96,18 @@ class SolenoidBField final : public MagneticFieldProvider {
     /// The target magnetic field strength at the center.
     /// This will be used to scale coefficients
     double bMagCenter;
+    /// Tabulate the field in (r,z) at construction and interpolate in the
+    /// table instead of evaluating the coils on every call. Positions
+    /// outside of the table are still evaluated exactly.
+    bool useTable = false;
+    /// Maximum radius of the table, 0.9 * radius if not positive. The field
+    /// of the individual windings close to the coils can not be tabulated.
+    double tableRMax = 0;
+    /// Maximum |z| of the table, length if not positive
+    double tableZMax = 0;
+    /// Target interpolation error of the table relative to bMagCenter. It is
+    /// only checked at the sampled midpoints, see @c tableErrorEstimate.
+    double tableTolerance = 1e-4;
   };
 
   /// @brief the constructur with a shared pointer
@@ -115,25 +135,58 @@ class SolenoidBField final : public MagneticFieldProvider {
 
   /// @copydoc MagneticFieldProvider::getFieldGradient(const Vector3&,ActsMatrix<3,3>&,MagneticFieldProvider::Cache&) const
   ///
-  /// @note currently the derivative is not calculated
-  /// @todo return derivative
+  /// @note Within the table, the derivative of the bilinear interpolation
+  ///       is returned, otherwise it is calculated from central differences
+  ///       of the exact field in (r,z).
   Result<Vector3> getFieldGradient(
       const Vector3& position, ActsMatrix<3, 3>& derivative,
       MagneticFieldProvider::Cache& cache) const override;
 
+  /// @brief Estimate of the maximum absolute interpolation error of the table
+  ///
+  /// The error is sampled at the midpoints between the table nodes along a
+  /// few lines of constant r and z when the table is built, and the r and z
+  /// contributions are added. This is an estimate, not a bound: in between
+  /// the sampled lines the actual error can be larger. It is zero if the
+  /// table is not used.
+  double tableErrorEstimate() const { return m_tableErrorEstimate; }
+
+  /// @brief Number of nodes of the table in r and z
+  std::pair<std::size_t, std::size_t> tableSize() const {
+    return {m_tableR.size(), m_tableZ.size()};
+  }
+
  private:
   Config m_cfg;
   double m_scale;
   double m_dz;
   double m_R2;
 
-  Vector2 multiCoilField(const Vector2& pos, double scale) const;
+  /// table nodes in r and in z >= 0, the field at negative z follows
+  /// from the symmetry of the solenoid
+  std::vector<double> m_tableR;
+  std::vector<double> m_tableZ;
+  /// (B_r, B_z) at (m_tableR[i], m_tableZ[j]) at index i * nZ + j
+  std::vector<Vector2> m_tableField;
+  double m_tableErrorEstimate = 0;
 
-  Vector2 singleCoilField(const Vector2& pos, double scale) const;
+  void buildTable();
+
+  /// Field and its derivatives with respect to r (column 0) and z (column
+  /// 1) at r >= 0 from the table
+  ///
+  /// @return false if the position is outside of the table
+  bool tableField(double r, double z, Vector2& field,
+                  ActsMatrix<2, 2>* derivative) const;
+
+  /// Field at r >= 0, either from the table or evaluated exactly
+  Vector2 localField(double r, double z) const;
 
-  double B_r(const Vector2& pos, double scale) const;
+  Vector3 toCartesian(const Vector3& position, const Vector2& rzField) const;
 
-  double B_z(const Vector2& pos, double scale) const;
+  Vector2 multiCoilField(const Vector2& pos, double scale) const;
+
+  Vector2 singleCoilField(const Vector2& pos, double scale) const;
 
   double k2(double r, double z) const;
 };
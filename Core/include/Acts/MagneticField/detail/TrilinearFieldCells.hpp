@@ -0,0 +1,184 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/IAxis.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts {
+
+namespace detail {
+
+/// @brief Precomputed trilinear interpolation of a three dimensional field map
+///
+/// For each cell of the map, the field is stored as the coefficients of the
+/// trilinear polynomial in the fractional cell coordinates (u,v,w)
+///
+///   B(u,v,w) = c0 + c1 u + c2 v + c3 w + c4 uv + c5 uw + c6 vw + c7 uvw
+///
+/// for all three components at once, so that the field and its analytic
+/// gradient are evaluated with a single 3x8 matrix product and without
+/// touching the neighbouring grid points.
+///
+/// Each cell occupies three cache lines. The cells are stored in bricks of
+/// 4x4x4 cells which are Morton ordered internally, so that a track crossing
+/// neighbouring cells mostly stays within memory that is already cached.
+/// The storage needs eight times the memory of the underlying grid.
+class TrilinearFieldCells {
+ public:
+  struct alignas(64) Cell {
+    /// coefficients of 1, u, v, w, uv, uw, vw, uvw in the columns
+    ActsMatrix<3, 8> coefficients;
+  };
+
+  /// @brief Compute the cell coefficients from the grid points
+  ///
+  /// @tparam grid_t Three dimensional grid with Vector3 values
+  /// @param [in] grid Field map grid with equidistant axes
+  ///
+  /// @note The grid is expected to hold the field values at the lower-left
+  ///       bin edges, including the upper edge in the overflow bins.
+  template <typename grid_t>
+  explicit TrilinearFieldCells(const grid_t& grid) {
+    static_assert(grid_t::DIM == 3, "The field map needs to be 3D");
+
+    const auto axes = grid.axes();
+    for (std::size_t d = 0; d < 3; ++d) {
+      if (not axes[d]->isEquidistant()) {
+        throw std::invalid_argument(
+            "TrilinearFieldCells requires equidistant axes");
+      }
+      m_min[d] = axes[d]->getMin();
+      m_nBins[d] = axes[d]->getNBins();
+      m_invWidth[d] = m_nBins[d] / (axes[d]->getMax() - axes[d]->getMin());
+      m_nBricks[d] = (m_nBins[d] + 3) / 4;
+    }
+    m_cells.resize(m_nBricks[0] * m_nBricks[1] * m_nBricks[2] * 64);
+
+    for (std::size_t i = 0; i < m_nBins[0]; ++i) {
+      for (std::size_t j = 0; j < m_nBins[1]; ++j) {
+        for (std::size_t k = 0; k < m_nBins[2]; ++k) {
+          // corner values, the local bin indices start at 1
+          auto corner = [&](std::size_t a, std::size_t b, std::size_t c) {
+            return Vector3(
+                grid.atLocalBins({{i + 1 + a, j + 1 + b, k + 1 + c}}));
+          };
+          const Vector3 v000 = corner(0, 0, 0);
+          const Vector3 v100 = corner(1, 0, 0);
+          const Vector3 v010 = corner(0, 1, 0);
+          const Vector3 v001 = corner(0, 0, 1);
+          const Vector3 v110 = corner(1, 1, 0);
+          const Vector3 v101 = corner(1, 0, 1);
+          const Vector3 v011 = corner(0, 1, 1);
+          const Vector3 v111 = corner(1, 1, 1);
+
+          auto& coefficients = m_cells[cellIndex({{i, j, k}})].coefficients;
+          coefficients.col(0) = v000;
+          coefficients.col(1) = v100 - v000;
+          coefficients.col(2) = v010 - v000;
+          coefficients.col(3) = v001 - v000;
+          coefficients.col(4) = v110 - v100 - v010 + v000;
+          coefficients.col(5) = v101 - v100 - v001 + v000;
+          coefficients.col(6) = v011 - v010 - v001 + v000;
+          coefficients.col(7) =
+              v111 - v110 - v101 - v011 + v100 + v010 + v001 - v000;
+        }
+      }
+    }
+  }
+
+  /// @brief Find the cell containing a position
+  ///
+  /// @param [in] gridPosition position in grid coordinates
+  /// @param [out] fraction position within the cell, in [0,1] per axis
+  /// @return the cell containing @p gridPosition
+  ///
+  /// @pre @p gridPosition must be inside the grid
+  const Cell& cell(const Vector3& gridPosition, Vector3& fraction) const {
+    std::array<std::size_t, 3> bin{};
+    for (std::size_t d = 0; d < 3; ++d) {
+      const double t = (gridPosition[d] - m_min[d]) * m_invWidth[d];
+      bin[d] = std::min(static_cast<std::size_t>(t), m_nBins[d] - 1);
+      fraction[d] = t - bin[d];
+    }
+    return m_cells[cellIndex(bin)];
+  }
+
+  /// @brief Evaluate the field within a cell
+  ///
+  /// @param [in] cell the cell returned by @c cell
+  /// @param [in] fraction the position within the cell
+  static Vector3 field(const Cell& cell, const Vector3& fraction) {
+    const double u = fraction[0];
+    const double v = fraction[1];
+    const double w = fraction[2];
+    ActsVector<8> monomials;
+    monomials << 1., u, v, w, u * v, u * w, v * w, u * v * w;
+    return cell.coefficients * monomials;
+  }
+
+  /// @brief Evaluate the gradient of the field within a cell
+  ///
+  /// @param [in] cell the cell returned by @c cell
+  /// @param [in] fraction the position within the cell
+  /// @return derivatives of the field components (rows) with respect to the
+  ///         grid coordinates (columns)
+  ActsMatrix<3, 3> gradient(const Cell& cell, const Vector3& fraction) const {
+    const double u = fraction[0];
+    const double v = fraction[1];
+    const double w = fraction[2];
+    ActsMatrix<8, 3> derivatives;
+    // clang-format off
+    derivatives << 0., 0., 0.,
+                   1., 0., 0.,
+                   0., 1., 0.,
+                   0., 0., 1.,
+                   v,  u,  0.,
+                   w,  0., u,
+                   0., w,  v,
+                   v * w, u * w, u * v;
+    // clang-format on
+    ActsMatrix<3, 3> gradient = cell.coefficients * derivatives;
+    for (std::size_t d = 0; d < 3; ++d) {
+      gradient.col(d) *= m_invWidth[d];
+    }
+    return gradient;
+  }
+
+ private:
+  std::size_t cellIndex(const std::array<std::size_t, 3>& bin) const {
+    const std::size_t brick =
+        ((bin[0] >> 2) * m_nBricks[1] + (bin[1] >> 2)) * m_nBricks[2] +
+        (bin[2] >> 2);
+    // interleave the two low bits of the three indices
+    const std::size_t x = bin[0] & 3;
+    const std::size_t y = bin[1] & 3;
+    const std::size_t z = bin[2] & 3;
+    const std::size_t morton = (x & 1) | ((y & 1) << 1) | ((z & 1) << 2) |
+                               ((x & 2) << 2) | ((y & 2) << 3) |
+                               ((z & 2) << 4);
+    return brick * 64 + morton;
+  }
+
+  std::array<double, 3> m_min{};
+  std::array<double, 3> m_invWidth{};
+  std::array<std::size_t, 3> m_nBins{};
+  std::array<std::size_t, 3> m_nBricks{};
+  std::vector<Cell> m_cells;
+};
+
+}  // namespace detail
+
+}  // namespace Acts
@@ -17,19 +17,24 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/DefaultExtension.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Utilities/GaussianMixtureReduction.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Result.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <limits>
 #include <numeric>
 #include <sstream>
+#include <system_error>
+#include <type_traits>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -173,11 +178,16 @@ struct MaxMomentumReducerLoop {
 
 /// @brief Stepper based on the EigenStepper, but handles Multi-Component Tracks
 /// (e.g., for the GSF). Internally, this only manages a vector of
-/// EigenStepper::States. This simplifies implementation, but has several
-/// drawbacks:
-/// * There are certain redundancies between the global State and the component
-/// states
-/// * The components do not share a single magnetic-field-cache
+/// EigenStepper::States. This simplifies implementation, but there are certain
+/// redundancies between the global State and the component states.
+///
+/// With the default extension, the components are stepped in lock-step in
+/// groups of up to s_lockStepLanes unless disabled on construction: the
+/// Runge-Kutta stages run across the components of a group as a structure of
+/// arrays, and the magnetic field of a group is looked up with a single
+/// MagneticFieldProvider::getFields call on the field cache of the first
+/// component. The results are identical to stepping every component with the
+/// EigenStepper. Other extensions step the components one after the other.
 /// @tparam extensionlist_t See EigenStepper for details
 /// @tparam component_reducer_t How to map the multi-component state to a single
 /// component
@@ -205,6 +215,17 @@ class MultiEigenStepperLoop
   template <typename T>
   using SmallVector = boost::container::small_vector<T, 16>;
 
+  /// Whether the components can be stepped in lock-step, which implements the
+  /// equations of the default extension
+  static constexpr bool s_lockStepAvailable =
+      std::is_same_v<extensionlist_t, StepperExtensionList<DefaultExtension>>;
+
+  /// Whether the components are stepped in lock-step if available
+  bool m_lockStep = true;
+
+  /// Number of components stepped in lock-step
+  static constexpr std::size_t s_lockStepLanes = 8;
+
  public:
   /// @brief Typedef to the Single-Component Eigen Stepper
   using SingleStepper = EigenStepper<extensionlist_t, auctioneer_t>;
@@ -225,14 +246,19 @@ class MultiEigenStepperLoop
   static constexpr int maxComponents = std::numeric_limits<int>::max();
 
   /// Constructor from a magnetic field and a optionally provided Logger
+  ///
+  /// @param lockStep Whether to step the components in lock-step with the
+  ///        default extension, otherwise they are stepped one after the other
   MultiEigenStepperLoop(std::shared_ptr<const MagneticFieldProvider> bField,
                         MixtureReductionMethod finalReductionMethod =
                             MixtureReductionMethod::eMean,
                         std::unique_ptr<const Logger> logger =
-                            getDefaultLogger("GSF", Logging::INFO))
+                            getDefaultLogger("GSF", Logging::INFO),
+                        bool lockStep = true)
       : EigenStepper<extensionlist_t, auctioneer_t>(std::move(bField)),
         m_finalReductionMethod(finalReductionMethod),
-        m_logger(std::move(logger)) {}
+        m_logger(std::move(logger)),
+        m_lockStep(lockStep) {}
 
   struct State {
     /// The struct that stores the individual components
@@ -897,6 +923,38 @@ class MultiEigenStepperLoop
   template <typename propagator_state_t, typename navigator_t>
   Result<double> step(propagator_state_t& state,
                       const navigator_t& navigator) const;
+
+ private:
+  using Lanes = std::array<double, s_lockStepLanes>;
+  using Vector3Lanes = std::array<Lanes, 3>;
+  using Mask = std::array<bool, s_lockStepLanes>;
+  using Errors = std::array<std::error_code, s_lockStepLanes>;
+
+  /// Batched field lookup on a cache shared by the components
+  struct FieldLookup {
+    MagneticFieldProvider::Cache& cache;
+    std::vector<Vector3> positions;
+    std::vector<Vector3> fields;
+  };
+
+  /// Step a group of up to s_lockStepLanes components in lock-step
+  ///
+  /// @param [in,out] state The stepping state
+  /// @param [in] options The propagator options
+  /// @param [in] indices The indices of the components in the group
+  /// @param [in] n The number of components in the group
+  /// @param [in,out] lookup The field lookup
+  /// @param [out] results The step results, indexed by component
+  template <typename options_t>
+  void stepGroup(State& state, const options_t& options,
+                 const std::size_t* indices, std::size_t n,
+                 FieldLookup& lookup,
+                 SmallVector<std::optional<Result<double>>>& results) const;
+
+  /// Look up the field at the given positions for the masked lanes
+  void getFields(FieldLookup& lookup, Mask& mask,
+                 const Vector3Lanes& positions, Vector3Lanes& fields,
+                 Errors& errors) const;
 };
 
 }  // namespace Acts
@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/Propagator/detail/LockStepRungeKutta.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
 namespace Acts {
@@ -183,46 +184,79 @@ Result<double> MultiEigenStepperLoop<E, R, A>::step(
     reweightNecessary = true;
   }
 
-  // Loop over all components and collect results in vector, write some
-  // summary information to a stringstream
-  SmallVector<std::optional<Result<double>>> results;
-  double accumulatedPathLength = 0.0;
-  std::size_t errorSteps = 0;
+  // Step all components which are not on a surface and collect the results
+  // in a vector, one entry per component
+  SmallVector<std::optional<Result<double>>> results(components.size());
+
+  bool lockStepped = false;
+  if constexpr (s_lockStepAvailable) {
+    if (m_lockStep) {
+      SmallVector<std::size_t> indices;
+      for (std::size_t i = 0; i < components.size(); ++i) {
+        if (components[i].status != Status::onSurface) {
+          indices.push_back(i);
+        }
+      }
 
-  // Type of the proxy single propagation2 state
-  using ThisSinglePropState =
-      SinglePropState<SingleState, decltype(state.navigation),
-                      decltype(state.options), decltype(state.geoContext)>;
-
-  // Lambda that performs the step for a component and returns false if the step
-  // went ok and true if there was an error
-  auto errorInStep = [&](auto& component) {
-    if (component.status == Status::onSurface) {
-      // We need to add these, so the propagation does not fail if we have only
-      // components on surfaces and failing states
-      results.emplace_back(std::nullopt);
-      return false;
+      if (not indices.empty()) {
+        FieldLookup lookup{components.front().state.fieldCache, {}, {}};
+        lookup.positions.reserve(s_lockStepLanes);
+        lookup.fields.reserve(s_lockStepLanes);
+        for (std::size_t first = 0; first < indices.size();
+             first += s_lockStepLanes) {
+          stepGroup(stepping, state.options, indices.data() + first,
+                    std::min(s_lockStepLanes, indices.size() - first), lookup,
+                    results);
+        }
+      }
+      lockStepped = true;
     }
+  }
 
-    ThisSinglePropState single_state(component.state, state.navigation,
-                                     state.options, state.geoContext);
+  if (not lockStepped) {
+    // Type of the proxy single propagation2 state
+    using ThisSinglePropState =
+        SinglePropState<SingleState, decltype(state.navigation),
+                        decltype(state.options), decltype(state.geoContext)>;
+
+    for (std::size_t i = 0; i < components.size(); ++i) {
+      // Components on a surface keep an empty result, so the propagation does
+      // not fail if we have only components on surfaces and failing states
+      if (components[i].status == Status::onSurface) {
+        continue;
+      }
 
-    results.emplace_back(SingleStepper::step(single_state, navigator));
+      ThisSinglePropState single_state(components[i].state, state.navigation,
+                                       state.options, state.geoContext);
+      results[i] = SingleStepper::step(single_state, navigator);
+    }
+  }
 
-    if (results.back()->ok()) {
-      accumulatedPathLength += component.weight * results.back()->value();
-      return false;
+  double accumulatedPathLength = 0.0;
+  std::size_t errorSteps = 0;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    auto& result = results[i];
+    if (not result) {
+      continue;
+    }
+    if (result->ok()) {
+      accumulatedPathLength += components[i].weight * result->value();
     } else {
       ++errorSteps;
-      reweightNecessary = true;
-      return true;
     }
-  };
+  }
 
-  // Loop over components and remove errorous components
-  stepping.components.erase(
-      std::remove_if(components.begin(), components.end(), errorInStep),
-      components.end());
+  // Remove errorous components
+  if (errorSteps > 0) {
+    std::size_t i = 0;
+    components.erase(std::remove_if(components.begin(), components.end(),
+                                    [&](const auto& /*cmp*/) {
+                                      const auto& result = results[i++];
+                                      return result and not result->ok();
+                                    }),
+                     components.end());
+    reweightNecessary = true;
+  }
 
   // Reweight if necessary
   if (reweightNecessary) {
@@ -263,4 +297,164 @@ Result<double> MultiEigenStepperLoop<E, R, A>::step(
   return accumulatedPathLength;
 }
 
+template <typename E, typename R, typename A>
+template <typename options_t>
+void MultiEigenStepperLoop<E, R, A>::stepGroup(
+    State& state, const options_t& options, const std::size_t* indices,
+    std::size_t n, FieldLookup& lookup,
+    SmallVector<std::optional<Result<double>>>& results) const {
+  using RungeKutta = detail::LockStepRungeKutta<s_lockStepLanes>;
+
+  std::array<SingleState*, s_lockStepLanes> cmps{};
+  std::array<std::size_t, s_lockStepLanes> nStepTrials{};
+  Mask pending{};
+  Errors errors{};
+
+  // Unused lanes keep a zero state and never move
+  RungeKutta rk;
+  for (std::size_t l = 0; l < n; ++l) {
+    cmps[l] = &state.components[indices[l]].state;
+    const FreeVector& pars = cmps[l]->pars;
+    for (std::size_t i = 0; i < 3; ++i) {
+      rk.pos[i][l] = pars[eFreePos0 + i];
+      rk.dir[i][l] = pars[eFreeDir0 + i];
+    }
+    rk.qop[l] = pars[eFreeQOverP];
+    pending[l] = true;
+  }
+
+  // First Runge-Kutta point (at current position)
+  getFields(lookup, pending, rk.pos, rk.B_first, errors);
+  rk.firstStage();
+
+  // Lanes which accepted their step keep their step size and field values,
+  // so evaluating them again in further trials reproduces their result
+  while (std::any_of(pending.begin(), pending.end(),
+                     [](bool p) { return p; })) {
+    for (std::size_t l = 0; l < n; ++l) {
+      if (pending[l]) {
+        rk.setStepSize(l, cmps[l]->stepSize.value());
+      }
+    }
+
+    getFields(lookup, pending, rk.middlePoint(), rk.B_middle, errors);
+    rk.middleStages();
+    getFields(lookup, pending, rk.lastPoint(), rk.B_last, errors);
+    rk.lastStage();
+
+    // Select and adjust the appropriate Runge-Kutta step size as given
+    // ATL-SOFT-PUB-2009-001
+    for (std::size_t l = 0; l < n; ++l) {
+      if (not pending[l]) {
+        continue;
+      }
+      if (rk.errorEstimate[l] <= options.tolerance) {
+        pending[l] = false;
+        continue;
+      }
+
+      auto& stepSize = cmps[l]->stepSize;
+      stepSize.scale(RungeKutta::stepSizeScaling(options.tolerance,
+                                                 2. * rk.errorEstimate[l]));
+
+      if (std::abs(stepSize.value()) < std::abs(options.stepSizeCutOff)) {
+        errors[l] = EigenStepperError::StepSizeStalled;
+      } else if (nStepTrials[l] > options.maxRungeKuttaStepTrials) {
+        errors[l] = EigenStepperError::StepSizeAdjustmentFailed;
+      }
+      if (errors[l]) {
+        pending[l] = false;
+      }
+      nStepTrials[l]++;
+    }
+  }
+
+  // Update the track parameters according to the equations of motion
+  Vector3Lanes pos, dir;
+  rk.advance(pos, dir);
+
+  for (std::size_t l = 0; l < n; ++l) {
+    if (errors[l]) {
+      results[indices[l]] = Result<double>::failure(errors[l]);
+      continue;
+    }
+
+    SingleState& cmp = *cmps[l];
+    const double h = rk.h[l];
+    const double dtds =
+        RungeKutta::timeDerivative(options.mass, cmp.absCharge, rk.qop[l]);
+
+    // When doing error propagation, update the associated Jacobian matrix
+    if (cmp.covTransport) {
+      rk.transportJacobian(l, options.mass, dtds, cmp.jacTransport);
+    }
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      cmp.pars[eFreePos0 + i] = pos[i][l];
+      cmp.pars[eFreeDir0 + i] = dir[i][l];
+    }
+    cmp.pars[eFreeTime] += h * dtds;
+
+    if (cmp.covTransport) {
+      cmp.derivative.template head<3>() =
+          cmp.pars.template segment<3>(eFreeDir0);
+      cmp.derivative[eFreeTime] = dtds;
+      for (std::size_t i = 0; i < 3; ++i) {
+        cmp.derivative[eFreeDir0 + i] = rk.k4[i][l];
+      }
+    }
+    cmp.pathAccumulated += h;
+    if (cmp.stepSize.currentType() == ConstrainedStep::Type::accuracy) {
+      cmp.stepSize.scale(
+          RungeKutta::stepSizeScaling(options.tolerance, rk.errorEstimate[l]));
+    }
+    cmp.stepSize.nStepTrials = nStepTrials[l];
+
+    results[indices[l]] = Result<double>::success(h);
+  }
+}
+
+template <typename E, typename R, typename A>
+void MultiEigenStepperLoop<E, R, A>::getFields(
+    FieldLookup& lookup, Mask& mask, const Vector3Lanes& positions,
+    Vector3Lanes& fields, Errors& errors) const {
+  lookup.positions.clear();
+  for (std::size_t l = 0; l < s_lockStepLanes; ++l) {
+    if (mask[l]) {
+      lookup.positions.emplace_back(positions[0][l], positions[1][l],
+                                    positions[2][l]);
+    }
+  }
+  if (lookup.positions.empty()) {
+    return;
+  }
+
+  auto res = SingleStepper::m_bField->getFields(
+      lookup.positions, lookup.fields, lookup.cache);
+  std::size_t i = 0;
+  for (std::size_t l = 0; l < s_lockStepLanes; ++l) {
+    if (not mask[l]) {
+      continue;
+    }
+    const std::size_t j = i++;
+    Vector3 field;
+    if (res.ok()) {
+      field = lookup.fields[j];
+    } else {
+      // find the lanes which fail
+      auto single = SingleStepper::m_bField->getField(lookup.positions[j],
+                                                      lookup.cache);
+      if (not single.ok()) {
+        errors[l] = single.error();
+        mask[l] = false;
+        continue;
+      }
+      field = *single;
+    }
+    fields[0][l] = field.x();
+    fields[1][l] = field.y();
+    fields[2][l] = field.z();
+  }
+}
+
 }  // namespace Acts
@@ -0,0 +1,212 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Workaround for building on clang+libstdc++
+#include "Acts/Utilities/detail/ReferenceWrapperAnyCompat.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Runge-Kutta-Nystroem stepper advancing several tracks in lock-step
+///
+/// The tracks occupy the lanes of a structure of arrays state, i.e. every
+/// free parameter is stored as an array over the tracks. A step performs the
+/// same Runge-Kutta evaluations for all lanes, so the arithmetic runs across
+/// the tracks instead of within the 3-vectors of a single track and fills
+/// the vector units. Each lane keeps its own step size control, lanes that
+/// need another trial, that are finished or that are unused are masked. The
+/// magnetic field of all lanes is looked up at once through
+/// MagneticFieldProvider::getFields with a shared cache.
+///
+/// The integration is the one of the EigenStepper with the default
+/// extension, i.e. without material effects. The transport Jacobian is
+/// accumulated separately for every lane.
+///
+/// @tparam kLanes The number of tracks stepped together
+template <std::size_t kLanes = 4>
+class MultiTrackEigenStepper {
+ public:
+  using Lanes = std::array<double, kLanes>;
+  using Vector3Lanes = std::array<Lanes, 3>;
+  using Mask = std::array<bool, kLanes>;
+  using Errors = std::array<std::error_code, kLanes>;
+  using Jacobian = BoundMatrix;
+  using Covariance = BoundSymMatrix;
+  using BoundState = std::tuple<BoundTrackParameters, Jacobian, double>;
+
+  /// Number of tracks stepped together
+  static constexpr std::size_t kNumLanes = kLanes;
+
+  /// @brief State for the lock-step propagation of up to kLanes tracks
+  struct State {
+    /// Constructor
+    ///
+    /// @param [in] gctx The geometry context
+    /// @param [in] fieldCacheIn The magnetic field cache shared by the lanes
+    State(std::reference_wrapper<const GeometryContext> gctx,
+          MagneticFieldProvider::Cache fieldCacheIn)
+        : geoContext(gctx), fieldCache(std::move(fieldCacheIn)) {
+      // unused lanes hold a valid but never moving track
+      pars[eFreeDir0].fill(1.);
+      pars[eFreeQOverP].fill(1.);
+      absCharge.fill(1.);
+    }
+
+    /// Free parameters, one array over the lanes per parameter
+    std::array<Lanes, eFreeSize> pars{};
+    /// Absolute charge of the tracks
+    Lanes absCharge{};
+    /// Propagation direction, zero for inactive lanes
+    Lanes navDir{};
+    /// Step size allowed by the integration accuracy, unsigned
+    Lanes accuracyStep{};
+    /// Distance to the target along the propagation direction
+    Lanes targetStep{};
+    /// Accumulated path length
+    Lanes pathAccumulated{};
+    /// Number of steps performed
+    std::array<unsigned int, kLanes> nSteps{};
+    /// Lanes holding a track which is propagated
+    Mask active{};
+
+    /// Covariance transport, separately for every lane
+    Mask covTransport{};
+    std::array<Covariance, kLanes> cov;
+    std::array<Jacobian, kLanes> jacobian;
+    std::array<FreeMatrix, kLanes> jacTransport;
+    std::array<FreeVector, kLanes> derivative;
+    std::array<BoundToFreeMatrix, kLanes> jacToGlobal;
+
+    /// Geometry context
+    std::reference_wrapper<const GeometryContext> geoContext;
+    /// Magnetic field cache shared by all lanes
+    MagneticFieldProvider::Cache fieldCache;
+
+    /// Buffers for the batched field lookup
+    std::vector<Vector3> fieldPositions;
+    std::vector<Vector3> fieldValues;
+  };
+
+  /// Constructor
+  ///
+  /// @param bField The magnetic field provider
+  explicit MultiTrackEigenStepper(
+      std::shared_ptr<const MagneticFieldProvider> bField)
+      : m_bField(std::move(bField)) {}
+
+  /// Create a state without any active lane
+  ///
+  /// @param [in] gctx The geometry context
+  /// @param [in] mctx The magnetic field context
+  State makeState(std::reference_wrapper<const GeometryContext> gctx,
+                  std::reference_wrapper<const MagneticFieldContext> mctx)
+      const {
+    return State{gctx, m_bField->makeCache(mctx)};
+  }
+
+  /// Load a track into a lane and activate it
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] lane The lane to use
+  /// @param [in] par The start parameters
+  /// @param [in] navDir The propagation direction
+  /// @param [in] stepSize The initial step size
+  void loadLane(State& state, std::size_t lane,
+                const BoundTrackParameters& par, Direction navDir,
+                double stepSize) const;
+
+  /// Deactivate a lane
+  void unloadLane(State& state, std::size_t lane) const {
+    state.active[lane] = false;
+    state.navDir[lane] = 0;
+  }
+
+  /// Global position of a lane
+  Vector3 position(const State& state, std::size_t lane) const {
+    return {state.pars[eFreePos0][lane], state.pars[eFreePos1][lane],
+            state.pars[eFreePos2][lane]};
+  }
+
+  /// Momentum direction of a lane
+  Vector3 direction(const State& state, std::size_t lane) const {
+    return {state.pars[eFreeDir0][lane], state.pars[eFreeDir1][lane],
+            state.pars[eFreeDir2][lane]};
+  }
+
+  /// Charge over momentum of a lane
+  double qop(const State& state, std::size_t lane) const {
+    return state.pars[eFreeQOverP][lane];
+  }
+
+  /// Free parameters of a lane
+  FreeVector parameters(const State& state, std::size_t lane) const {
+    FreeVector pars;
+    for (std::size_t i = 0; i < eFreeSize; ++i) {
+      pars[i] = state.pars[i][lane];
+    }
+    return pars;
+  }
+
+  /// Bound state of a lane at a surface
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] lane The lane
+  /// @param [in] surface The surface to bind to
+  /// @param [in] transportCov Whether to transport the covariance
+  Result<BoundState> boundState(State& state, std::size_t lane,
+                                const Surface& surface,
+                                bool transportCov = true) const;
+
+  /// Perform one Runge-Kutta step for all active lanes
+  ///
+  /// The step size of a lane is limited by its integration accuracy, its
+  /// distance to the target and the maximum step size. Lanes that fail are
+  /// deactivated and their error is stored.
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] mass The particle mass
+  /// @param [in] tolerance The integration tolerance
+  /// @param [in] stepSizeCutOff The minimal step size
+  /// @param [in] maxStepSize The maximal step size
+  /// @param [in] maxRungeKuttaStepTrials The maximal number of step trials
+  /// @param [out] errors The errors of the failed lanes
+  void step(State& state, double mass, double tolerance,
+            double stepSizeCutOff, double maxStepSize,
+            unsigned int maxRungeKuttaStepTrials, Errors& errors) const;
+
+ private:
+  /// Look up the field at the given positions for the masked lanes
+  void getFields(State& state, Mask& mask, const Vector3Lanes& positions,
+                 Vector3Lanes& fields, Errors& errors) const;
+
+  std::shared_ptr<const MagneticFieldProvider> m_bField;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/MultiTrackEigenStepper.ipp"
@@ -0,0 +1,215 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/detail/TransformationBoundToFree.hpp"
+#include "Acts/Propagator/detail/LockStepRungeKutta.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+template <std::size_t kLanes>
+void Acts::MultiTrackEigenStepper<kLanes>::loadLane(
+    State& state, std::size_t lane, const BoundTrackParameters& par,
+    Direction navDir, double stepSize) const {
+  const auto& surface = par.referenceSurface();
+  const FreeVector pars = detail::transformBoundToFreeParameters(
+      surface, state.geoContext, par.parameters());
+  for (std::size_t i = 0; i < eFreeSize; ++i) {
+    state.pars[i][lane] = pars[i];
+  }
+  state.absCharge[lane] = std::abs(par.charge());
+  state.navDir[lane] = navDir.sign();
+  state.accuracyStep[lane] = std::abs(stepSize);
+  state.targetStep[lane] = std::abs(stepSize);
+  state.pathAccumulated[lane] = 0.;
+  state.nSteps[lane] = 0;
+  state.active[lane] = true;
+
+  state.covTransport[lane] = par.covariance().has_value();
+  if (state.covTransport[lane]) {
+    state.cov[lane] = *par.covariance();
+    state.jacToGlobal[lane] = surface.boundToFreeJacobian(
+        state.geoContext, par.parameters());
+  }
+  state.jacobian[lane] = BoundMatrix::Identity();
+  state.jacTransport[lane] = FreeMatrix::Identity();
+  state.derivative[lane] = FreeVector::Zero();
+}
+
+template <std::size_t kLanes>
+auto Acts::MultiTrackEigenStepper<kLanes>::boundState(
+    State& state, std::size_t lane, const Surface& surface,
+    bool transportCov) const -> Result<BoundState> {
+  FreeVector pars = parameters(state, lane);
+  return detail::boundState(
+      state.geoContext, state.cov[lane], state.jacobian[lane],
+      state.jacTransport[lane], state.derivative[lane],
+      state.jacToGlobal[lane], pars,
+      state.covTransport[lane] && transportCov, state.pathAccumulated[lane],
+      surface);
+}
+
+template <std::size_t kLanes>
+void Acts::MultiTrackEigenStepper<kLanes>::getFields(
+    State& state, Mask& mask, const Vector3Lanes& positions,
+    Vector3Lanes& fields, Errors& errors) const {
+  state.fieldPositions.clear();
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    if (mask[l]) {
+      state.fieldPositions.emplace_back(positions[0][l], positions[1][l],
+                                        positions[2][l]);
+    }
+  }
+  if (state.fieldPositions.empty()) {
+    return;
+  }
+
+  auto res = m_bField->getFields(state.fieldPositions, state.fieldValues,
+                                 state.fieldCache);
+  std::size_t i = 0;
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    if (not mask[l]) {
+      continue;
+    }
+    const Vector3& position = state.fieldPositions[i++];
+    Vector3 field;
+    if (res.ok()) {
+      field = state.fieldValues[i - 1];
+    } else {
+      // find the lanes which fail
+      auto single = m_bField->getField(position, state.fieldCache);
+      if (not single.ok()) {
+        errors[l] = single.error();
+        mask[l] = false;
+        unloadLane(state, l);
+        continue;
+      }
+      field = *single;
+    }
+    fields[0][l] = field.x();
+    fields[1][l] = field.y();
+    fields[2][l] = field.z();
+  }
+}
+
+template <std::size_t kLanes>
+void Acts::MultiTrackEigenStepper<kLanes>::step(
+    State& state, double mass, double tolerance, double stepSizeCutOff,
+    double maxStepSize, unsigned int maxRungeKuttaStepTrials,
+    Errors& errors) const {
+  using RungeKutta = detail::LockStepRungeKutta<kLanes>;
+
+  RungeKutta rk;
+  rk.pos = {state.pars[eFreePos0], state.pars[eFreePos1],
+            state.pars[eFreePos2]};
+  rk.dir = {state.pars[eFreeDir0], state.pars[eFreeDir1],
+            state.pars[eFreeDir2]};
+  rk.qop = state.pars[eFreeQOverP];
+
+  std::array<unsigned int, kLanes> nStepTrials{};
+  Mask accuracyLimited{};
+
+  // First Runge-Kutta point (at current position)
+  Mask pending = state.active;
+  getFields(state, pending, rk.pos, rk.B_first, errors);
+  rk.firstStage();
+
+  // Lanes which accepted their step keep their step size and field values,
+  // so evaluating them again in further trials reproduces their result
+  while (std::any_of(pending.begin(), pending.end(),
+                     [](bool p) { return p; })) {
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      const double limit = std::min(state.accuracyStep[l], maxStepSize);
+      const double target = state.targetStep[l];
+      const double step =
+          target >= 0 ? std::min(limit, target) : std::max(-limit, target);
+      accuracyLimited[l] = state.accuracyStep[l] < std::abs(target) and
+                           state.accuracyStep[l] <= maxStepSize;
+      rk.setStepSize(l, state.navDir[l] * step);
+    }
+
+    getFields(state, pending, rk.middlePoint(), rk.B_middle, errors);
+    rk.middleStages();
+    getFields(state, pending, rk.lastPoint(), rk.B_last, errors);
+    rk.lastStage();
+
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      if (not pending[l]) {
+        continue;
+      }
+      if (rk.errorEstimate[l] <= tolerance) {
+        pending[l] = false;
+        continue;
+      }
+
+      state.accuracyStep[l] =
+          std::abs(rk.h[l]) *
+          RungeKutta::stepSizeScaling(tolerance, 2. * rk.errorEstimate[l]);
+
+      if (state.accuracyStep[l] < std::abs(stepSizeCutOff)) {
+        errors[l] = EigenStepperError::StepSizeStalled;
+      } else if (nStepTrials[l] > maxRungeKuttaStepTrials) {
+        errors[l] = EigenStepperError::StepSizeAdjustmentFailed;
+      }
+      if (errors[l]) {
+        pending[l] = false;
+        unloadLane(state, l);
+      }
+      nStepTrials[l]++;
+    }
+  }
+
+  // Inactive lanes have a zero step size and do not move, their time
+  // derivative is not evaluated to keep their time finite
+  Lanes dtds{};
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    if (not state.active[l]) {
+      rk.setStepSize(l, 0.);
+      dtds[l] = 1.;
+      continue;
+    }
+    dtds[l] =
+        RungeKutta::timeDerivative(mass, state.absCharge[l], rk.qop[l]);
+  }
+
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    if (state.active[l] and state.covTransport[l]) {
+      rk.transportJacobian(l, mass, dtds[l], state.jacTransport[l]);
+    }
+  }
+
+  // Update the track parameters according to the equations of motion
+  typename RungeKutta::Vector3Lanes pos, dir;
+  rk.advance(pos, dir);
+  for (std::size_t i = 0; i < 3; ++i) {
+    state.pars[eFreePos0 + i] = pos[i];
+    state.pars[eFreeDir0 + i] = dir[i];
+  }
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    state.pars[eFreeTime][l] += rk.h[l] * dtds[l];
+    state.pathAccumulated[l] += rk.h[l];
+  }
+
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    if (not state.active[l]) {
+      continue;
+    }
+    if (state.covTransport[l]) {
+      for (std::size_t i = 0; i < 3; ++i) {
+        state.derivative[l][i] = dir[i][l];
+        state.derivative[l][4 + i] = rk.k4[i][l];
+      }
+      state.derivative[l][3] = dtds[l];
+    }
+    state.nSteps[l]++;
+    if (accuracyLimited[l]) {
+      state.accuracyStep[l] *=
+          RungeKutta::stepSizeScaling(tolerance, rk.errorEstimate[l]);
+    }
+  }
+}
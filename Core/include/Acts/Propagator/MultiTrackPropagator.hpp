@@ -0,0 +1,192 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Tolerance.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/MultiTrackEigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Propagator for many tracks to a common target surface
+///
+/// The tracks are propagated in lock-step with the MultiTrackEigenStepper.
+/// Whenever a track reaches the target or fails, its lane is refilled with
+/// the next track, so that all lanes are busy until the input is exhausted.
+/// This is meant for bulk extrapolations, e.g. of all reconstructed tracks
+/// to the perigee surface at the beam line.
+///
+/// There is no navigation through the tracking geometry and thus no material
+/// interaction. The options are interpreted as for the Propagator, apart
+/// from the loop protection and the absolute pdg code which are not used.
+///
+/// @tparam kLanes The number of tracks stepped together
+template <std::size_t kLanes = 4>
+class MultiTrackPropagator {
+ public:
+  using Stepper = MultiTrackEigenStepper<kLanes>;
+
+  /// Constructor
+  ///
+  /// @param stepper The lock-step stepper
+  /// @param logger The logger instance
+  explicit MultiTrackPropagator(Stepper stepper,
+                                std::unique_ptr<const Logger> logger =
+                                    getDefaultLogger("MultiTrackPropagator",
+                                                     Logging::INFO))
+      : m_stepper(std::move(stepper)), m_logger(std::move(logger)) {}
+
+  /// Propagate tracks to a target surface
+  ///
+  /// @param [in] gctx The geometry context
+  /// @param [in] mctx The magnetic field context
+  /// @param [in] start The start parameters of the tracks
+  /// @param [in] target The target surface
+  /// @param [in] options The propagation options
+  /// @return The parameters at the target surface for each track
+  std::vector<Result<BoundTrackParameters>> propagate(
+      const GeometryContext& gctx, const MagneticFieldContext& mctx,
+      const std::vector<BoundTrackParameters>& start, const Surface& target,
+      const PropagatorPlainOptions& options) const {
+    std::vector<Result<BoundTrackParameters>> results;
+    results.reserve(start.size());
+    for (std::size_t i = 0; i < start.size(); ++i) {
+      results.push_back(PropagatorError::Failure);
+    }
+
+    auto state = m_stepper.makeState(gctx, mctx);
+    std::array<std::size_t, kLanes> trackIndices{};
+    typename Stepper::Errors errors{};
+    std::size_t next = 0;
+
+    ACTS_VERBOSE("Propagate " << start.size() << " tracks in lanes of "
+                              << kLanes);
+
+    const auto finish = [&](std::size_t lane,
+                            Result<BoundTrackParameters> res) {
+      results[trackIndices[lane]] = std::move(res);
+      m_stepper.unloadLane(state, lane);
+    };
+
+    // check whether the track in a lane is finished
+    const auto isFinished = [&](std::size_t lane) {
+      if (updateTargetStatus(state, lane, target, options)) {
+        auto res = m_stepper.boundState(state, lane, target);
+        if (res.ok()) {
+          finish(lane, std::get<BoundTrackParameters>(*res));
+        } else {
+          finish(lane, res.error());
+        }
+      } else if (not state.active[lane]) {
+        // target is not reachable
+        finish(lane, PropagatorError::Failure);
+      } else if (state.nSteps[lane] >= options.maxSteps) {
+        finish(lane, PropagatorError::StepCountLimitReached);
+      }
+      return not state.active[lane];
+    };
+
+    while (true) {
+      bool anyActive = false;
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        if (errors[l]) {
+          ACTS_DEBUG("Propagation of track " << trackIndices[l]
+                                             << " failed: " << errors[l]);
+          results[trackIndices[l]] = errors[l];
+          errors[l] = std::error_code{};
+        }
+        // refill the lane until it holds a track which needs to be stepped
+        while (not state.active[l] or isFinished(l)) {
+          if (next == start.size()) {
+            break;
+          }
+          trackIndices[l] = next;
+          m_stepper.loadLane(state, l, start[next], options.direction,
+                             options.direction * options.maxStepSize);
+          ++next;
+        }
+
+        anyActive = anyActive or state.active[l];
+      }
+
+      if (not anyActive) {
+        break;
+      }
+
+      m_stepper.step(state, options.mass, options.tolerance,
+                     options.stepSizeCutOff, options.maxStepSize,
+                     options.maxRungeKuttaStepTrials, errors);
+    }
+
+    return results;
+  }
+
+ private:
+  /// Update the distance of a lane to the target
+  ///
+  /// @return whether the lane is on the target surface, a lane for which the
+  ///         target is not reachable is deactivated
+  bool updateTargetStatus(typename Stepper::State& state, std::size_t lane,
+                          const Surface& target,
+                          const PropagatorPlainOptions& options) const {
+    const double navDir = state.navDir[lane];
+    const auto sIntersection = target.intersect(
+        state.geoContext, m_stepper.position(state, lane),
+        navDir * m_stepper.direction(state, lane), false,
+        options.targetTolerance);
+
+    if (sIntersection.intersection.status ==
+        Intersection3D::Status::onSurface) {
+      return true;
+    }
+
+    const double pathLimit =
+        options.pathLimit - std::abs(state.pathAccumulated[lane]);
+    for (const auto& intersection :
+         {sIntersection.intersection, sIntersection.alternative}) {
+      if (intersection and
+          detail::checkIntersection(intersection, pathLimit, -kOverstepLimit,
+                                    options.targetTolerance, logger())) {
+        state.targetStep[lane] = intersection.pathLength;
+        return false;
+      }
+    }
+
+    ACTS_VERBOSE("Target is not reachable for lane " << lane);
+    m_stepper.unloadLane(state, lane);
+    return false;
+  }
+
+  const Logger& logger() const { return *m_logger; }
+
+  /// Allowed overstep of the target, as for the EigenStepper
+  static constexpr double kOverstepLimit = 100 * UnitConstants::um;
+
+  Stepper m_stepper;
+  std::unique_ptr<const Logger> m_logger;
+};
+
+}  // namespace Acts
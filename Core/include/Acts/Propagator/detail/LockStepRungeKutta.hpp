@@ -0,0 +1,267 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace Acts {
+namespace detail {
+
+/// @brief Runge-Kutta-Nystroem integration of several tracks in lock-step
+///
+/// The integration data of up to kLanes tracks is stored as a structure of
+/// arrays, so that every stage runs across the tracks and can be vectorized.
+/// The field lookups between the stages are left to the stepper, which can
+/// batch them. The equations are the ones of the EigenStepper with the
+/// default extension and are evaluated in the same order.
+///
+/// @tparam kLanes The number of tracks integrated together
+template <std::size_t kLanes>
+struct LockStepRungeKutta {
+  using Lanes = std::array<double, kLanes>;
+  using Vector3Lanes = std::array<Lanes, 3>;
+
+  /// Position, direction and charge over momentum at the start of the step
+  Vector3Lanes pos{};
+  Vector3Lanes dir{};
+  Lanes qop{};
+
+  /// Signed step size, its square and its half
+  Lanes h{};
+  Lanes h2{};
+  Lanes half_h{};
+
+  /// Magnetic field at the first, middle and last point of the step
+  Vector3Lanes B_first{};
+  Vector3Lanes B_middle{};
+  Vector3Lanes B_last{};
+
+  /// Runge-Kutta stages
+  Vector3Lanes k1{};
+  Vector3Lanes k2{};
+  Vector3Lanes k3{};
+  Vector3Lanes k4{};
+
+  /// Local integration error estimate of the last trial
+  Lanes errorEstimate{};
+
+  /// Set the step size of a lane, zero for lanes which do not move
+  void setStepSize(std::size_t lane, double stepSize) {
+    h[lane] = stepSize;
+    h2[lane] = stepSize * stepSize;
+    half_h[lane] = stepSize * 0.5;
+  }
+
+  /// First stage at the start position, requires B_first
+  void firstStage() { cross(dir, B_first, k1); }
+
+  /// Position of the middle stages
+  Vector3Lanes middlePoint() const {
+    Vector3Lanes out;
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        out[i][l] = pos[i][l] + half_h[l] * dir[i][l] +
+                    h2[l] * 0.125 * k1[i][l];
+      }
+    }
+    return out;
+  }
+
+  /// Second and third stage, require B_middle
+  void middleStages() {
+    Vector3Lanes tmp;
+    axpy(dir, half_h, k1, tmp);
+    cross(tmp, B_middle, k2);
+    axpy(dir, half_h, k2, tmp);
+    cross(tmp, B_middle, k3);
+  }
+
+  /// Position of the last stage
+  Vector3Lanes lastPoint() const {
+    Vector3Lanes out;
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        out[i][l] = pos[i][l] + h[l] * dir[i][l] + h2[l] * 0.5 * k3[i][l];
+      }
+    }
+    return out;
+  }
+
+  /// Last stage and local error estimate, require B_last
+  void lastStage() {
+    Vector3Lanes tmp;
+    axpy(dir, h, k3, tmp);
+    cross(tmp, B_last, k4);
+
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      double norm = 0;
+      for (std::size_t i = 0; i < 3; ++i) {
+        norm += std::abs(k1[i][l] - k2[i][l] - k3[i][l] + k4[i][l]);
+      }
+      errorEstimate[l] = std::max(h2[l] * norm, 1e-20);
+    }
+  }
+
+  /// Position and normalized direction at the end of the step
+  void advance(Vector3Lanes& position, Vector3Lanes& direction) const {
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        position[i][l] = pos[i][l] + (h[l] * dir[i][l] +
+                                      h2[l] / 6. * (k1[i][l] + k2[i][l] +
+                                                    k3[i][l]));
+        direction[i][l] =
+            dir[i][l] +
+            h[l] / 6. * (k1[i][l] + 2. * (k2[i][l] + k3[i][l]) + k4[i][l]);
+      }
+    }
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      const double norm = std::sqrt(direction[0][l] * direction[0][l] +
+                                    direction[1][l] * direction[1][l] +
+                                    direction[2][l] * direction[2][l]);
+      for (std::size_t i = 0; i < 3; ++i) {
+        direction[i][l] /= norm;
+      }
+    }
+  }
+
+  /// Apply the transport matrix of the step of a lane to a Jacobian
+  ///
+  /// The matrix is the one of the default stepper extension. It differs from
+  /// the identity only in the columns of the direction and of q/p, so only
+  /// those rows of the Jacobian are combined instead of a full product.
+  ///
+  /// @param [in] lane The lane
+  /// @param [in] mass The particle mass
+  /// @param [in] dtds The time derivative of the lane
+  /// @param [in,out] jacTransport The Jacobian to update
+  void transportJacobian(std::size_t lane, double mass, double dtds,
+                         FreeMatrix& jacTransport) const {
+    const double hl = h[lane];
+    const double half_hl = half_h[lane];
+    const double qopl = qop[lane];
+    const Vector3 d = get(dir, lane);
+    const Vector3 bFirst = get(B_first, lane);
+    const Vector3 bMiddle = get(B_middle, lane);
+    const Vector3 bLast = get(B_last, lane);
+    const Vector3 sk1 = get(k1, lane);
+    const Vector3 sk2 = get(k2, lane);
+    const Vector3 sk3 = get(k3, lane);
+
+    ActsMatrix<3, 3> dk1dT = ActsMatrix<3, 3>::Zero();
+    ActsMatrix<3, 3> dk2dT = ActsMatrix<3, 3>::Identity();
+    ActsMatrix<3, 3> dk3dT = ActsMatrix<3, 3>::Identity();
+    ActsMatrix<3, 3> dk4dT = ActsMatrix<3, 3>::Identity();
+
+    const Vector3 dk1dL = d.cross(bFirst);
+    const Vector3 dk2dL = (d + half_hl * sk1).cross(bMiddle) +
+                          qopl * half_hl * dk1dL.cross(bMiddle);
+    const Vector3 dk3dL = (d + half_hl * sk2).cross(bMiddle) +
+                          qopl * half_hl * dk2dL.cross(bMiddle);
+    const Vector3 dk4dL =
+        (d + hl * sk3).cross(bLast) + qopl * hl * dk3dL.cross(bLast);
+
+    dk1dT(0, 1) = bFirst.z();
+    dk1dT(0, 2) = -bFirst.y();
+    dk1dT(1, 0) = -bFirst.z();
+    dk1dT(1, 2) = bFirst.x();
+    dk1dT(2, 0) = bFirst.y();
+    dk1dT(2, 1) = -bFirst.x();
+    dk1dT *= qopl;
+
+    dk2dT += half_hl * dk1dT;
+    dk2dT = qopl * VectorHelpers::cross(dk2dT, bMiddle);
+
+    dk3dT += half_hl * dk2dT;
+    dk3dT = qopl * VectorHelpers::cross(dk3dT, bMiddle);
+
+    dk4dT += hl * dk3dT;
+    dk4dT = qopl * VectorHelpers::cross(dk4dT, bLast);
+
+    // derivatives of the position and of the direction w.r.t. the direction
+    // and q/p at the start of the step
+    ActsMatrix<3, 4> dF;
+    ActsMatrix<3, 4> dG;
+    auto dFdT = dF.block<3, 3>(0, 0);
+    dFdT.setIdentity();
+    dFdT += hl / 6. * (dk1dT + dk2dT + dk3dT);
+    dFdT *= hl;
+    dF.col(3) = (hl * hl) / 6. * (dk1dL + dk2dL + dk3dL);
+    dG.block<3, 3>(0, 0) = ActsMatrix<3, 3>::Identity() +
+                           hl / 6. * (dk1dT + 2. * (dk2dT + dk3dT) + dk4dT);
+    dG.col(3) = hl / 6. * (dk1dL + 2. * (dk2dL + dk3dL) + dk4dL);
+    const double dTimedL = hl * mass * mass * qopl / dtds;
+
+    // the terms are accumulated in the order of the full matrix product
+    for (std::size_t c = 0; c < eFreeSize; ++c) {
+      const double j4 = jacTransport(eFreeDir0, c);
+      const double j5 = jacTransport(eFreeDir1, c);
+      const double j6 = jacTransport(eFreeDir2, c);
+      const double j7 = jacTransport(eFreeQOverP, c);
+      for (std::size_t i = 0; i < 3; ++i) {
+        jacTransport(eFreePos0 + i, c) += dF(i, 0) * j4;
+        jacTransport(eFreePos0 + i, c) += dF(i, 1) * j5;
+        jacTransport(eFreePos0 + i, c) += dF(i, 2) * j6;
+        jacTransport(eFreePos0 + i, c) += dF(i, 3) * j7;
+        jacTransport(eFreeDir0 + i, c) =
+            dG(i, 0) * j4 + dG(i, 1) * j5 + dG(i, 2) * j6 + dG(i, 3) * j7;
+      }
+      jacTransport(eFreeTime, c) += dTimedL * j7;
+    }
+  }
+
+  /// Step size scaling for an error estimate, see ATL-SOFT-PUB-2009-001
+  static double stepSizeScaling(double tolerance, double error) {
+    return std::min(std::max(0.25f, std::sqrt(std::sqrt(static_cast<float>(
+                                        tolerance / std::abs(error))))),
+                    4.0f);
+  }
+
+  /// Time derivative dt/ds = sqrt(m^2/p^2 + c^{-2})
+  ///
+  /// Neutral tracks store q/p = 1/p, as in EigenStepper::momentum
+  static double timeDerivative(double mass, double absCharge, double qOverP) {
+    const double p = std::abs((absCharge == 0 ? 1 : absCharge) / qOverP);
+    return std::hypot(1., mass / p);
+  }
+
+ private:
+  static Vector3 get(const Vector3Lanes& v, std::size_t lane) {
+    return {v[0][lane], v[1][lane], v[2][lane]};
+  }
+
+  /// out = qop * (a x b)
+  void cross(const Vector3Lanes& a, const Vector3Lanes& b,
+             Vector3Lanes& out) const {
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      out[0][l] = qop[l] * (a[1][l] * b[2][l] - a[2][l] * b[1][l]);
+      out[1][l] = qop[l] * (a[2][l] * b[0][l] - a[0][l] * b[2][l]);
+      out[2][l] = qop[l] * (a[0][l] * b[1][l] - a[1][l] * b[0][l]);
+    }
+  }
+
+  /// out = a + f * b
+  static void axpy(const Vector3Lanes& a, const Lanes& f,
+                   const Vector3Lanes& b, Vector3Lanes& out) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        out[i][l] = a[i][l] + f[l] * b[i][l];
+      }
+    }
+  }
+};
+
+}  // namespace detail
+}  // namespace Acts
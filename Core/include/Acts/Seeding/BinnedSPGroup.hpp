@@ -84,6 +84,9 @@ class BinnedSPGroup {
  public:
   BinnedSPGroup() = delete;
 
+  // The internal space points are created in the given storage, which is
+  // reset and can be reused between events, or in a storage owned by the
+  // group if none is given. The storage has to outlive the group.
   template <typename spacepoint_iterator_t, typename callable_t>
   BinnedSPGroup(
       spacepoint_iterator_t spBegin, spacepoint_iterator_t spEnd,
@@ -94,7 +97,9 @@ class BinnedSPGroup {
       std::unique_ptr<SpacePointGrid<external_spacepoint_t>> grid,
       Acts::Extent& rRangeSPExtent,
       const SeedFinderConfig<external_spacepoint_t>& _config,
-      const SeedFinderOptions& _options);
+      const SeedFinderOptions& _options,
+      InternalSpacePointStorage<external_spacepoint_t>* spacePointStorage =
+          nullptr);
 
   BinnedSPGroup(const BinnedSPGroup&) = delete;
   BinnedSPGroup& operator=(const BinnedSPGroup&) = delete;
@@ -114,9 +119,12 @@ class BinnedSPGroup {
   }
 
  private:
-  // grid with ownership of all InternalSpacePoint
+  // grid referencing all InternalSpacePoint
   std::unique_ptr<Acts::SpacePointGrid<external_spacepoint_t>> m_grid;
 
+  // storage of the InternalSpacePoint if none is provided
+  InternalSpacePointStorage<external_spacepoint_t> m_spacePointStorage;
+
   // BinFinder must return std::vector<Acts::Seeding::Bin> with content of
   // each bin sorted in r (ascending)
   std::shared_ptr<const BinFinder<external_spacepoint_t>> m_topBinFinder;
@@ -8,6 +8,8 @@
 
 // Binned SP Group Iterator
 
+#include <iterator>
+
 #include <boost/container/flat_set.hpp>
 
 template <typename external_spacepoint_t>
@@ -124,7 +126,8 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
     std::unique_ptr<SpacePointGrid<external_spacepoint_t>> grid,
     Acts::Extent& rRangeSPExtent,
     const SeedFinderConfig<external_spacepoint_t>& config,
-    const SeedFinderOptions& options) {
+    const SeedFinderOptions& options,
+    InternalSpacePointStorage<external_spacepoint_t>* spacePointStorage) {
   if (not config.isInInternalUnits) {
     throw std::runtime_error(
         "SeedFinderConfig not in ACTS internal units in BinnedSPGroup");
@@ -156,6 +159,11 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
   // keep track of changed bins while sorting
   boost::container::flat_set<size_t> rBinsIndex;
 
+  // all space points are stored contiguously, the grid only references them
+  InternalSpacePointStorage<external_spacepoint_t>& storage =
+      spacePointStorage != nullptr ? *spacePointStorage : m_spacePointStorage;
+  storage.reset(std::distance(spBegin, spEnd));
+
   std::size_t counter = 0;
   for (spacepoint_iterator_t it = spBegin; it != spEnd; it++, ++counter) {
     if (*it == nullptr) {
@@ -180,21 +188,21 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
       continue;
     }
 
-    auto isp = std::make_unique<InternalSpacePoint<external_spacepoint_t>>(
+    InternalSpacePoint<external_spacepoint_t> isp(
         counter, sp, spPosition, options.beamPos, variance);
     // calculate r-Bin index and protect against overflow (underflow not
     // possible)
-    size_t rIndex = static_cast<size_t>(isp->radius() / config.binSizeR);
+    size_t rIndex = static_cast<size_t>(isp.radius() / config.binSizeR);
     // if index out of bounds, the SP is outside the region of interest
     if (rIndex >= numRBins) {
       continue;
     }
 
     // fill rbins into grid
-    Acts::Vector2 spLocation(isp->phi(), isp->z());
-    std::vector<std::unique_ptr<InternalSpacePoint<external_spacepoint_t>>>&
-        rbin = grid->atPosition(spLocation);
-    rbin.push_back(std::move(isp));
+    Acts::Vector2 spLocation(isp.phi(), isp.z());
+    std::vector<InternalSpacePointPtr<external_spacepoint_t>>& rbin =
+        grid->atPosition(spLocation);
+    rbin.push_back(storage.pointer(storage.emplace(isp)));
 
     // keep track of the bins we modify so that we can later sort the SPs in
     // those bins only
@@ -205,14 +213,13 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
 
   // sort SPs in R for each filled (z, phi) bin
   for (auto& binIndex : rBinsIndex) {
-    std::vector<std::unique_ptr<InternalSpacePoint<external_spacepoint_t>>>&
-        rbin = grid->atPosition(binIndex);
-    std::sort(
-        rbin.begin(), rbin.end(),
-        [](std::unique_ptr<InternalSpacePoint<external_spacepoint_t>>& a,
-           std::unique_ptr<InternalSpacePoint<external_spacepoint_t>>& b) {
-          return a->radius() < b->radius();
-        });
+    std::vector<InternalSpacePointPtr<external_spacepoint_t>>& rbin =
+        grid->atPosition(binIndex);
+    std::sort(rbin.begin(), rbin.end(),
+              [](InternalSpacePointPtr<external_spacepoint_t>& a,
+                 InternalSpacePointPtr<external_spacepoint_t>& b) {
+                return a->radius() < b->radius();
+              });
   }
 
   m_grid = std::move(grid);
@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Deleter of the internal space points referenced by the grid
+///
+/// Space points that live in an InternalSpacePointStorage are not owned by
+/// the grid and are not deleted. Space points that have been allocated
+/// individually, i.e. that are converted from a std::unique_ptr with the
+/// default deleter, are owned and deleted as usual.
+template <typename external_spacepoint_t>
+struct InternalSpacePointDeleter {
+  bool owning = false;
+
+  InternalSpacePointDeleter() = default;
+
+  InternalSpacePointDeleter(
+      std::default_delete<InternalSpacePoint<external_spacepoint_t>> /*unused*/)
+      : owning(true) {}
+
+  void operator()(InternalSpacePoint<external_spacepoint_t>* sp) const {
+    if (owning) {
+      delete sp;
+    }
+  }
+};
+
+template <typename external_spacepoint_t>
+using InternalSpacePointPtr =
+    std::unique_ptr<InternalSpacePoint<external_spacepoint_t>,
+                    InternalSpacePointDeleter<external_spacepoint_t>>;
+
+/// @brief Contiguous storage of the internal space points of one event
+///
+/// The space points are stored by value in a single buffer and are
+/// addressed by their index in the buffer. The capacity is fixed by
+/// `reset`, so that the addresses of the stored space points are stable and
+/// can be referenced by the grid. Resetting the storage keeps the allocated
+/// memory, so it can be reused for many events.
+///
+/// The storage is not thread-safe, every concurrent seeding needs its own
+/// instance.
+template <typename external_spacepoint_t>
+class InternalSpacePointStorage {
+ public:
+  using SpacePoint = InternalSpacePoint<external_spacepoint_t>;
+
+  InternalSpacePointStorage() = default;
+
+  // the grid references the stored space points by address
+  InternalSpacePointStorage(const InternalSpacePointStorage&) = delete;
+  InternalSpacePointStorage& operator=(const InternalSpacePointStorage&) =
+      delete;
+
+  InternalSpacePointStorage(InternalSpacePointStorage&&) noexcept = default;
+  InternalSpacePointStorage& operator=(InternalSpacePointStorage&&) noexcept =
+      default;
+
+  /// Remove all space points and prepare the storage for new ones
+  ///
+  /// @param capacity The maximum number of space points to be stored
+  void reset(std::size_t capacity) {
+    m_spacePoints.clear();
+    m_spacePoints.reserve(capacity);
+  }
+
+  /// Construct a space point at the end of the storage
+  ///
+  /// @param args The arguments of the InternalSpacePoint constructor
+  /// @return The index of the new space point
+  template <typename... args_t>
+  std::size_t emplace(args_t&&... args) {
+    if (m_spacePoints.size() == m_spacePoints.capacity()) {
+      throw std::length_error(
+          "InternalSpacePointStorage capacity exceeded, the stored space "
+          "points would move");
+    }
+    m_spacePoints.emplace_back(std::forward<args_t>(args)...);
+    return m_spacePoints.size() - 1;
+  }
+
+  /// Non-owning pointer to a stored space point to be filled into the grid
+  ///
+  /// @param index The index of the space point
+  InternalSpacePointPtr<external_spacepoint_t> pointer(std::size_t index) {
+    return InternalSpacePointPtr<external_spacepoint_t>(&m_spacePoints[index]);
+  }
+
+  const SpacePoint& at(std::size_t index) const { return m_spacePoints[index]; }
+
+  std::size_t size() const { return m_spacePoints.size(); }
+
+  std::size_t capacity() const { return m_spacePoints.capacity(); }
+
+ private:
+  std::vector<SpacePoint> m_spacePoints;
+};
+
+}  // namespace Acts
@@ -19,8 +19,11 @@
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/SpacePointGridSoA.hpp"
 
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <list>
 #include <map>
@@ -34,6 +37,16 @@ namespace Acts {
 
 enum class SpacePointCandidateType : short { eBottom, eTop };
 
+/// Accumulated wall time spent in the stages of the seed finding
+struct SeedFinderStageTimes {
+  // search of the middle-bottom and middle-top doublets
+  std::chrono::nanoseconds doublets{0};
+  // triplet cuts and seed weights for each middle-bottom doublet
+  std::chrono::nanoseconds triplets{0};
+  // selection of the seeds for each middle space point
+  std::chrono::nanoseconds filter{0};
+};
+
 template <typename external_spacepoint_t, typename platform_t = void*>
 class SeedFinder {
   ///////////////////////////////////////////////////////////////////
@@ -68,6 +81,9 @@ class SeedFinder {
 
     // Adding space point info
     Acts::SpacePointData spacePointData;
+
+    // compatibility flags of a batch of doublet candidates
+    std::vector<std::uint32_t> doubletMask;
   };
 
   /// The only constructor. Requires a config object.
@@ -103,6 +119,52 @@ class SeedFinder {
       const sp_range_t& topSPs,
       const Acts::Range1D<float>& rMiddleSPRange) const;
 
+  /// Create all seeds from the space points in the three iterators and
+  /// accumulate the time spent in the seeding stages.
+  /// Produces exactly the same seeds as the method without timing, which does
+  /// not contain any of the time measurements.
+  /// @param options frequently changing configuration (like beam position)
+  /// @param state State object that holds memory used
+  /// @param grid The grid with space points
+  /// @param outIt Output iterator for the seeds in the group
+  /// @param bottomSPs group of space points to be used as innermost SP in a seed.
+  /// @param middleSPs group of space points to be used as middle SP in a seed.
+  /// @param topSPs group of space points to be used as outermost SP in a seed.
+  /// @param rMiddleSPRange range object containing the minimum and maximum r for middle SP for a certain z bin.
+  /// @param stageTimes The time spent in the stages is added to it
+  template <template <typename...> typename container_t, typename sp_range_t>
+  void createSeedsForGroup(
+      const Acts::SeedFinderOptions& options, SeedingState& state,
+      const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+      std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+      const sp_range_t& bottomSPs, const std::size_t middleSPs,
+      const sp_range_t& topSPs, const Acts::Range1D<float>& rMiddleSPRange,
+      SeedFinderStageTimes& stageTimes) const;
+
+  /// Create all seeds from the space points in the three iterators using the
+  /// batched doublet search on a structure-of-arrays copy of the grid.
+  /// Produces exactly the same seeds as the method without the copy.
+  /// @param options frequently changing configuration (like beam position)
+  /// @param state State object that holds memory used
+  /// @param grid The grid with space points
+  /// @param gridSoA The space point coordinates filled from @p grid
+  /// @param outIt Output iterator for the seeds in the group
+  /// @param bottomSPs group of space points to be used as innermost SP in a seed.
+  /// @param middleSPs group of space points to be used as middle SP in a seed.
+  /// @param topSPs group of space points to be used as outermost SP in a seed.
+  /// @param rMiddleSPRange range object containing the minimum and maximum r for middle SP for a certain z bin.
+  /// @note Ranges must return pointers.
+  /// @note Ranges must be separate objects for each parallel call.
+  template <template <typename...> typename container_t, typename sp_range_t>
+  void createSeedsForGroup(
+      const Acts::SeedFinderOptions& options, SeedingState& state,
+      const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+      const Acts::SpacePointGridSoA<external_spacepoint_t>& gridSoA,
+      std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+      const sp_range_t& bottomSPs, const std::size_t middleSPs,
+      const sp_range_t& topSPs,
+      const Acts::Range1D<float>& rMiddleSPRange) const;
+
   /// @brief Compatibility method for the new-style seed finding API.
   ///
   /// This method models the old-style seeding API where we only need a
@@ -130,6 +192,21 @@ class SeedFinder {
       const sp_range_t& topSPs) const;
 
  private:
+  /// Implementation of the seed creation for one group
+  /// @tparam timeStages whether the stages are timed, compiled out otherwise
+  /// @param gridSoA optional structure-of-arrays copy of the grid, enables the batched doublet search
+  /// @param stageTimes receives the stage times, only used with @p timeStages
+  template <bool timeStages, template <typename...> typename container_t,
+            typename sp_range_t>
+  void createSeedsForGroupImpl(
+      const Acts::SeedFinderOptions& options, SeedingState& state,
+      const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+      const Acts::SpacePointGridSoA<external_spacepoint_t>* gridSoA,
+      std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+      const sp_range_t& bottomSPs, const std::size_t middleSPs,
+      const sp_range_t& topSPs, const Acts::Range1D<float>& rMiddleSPRange,
+      SeedFinderStageTimes* stageTimes) const;
+
   /// Iterates over dublets and tests the compatibility between them by applying
   /// a series of cuts that can be tested with only two SPs
   /// @param spacePointData object contaning the spacepoint data
@@ -157,6 +234,39 @@ class SeedFinder {
       const float& deltaRMinSP, const float& deltaRMaxSP, const float& uIP,
       const float& uIP2, const float& cosPhiM, const float& sinPhiM) const;
 
+  /// Batched version of getCompatibleDoublets. The cuts are evaluated as
+  /// branch-free loops over the contiguous coordinates of each neighbour bin,
+  /// which the compiler can vectorize, before the compatible candidates are
+  /// transformed to the u-v space.
+  /// @param spacePointData object contaning the spacepoint data
+  /// @param options frequently changing configuration (like beam position)
+  /// @param grid spacepoint grid
+  /// @param gridSoA structure-of-arrays copy of the spacepoint grid
+  /// @param otherSPsNeighbours inner or outer space points to be used in the dublet
+  /// @param mediumSP space point candidate to be used as middle SP in a seed
+  /// @param linCircleVec vector contining inner or outer SP parameters after reference frame transformation to the u-v space
+  /// @param outVec Output object containing top or bottom SPs that are compatible with a certain middle SPs
+  /// @param mask Scratch memory for the compatibility flags
+  /// @param deltaRMinSP minimum allowed r-distance between dublet components
+  /// @param deltaRMaxSP maximum allowed r-distance between dublet components
+  /// @param uIP minus one over radius of middle SP
+  /// @param uIP2 square of uIP
+  /// @param cosPhiM ratio between middle SP x position and radius
+  /// @param sinPhiM ratio between middle SP y position and radius
+  template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+  void getCompatibleDoubletsBatched(
+      Acts::SpacePointData& spacePointData,
+      const Acts::SeedFinderOptions& options,
+      const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+      const Acts::SpacePointGridSoA<external_spacepoint_t>& gridSoA,
+      boost::container::small_vector<Neighbour<external_spacepoint_t>, 9>&
+          otherSPsNeighbours,
+      const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+      std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+      std::vector<std::uint32_t>& mask, const float& deltaRMinSP,
+      const float& deltaRMaxSP, const float& uIP, const float& uIP2,
+      const float& cosPhiM, const float& sinPhiM) const;
+
   /// Iterates over the seed candidates tests the compatibility between three
   /// SPs and calls for the seed confirmation
   /// @param spacePointData object contaning the spacepoint data
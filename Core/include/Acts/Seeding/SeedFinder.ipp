@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
 #include <numeric>
 #include <type_traits>
 
@@ -44,6 +46,51 @@ void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     const sp_range_t& bottomSPsIdx, const std::size_t middleSPsIdx,
     const sp_range_t& topSPsIdx,
     const Acts::Range1D<float>& rMiddleSPRange) const {
+  createSeedsForGroupImpl<false>(options, state, grid, nullptr, outIt,
+                                 bottomSPsIdx, middleSPsIdx, topSPsIdx,
+                                 rMiddleSPRange, nullptr);
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <template <typename...> typename container_t, typename sp_range_t>
+void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
+    const Acts::SeedFinderOptions& options, SeedingState& state,
+    const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+    std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+    const sp_range_t& bottomSPsIdx, const std::size_t middleSPsIdx,
+    const sp_range_t& topSPsIdx, const Acts::Range1D<float>& rMiddleSPRange,
+    SeedFinderStageTimes& stageTimes) const {
+  createSeedsForGroupImpl<true>(options, state, grid, nullptr, outIt,
+                                bottomSPsIdx, middleSPsIdx, topSPsIdx,
+                                rMiddleSPRange, &stageTimes);
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <template <typename...> typename container_t, typename sp_range_t>
+void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
+    const Acts::SeedFinderOptions& options, SeedingState& state,
+    const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+    const Acts::SpacePointGridSoA<external_spacepoint_t>& gridSoA,
+    std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+    const sp_range_t& bottomSPsIdx, const std::size_t middleSPsIdx,
+    const sp_range_t& topSPsIdx,
+    const Acts::Range1D<float>& rMiddleSPRange) const {
+  createSeedsForGroupImpl<false>(options, state, grid, &gridSoA, outIt,
+                                 bottomSPsIdx, middleSPsIdx, topSPsIdx,
+                                 rMiddleSPRange, nullptr);
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <bool timeStages, template <typename...> typename container_t,
+          typename sp_range_t>
+void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroupImpl(
+    const Acts::SeedFinderOptions& options, SeedingState& state,
+    const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+    const Acts::SpacePointGridSoA<external_spacepoint_t>* gridSoA,
+    std::back_insert_iterator<container_t<Seed<external_spacepoint_t>>> outIt,
+    const sp_range_t& bottomSPsIdx, const std::size_t middleSPsIdx,
+    const sp_range_t& topSPsIdx, const Acts::Range1D<float>& rMiddleSPRange,
+    [[maybe_unused]] SeedFinderStageTimes* stageTimes) const {
   if (not options.isInInternalUnits) {
     throw std::runtime_error(
         "SeedFinderOptions not in ACTS internal units in SeedFinder");
@@ -83,6 +130,10 @@ void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
         grid, idx, middleSPs.front()->radius() + m_config.deltaRMinTopSP);
   }
 
+  // the stages are only timed if requested, otherwise this is compiled out
+  using Clock = std::chrono::steady_clock;
+  [[maybe_unused]] Clock::time_point stageStart;
+
   for (const auto& spM : middleSPs) {
     float rM = spM->radius();
 
@@ -132,11 +183,27 @@ void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     const float sinPhiM = -spM->y() * uIP;
     const float uIP2 = uIP * uIP;
 
+    if constexpr (timeStages) {
+      stageStart = Clock::now();
+    }
+
     // Iterate over middle-top dublets
-    getCompatibleDoublets<Acts::SpacePointCandidateType::eTop>(
-        state.spacePointData, options, grid, state.topNeighbours, *spM.get(),
-        state.linCircleTop, state.compatTopSP, m_config.deltaRMinTopSP,
-        m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM, sinPhiM);
+    if (gridSoA != nullptr) {
+      getCompatibleDoubletsBatched<Acts::SpacePointCandidateType::eTop>(
+          state.spacePointData, options, grid, *gridSoA, state.topNeighbours,
+          *spM.get(), state.linCircleTop, state.compatTopSP, state.doubletMask,
+          m_config.deltaRMinTopSP, m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM,
+          sinPhiM);
+    } else {
+      getCompatibleDoublets<Acts::SpacePointCandidateType::eTop>(
+          state.spacePointData, options, grid, state.topNeighbours, *spM.get(),
+          state.linCircleTop, state.compatTopSP, m_config.deltaRMinTopSP,
+          m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM, sinPhiM);
+    }
+
+    if constexpr (timeStages) {
+      stageTimes->doublets += Clock::now() - stageStart;
+    }
 
     // no top SP found -> try next spM
     if (state.compatTopSP.empty()) {
@@ -165,11 +232,30 @@ void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
       }
     }
 
+    if constexpr (timeStages) {
+      stageStart = Clock::now();
+    }
+
     // Iterate over middle-bottom dublets
-    getCompatibleDoublets<Acts::SpacePointCandidateType::eBottom>(
-        state.spacePointData, options, grid, state.bottomNeighbours, *spM.get(),
-        state.linCircleBottom, state.compatBottomSP, m_config.deltaRMinBottomSP,
-        m_config.deltaRMaxBottomSP, uIP, uIP2, cosPhiM, sinPhiM);
+    if (gridSoA != nullptr) {
+      getCompatibleDoubletsBatched<Acts::SpacePointCandidateType::eBottom>(
+          state.spacePointData, options, grid, *gridSoA, state.bottomNeighbours,
+          *spM.get(), state.linCircleBottom, state.compatBottomSP,
+          state.doubletMask, m_config.deltaRMinBottomSP,
+          m_config.deltaRMaxBottomSP, uIP, uIP2, cosPhiM, sinPhiM);
+    } else {
+      getCompatibleDoublets<Acts::SpacePointCandidateType::eBottom>(
+          state.spacePointData, options, grid, state.bottomNeighbours,
+          *spM.get(), state.linCircleBottom, state.compatBottomSP,
+          m_config.deltaRMinBottomSP, m_config.deltaRMaxBottomSP, uIP, uIP2,
+          cosPhiM, sinPhiM);
+    }
+
+    if constexpr (timeStages) {
+      const auto now = Clock::now();
+      stageTimes->doublets += now - stageStart;
+      stageStart = now;
+    }
 
     // no bottom SP found -> try next spM
     if (state.compatBottomSP.empty()) {
@@ -180,10 +266,19 @@ void SeedFinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     filterCandidates(state.spacePointData, *spM.get(), options, seedFilterState,
                      state);
 
+    if constexpr (timeStages) {
+      const auto now = Clock::now();
+      stageTimes->triplets += now - stageStart;
+      stageStart = now;
+    }
+
     m_config.seedFilter->filterSeeds_1SpFixed(
         state.spacePointData, state.candidates_collector,
         seedFilterState.numQualitySeeds, outIt);
 
+    if constexpr (timeStages) {
+      stageTimes->filter += Clock::now() - stageStart;
+    }
   }  // loop on mediums
 }
 
@@ -427,6 +522,180 @@ SeedFinder<external_spacepoint_t, platform_t>::getCompatibleDoublets(
   }
 }
 
+template <typename external_spacepoint_t, typename platform_t>
+template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+inline void
+SeedFinder<external_spacepoint_t, platform_t>::getCompatibleDoubletsBatched(
+    Acts::SpacePointData& spacePointData,
+    const Acts::SeedFinderOptions& options,
+    const Acts::SpacePointGrid<external_spacepoint_t>& grid,
+    const Acts::SpacePointGridSoA<external_spacepoint_t>& gridSoA,
+    boost::container::small_vector<Neighbour<external_spacepoint_t>, 9>&
+        otherSPsNeighbours,
+    const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+    std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+    std::vector<std::uint32_t>& mask, const float& deltaRMinSP,
+    const float& deltaRMaxSP, const float& uIP, const float& uIP2,
+    const float& cosPhiM, const float& sinPhiM) const {
+  constexpr bool isBottom =
+      candidateType == Acts::SpacePointCandidateType::eBottom;
+
+  float impactMax = m_config.impactMax;
+  if constexpr (isBottom) {
+    impactMax = -impactMax;
+  }
+
+  outVec.clear();
+  linCircleVec.clear();
+
+  // get number of neighbour SPs
+  std::size_t nsp = 0;
+  for (const auto& otherSPCol : otherSPsNeighbours) {
+    nsp += grid.at(otherSPCol.index).size();
+  }
+
+  linCircleVec.reserve(nsp);
+  outVec.reserve(nsp);
+
+  const float rM = mediumSP.radius();
+  const float xM = mediumSP.x();
+  const float yM = mediumSP.y();
+  const float zM = mediumSP.z();
+  const float varianceRM = mediumSP.varianceR();
+  const float varianceZM = mediumSP.varianceZ();
+
+  float vIPAbs = 0;
+  if (m_config.interactionPointCut) {
+    // equivalent to m_config.impactMax / (rM * rM);
+    vIPAbs = impactMax * uIP2;
+  }
+
+  const float collisionRegionMin = m_config.collisionRegionMin;
+  const float collisionRegionMax = m_config.collisionRegionMax;
+  const float cotThetaMax = m_config.cotThetaMax;
+  const float deltaZMax = m_config.deltaZMax;
+  const float minHelixDiameter2 = options.minHelixDiameter2;
+
+  for (auto& otherSPCol : otherSPsNeighbours) {
+    const auto& otherSPs = grid.at(otherSPCol.index);
+    if (otherSPs.size() == 0) {
+      continue;
+    }
+    const SpacePointBinSoA bin = gridSoA.at(otherSPCol.index);
+
+    // The space points are sorted in radius, so the candidates within the
+    // allowed r-distance form a contiguous range. It starts at the first
+    // space point that is not too far away (too close for tops) and ends at
+    // the first that is too close (too far away for tops).
+    const float* rBegin = bin.radius +
+                          std::distance(otherSPs.begin(), otherSPCol.itr);
+    const float* rEnd = bin.radius + bin.size;
+    const float* rFirst = rBegin;
+    const float* rLast = rBegin;
+    if constexpr (isBottom) {
+      rFirst = std::partition_point(
+          rBegin, rEnd, [&](float r) { return (rM - r) > deltaRMaxSP; });
+      rLast = std::partition_point(
+          rFirst, rEnd, [&](float r) { return not((rM - r) < deltaRMinSP); });
+    } else {
+      rFirst = std::partition_point(
+          rBegin, rEnd, [&](float r) { return (r - rM) < deltaRMinSP; });
+      rLast = std::partition_point(
+          rFirst, rEnd, [&](float r) { return not((r - rM) > deltaRMaxSP); });
+    }
+    const std::size_t first = rFirst - bin.radius;
+    const std::size_t last = rLast - bin.radius;
+    if (first == last) {
+      continue;
+    }
+
+    // We update the iterator in the Neighbour object to the first space point
+    // in the allowed r-distance
+    otherSPCol.itr = otherSPs.begin() + first;
+
+    const std::size_t n = last - first;
+    const float* xs = bin.x + first;
+    const float* ys = bin.y + first;
+    const float* zs = bin.z + first;
+    const float* rs = bin.radius + first;
+    mask.resize(n);
+    std::uint32_t* pass = mask.data();
+
+    // Evaluate the cheap cuts for the whole batch without branches. The
+    // expressions are identical to the ones in getCompatibleDoublets to
+    // guarantee the same selection.
+    const bool noDeltaZCut = m_config.interactionPointCut;
+    for (std::size_t i = 0; i < n; ++i) {
+      const float deltaR = isBottom ? (rM - rs[i]) : (rs[i] - rM);
+      const float deltaZ = isBottom ? (zM - zs[i]) : (zs[i] - zM);
+      const float zOriginTimesDeltaR = (zM * deltaR - rM * deltaZ);
+      const bool inCollisionRegion =
+          not(zOriginTimesDeltaR < collisionRegionMin * deltaR) &
+          not(zOriginTimesDeltaR > collisionRegionMax * deltaR);
+      const bool inCotTheta = not(deltaZ > cotThetaMax * deltaR) &
+                              not(deltaZ < -cotThetaMax * deltaR);
+      const bool inDeltaZ =
+          noDeltaZCut | (not(deltaZ > deltaZMax) & not(deltaZ < -deltaZMax));
+      pass[i] = inCollisionRegion & inCotTheta & inDeltaZ;
+    }
+
+    // transform the remaining candidates to the u-v space
+    for (std::size_t i = 0; i < n; ++i) {
+      if (pass[i] == 0) {
+        continue;
+      }
+      const auto& otherSP = otherSPs[first + i];
+
+      const float deltaZ = isBottom ? (zM - zs[i]) : (zs[i] - zM);
+      const float deltaX = xs[i] - xM;
+      const float deltaY = ys[i] - yM;
+
+      const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
+      const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
+
+      const float deltaR2 = (deltaX * deltaX + deltaY * deltaY);
+      const float iDeltaR2 = 1. / deltaR2;
+
+      const float uT = xNewFrame * iDeltaR2;
+      const float vT = yNewFrame * iDeltaR2;
+
+      if (m_config.interactionPointCut and
+          not(std::abs(rM * yNewFrame) <= impactMax * xNewFrame)) {
+        // in the rotated frame the interaction point is positioned at x = -rM
+        // and y ~= impactParam
+        const float vIP = (yNewFrame > 0.) ? -vIPAbs : vIPAbs;
+
+        // we can obtain aCoef as the slope dv/du of the linear function,
+        // estimated using du and dv between the two SP bCoef is obtained by
+        // inserting aCoef into the linear equation
+        const float aCoef = (vT - vIP) / (uT - uIP);
+        const float bCoef = vIP - aCoef * uIP;
+        // the distance of the straight line from the origin (radius of the
+        // circle) is related to aCoef and bCoef by d^2 = bCoef^2 / (1 +
+        // aCoef^2) = 1 / (radius^2) and we can apply the cut on the curvature
+        if ((bCoef * bCoef) * minHelixDiameter2 > (1 + aCoef * aCoef)) {
+          continue;
+        }
+      }
+
+      const float iDeltaR = std::sqrt(iDeltaR2);
+      const float cotTheta = deltaZ * iDeltaR;
+
+      const float Er =
+          ((varianceZM + bin.varianceZ[first + i]) +
+           (cotTheta * cotTheta) * (varianceRM + bin.varianceR[first + i])) *
+          iDeltaR2;
+
+      // fill output vectors
+      linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
+                                yNewFrame);
+      spacePointData.setDeltaR(otherSP->index(),
+                               std::sqrt(deltaR2 + (deltaZ * deltaZ)));
+      outVec.emplace_back(otherSP.get());
+    }
+  }
+}
+
 template <typename external_spacepoint_t, typename platform_t>
 inline void SeedFinder<external_spacepoint_t, platform_t>::filterCandidates(
     Acts::SpacePointData& spacePointData,
@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts {
+
+/// @brief View on the coordinates of the space points in one grid bin
+///
+/// All arrays have `size` elements and are ordered like the space points in
+/// the corresponding bin of the SpacePointGrid, i.e. sorted in radius.
+struct SpacePointBinSoA {
+  const float* x = nullptr;
+  const float* y = nullptr;
+  const float* z = nullptr;
+  const float* radius = nullptr;
+  const float* phi = nullptr;
+  const float* varianceR = nullptr;
+  const float* varianceZ = nullptr;
+  std::size_t size = 0;
+};
+
+/// @brief Structure-of-arrays copy of the space points in a SpacePointGrid
+///
+/// The coordinates of all space points are stored in contiguous arrays, with
+/// the space points of each grid bin forming one contiguous slice. This
+/// allows the doublet search in the SeedFinder to process the candidates of
+/// a bin in batches without chasing the pointers stored in the grid.
+///
+/// The store has to be filled after the grid content has been sorted in
+/// radius, e.g. after the BinnedSPGroup has been created, and it has to be
+/// refilled whenever the grid changes. The buffers are retained when the
+/// store is refilled, so that it can be reused for many events.
+template <typename external_spacepoint_t>
+class SpacePointGridSoA {
+ public:
+  SpacePointGridSoA() = default;
+
+  /// Create the store and fill it from the given grid
+  ///
+  /// @param grid The space point grid with bins sorted in radius
+  explicit SpacePointGridSoA(
+      const Acts::SpacePointGrid<external_spacepoint_t>& grid) {
+    fill(grid);
+  }
+
+  /// Copy the space point coordinates from the grid
+  ///
+  /// @param grid The space point grid with bins sorted in radius
+  void fill(const Acts::SpacePointGrid<external_spacepoint_t>& grid);
+
+  /// Access the coordinates of the space points in one bin
+  ///
+  /// @param globalBin The global bin index in the grid
+  SpacePointBinSoA at(std::size_t globalBin) const {
+    const std::size_t begin = m_offsets[globalBin];
+    SpacePointBinSoA bin;
+    bin.x = m_x.data() + begin;
+    bin.y = m_y.data() + begin;
+    bin.z = m_z.data() + begin;
+    bin.radius = m_radius.data() + begin;
+    bin.phi = m_phi.data() + begin;
+    bin.varianceR = m_varianceR.data() + begin;
+    bin.varianceZ = m_varianceZ.data() + begin;
+    bin.size = m_offsets[globalBin + 1] - begin;
+    return bin;
+  }
+
+  /// Number of grid bins
+  std::size_t size() const {
+    return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+  }
+
+ private:
+  /// Offset of the first space point of each bin, and total size at the end
+  std::vector<std::size_t> m_offsets;
+
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+  std::vector<float> m_z;
+  std::vector<float> m_radius;
+  std::vector<float> m_phi;
+  std::vector<float> m_varianceR;
+  std::vector<float> m_varianceZ;
+};
+
+template <typename external_spacepoint_t>
+void SpacePointGridSoA<external_spacepoint_t>::fill(
+    const Acts::SpacePointGrid<external_spacepoint_t>& grid) {
+  const std::size_t nBins = grid.size();
+  m_offsets.clear();
+  m_offsets.reserve(nBins + 1);
+
+  std::size_t nSpacePoints = 0;
+  for (std::size_t globalBin = 0; globalBin < nBins; ++globalBin) {
+    m_offsets.push_back(nSpacePoints);
+    nSpacePoints += grid.at(globalBin).size();
+  }
+  m_offsets.push_back(nSpacePoints);
+
+  m_x.resize(nSpacePoints);
+  m_y.resize(nSpacePoints);
+  m_z.resize(nSpacePoints);
+  m_radius.resize(nSpacePoints);
+  m_phi.resize(nSpacePoints);
+  m_varianceR.resize(nSpacePoints);
+  m_varianceZ.resize(nSpacePoints);
+
+  for (std::size_t globalBin = 0; globalBin < nBins; ++globalBin) {
+    std::size_t i = m_offsets[globalBin];
+    for (const auto& sp : grid.at(globalBin)) {
+      m_x[i] = sp->x();
+      m_y[i] = sp->y();
+      m_z[i] = sp->z();
+      m_radius[i] = sp->radius();
+      m_phi[i] = sp->phi();
+      m_varianceR[i] = sp->varianceR();
+      m_varianceZ[i] = sp->varianceZ();
+      ++i;
+    }
+  }
+}
+
+}  // namespace Acts
@@ -12,11 +12,20 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/ThrowAssert.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
 #include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace Acts {
@@ -79,6 +88,26 @@ class SurfaceArray {
     /// @return @c SurfaceVector at given bin. Copy of all bins selected
     virtual const SurfaceVector& neighbors(const Vector3& position) const = 0;
 
+    /// @brief Returns the neighbors of a global bin, including its content
+    /// @param bin Global lookup bin
+    /// @return @c SurfaceVector of the bin and its neighbors
+    /// @note Optional, needed for the surface candidate cache of a layer. The
+    ///       default implementation throws.
+    virtual const SurfaceVector& neighbors(size_t bin) const {
+      (void)bin;
+      throw std::logic_error("Bin neighbors are not supported by the lookup");
+    }
+
+    /// @brief Returns the global bin index at @c pos
+    /// @param position Lookup position
+    /// @return the global bin index
+    /// @note Optional, needed for the surface candidate cache of a layer. The
+    ///       default implementation throws.
+    virtual size_t globalBinFromPosition(const Vector3& position) const {
+      (void)position;
+      throw std::logic_error("Global bins are not supported by the lookup");
+    }
+
     /// @brief Returns the total size of the grid (including under/overflow
     /// bins)
     /// @return Size of the grid data structure
@@ -249,6 +278,20 @@ class SurfaceArray {
       return m_neighborMap.at(m_grid.globalBinFromPosition(lposition));
     }
 
+    /// @brief Returns the neighbors of a global bin, including its content
+    /// @param bin Global lookup bin
+    /// @return @c SurfaceVector of the bin and its neighbors
+    const SurfaceVector& neighbors(size_t bin) const override {
+      return m_neighborMap.at(bin);
+    }
+
+    /// @brief Returns the global bin index at @c pos
+    /// @param position Lookup position
+    /// @return the global bin index
+    size_t globalBinFromPosition(const Vector3& position) const override {
+      return m_grid.globalBinFromPosition(m_globalToLocal(position));
+    }
+
     /// @brief Returns the total size of the grid (including under/overflow
     /// bins)
     /// @return Size of the grid data structure
@@ -396,6 +439,22 @@ class SurfaceArray {
       return m_element;
     }
 
+    /// @brief Lookup, always returns @c element
+    /// @param bin is ignored
+    /// @return reference to vector containing only @c element
+    const SurfaceVector& neighbors(size_t bin) const override {
+      (void)bin;
+      return m_element;
+    }
+
+    /// @brief The only bin
+    /// @param position is ignored
+    /// @return 0
+    size_t globalBinFromPosition(const Vector3& position) const override {
+      (void)position;
+      return 0;
+    }
+
     /// @brief returns 1
     /// @return 1
     size_t size() const override { return 1; }
@@ -440,6 +499,157 @@ class SurfaceArray {
     SurfaceVector m_element;
   };
 
+  /// @brief The local coordinates of the grid lookups, as built by the
+  /// @c SurfaceArrayCreator from the position in the array frame
+  enum class LookupCoordinates {
+    eCylinder,  ///< (phi, z)
+    eDisc,      ///< (r, phi)
+    ePlane      ///< (x, y)
+  };
+
+  /// @brief Contiguous range of surfaces returned by the flat lookup
+  struct SurfaceRange {
+    const Surface* const* first = nullptr;
+    const Surface* const* last = nullptr;
+
+    const Surface* const* begin() const { return first; }
+    const Surface* const* end() const { return last; }
+    size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+  };
+
+  /// @brief Neighbors of all bins of a filled grid lookup in a flat layout
+  ///
+  /// The merged neighborhood of every global bin is stored without duplicates
+  /// in one array with offsets per bin. The table is shared between the flat
+  /// lookup and the surface candidate cache of a layer.
+  class NeighborTable {
+   public:
+    /// @brief Constructor from a filled grid lookup
+    /// @param gridLookup The grid lookup to copy the neighbors from
+    explicit NeighborTable(const ISurfaceGridLookup& gridLookup);
+
+    /// @brief The unique neighbors of a bin, including its content
+    /// @param bin Global lookup bin
+    /// @return @c SurfaceRange of the bin and its neighbors
+    SurfaceRange neighbors(size_t bin) const {
+      return {m_surfaces.data() + m_offsets[bin],
+              m_surfaces.data() + m_offsets[bin + 1]};
+    }
+
+    /// @brief Position of the first neighbor of a bin in @c surfaces()
+    /// @param bin Global lookup bin, or the number of bins for the end
+    size_t offset(size_t bin) const { return m_offsets.at(bin); }
+
+    /// @brief The neighbors of all bins
+    const SurfaceVector& surfaces() const { return m_surfaces; }
+
+    /// @brief The number of bins
+    size_t size() const { return m_offsets.size() - 1; }
+
+   private:
+    /// Start of the neighbors of every global bin, and the end of the last
+    std::vector<size_t> m_offsets;
+    /// The neighbors of all bins
+    SurfaceVector m_surfaces;
+  };
+
+  /// @brief Flat copy of the neighbor lookup of a filled two dimensional grid
+  /// lookup
+  ///
+  /// A lookup touches two offsets and one contiguous block of surfaces of the
+  /// @c NeighborTable. The axes and the local coordinates are evaluated
+  /// directly, without virtual or type-erased calls.
+  class FlatSurfaceGridLookup {
+   public:
+    /// @brief Constructor from a filled grid lookup
+    /// @param gridLookup The grid lookup with two axes to copy
+    /// @param transform The transform into the frame of the array
+    /// @param coordinates The local coordinates of the grid lookup
+    FlatSurfaceGridLookup(const ISurfaceGridLookup& gridLookup,
+                          const Transform3& transform,
+                          LookupCoordinates coordinates);
+
+    /// @brief The global bin at @p position, identical to the grid lookup
+    /// @param position Lookup position
+    /// @return the global bin index
+    size_t globalBinFromPosition(const Vector3& position) const {
+      const Vector3 loc = m_transform * position;
+      ActsScalar local0 = 0.;
+      ActsScalar local1 = 0.;
+      switch (m_coordinates) {
+        case LookupCoordinates::eCylinder:
+          local0 = VectorHelpers::phi(loc);
+          local1 = loc.z();
+          break;
+        case LookupCoordinates::eDisc:
+          local0 = VectorHelpers::perp(loc);
+          local1 = VectorHelpers::phi(loc);
+          break;
+        case LookupCoordinates::ePlane:
+          local0 = loc.x();
+          local1 = loc.y();
+          break;
+      }
+      // same ordering as the grid, the last axis runs fastest
+      const size_t bin0 = std::visit(
+          [local0](const auto& axis) { return axis.getBin(local0); },
+          m_axes[0]);
+      const size_t bin1 = std::visit(
+          [local1](const auto& axis) { return axis.getBin(local1); },
+          m_axes[1]);
+      return bin0 * m_stride + bin1;
+    }
+
+    /// @brief The unique neighbors of a bin, including its content
+    /// @param bin Global lookup bin
+    /// @return @c SurfaceRange of the bin and its neighbors
+    SurfaceRange neighbors(size_t bin) const {
+      return m_neighbors->neighbors(bin);
+    }
+
+    /// @brief The unique neighbors of the bin at @p position
+    /// @param position Lookup position
+    /// @return @c SurfaceRange of the bin and its neighbors
+    SurfaceRange neighbors(const Vector3& position) const {
+      return neighbors(globalBinFromPosition(position));
+    }
+
+    /// @brief The table of the neighbors of all bins
+    const std::shared_ptr<const NeighborTable>& neighborTable() const {
+      return m_neighbors;
+    }
+
+   private:
+    /// Any of the axis types the grid lookups are built from
+    using AnyAxis = std::variant<
+        detail::Axis<detail::AxisType::Equidistant,
+                     detail::AxisBoundaryType::Open>,
+        detail::Axis<detail::AxisType::Equidistant,
+                     detail::AxisBoundaryType::Bound>,
+        detail::Axis<detail::AxisType::Equidistant,
+                     detail::AxisBoundaryType::Closed>,
+        detail::Axis<detail::AxisType::Variable,
+                     detail::AxisBoundaryType::Open>,
+        detail::Axis<detail::AxisType::Variable,
+                     detail::AxisBoundaryType::Bound>,
+        detail::Axis<detail::AxisType::Variable,
+                     detail::AxisBoundaryType::Closed>>;
+
+    /// Copy of an axis with its concrete type
+    static AnyAxis makeAxis(const IAxis& axis);
+    /// Copies of the two axes of a grid, throws for any other dimension
+    static std::array<AnyAxis, 2> makeAxes(
+        const std::vector<const IAxis*>& axes);
+
+    std::array<AnyAxis, 2> m_axes;
+    /// Number of global bins per bin of the first axis
+    size_t m_stride = 0;
+    Transform3 m_transform;
+    LookupCoordinates m_coordinates;
+    std::shared_ptr<const NeighborTable> m_neighbors;
+  };
+
   /// @brief Default constructor which takes a @c SurfaceLookup and a vector of
   /// surfaces
   /// @param gridLookup The grid storage. @c SurfaceArray does not fill it on
@@ -492,6 +702,59 @@ class SurfaceArray {
     return p_gridLookup->neighbors(position);
   }
 
+  /// @brief Get the unique surfaces in bin at @p pos and its neighbors
+  /// @param position The position to lookup as nominal
+  /// @return @c SurfaceRange of neighbors and nominal
+  /// @note Uses the flat lookup if it has been built, the grid lookup
+  ///       otherwise. Only the flat lookup removes duplicates.
+  SurfaceRange neighborRange(const Vector3& position) const {
+    if (m_flat) {
+      return m_flat->neighbors(position);
+    }
+    const SurfaceVector& neighbors = p_gridLookup->neighbors(position);
+    return {neighbors.data(), neighbors.data() + neighbors.size()};
+  }
+
+  /// @brief Build the flat neighbor lookup from the filled grid lookup
+  ///
+  /// The local coordinates are derived from the binning values of the grid
+  /// lookup: (phi, z) on a cylinder, (r, phi) on a disc and the local x and y
+  /// of a plane otherwise.
+  ///
+  /// @note The flat lookup is a copy, later changes to the grid are not
+  ///       reflected. Only grid lookups with two axes are supported, all
+  ///       others keep using the grid lookup.
+  /// @throw std::invalid_argument if the flat lookup does not find the
+  ///        center of every valid bin in that bin, i.e. if the grid lookup
+  ///        uses different local coordinates
+  void buildFlatLookup();
+
+  /// @brief Whether the flat neighbor lookup has been built
+  bool hasFlatLookup() const { return m_flat.has_value(); }
+
+  /// @brief The unique neighbors of all bins in a flat layout
+  /// @return The table of the flat lookup if it has been built, a new table
+  ///         built from the grid lookup otherwise
+  std::shared_ptr<const NeighborTable> neighborTable() const;
+
+  /// @brief Get all surfaces in the bin with global bin index @p bin and its
+  /// neighbors
+  /// @param bin the global bin index
+  /// @return Merged @c SurfaceVector of neighbors and nominal
+  const SurfaceVector& neighbors(size_t bin) const {
+    return p_gridLookup->neighbors(bin);
+  }
+
+  /// @brief Get the global bin index of the bin given by position
+  /// @param position the lookup position
+  /// @return the global bin index
+  size_t globalBinFromPosition(const Vector3& position) const {
+    if (m_flat) {
+      return m_flat->globalBinFromPosition(position);
+    }
+    return p_gridLookup->globalBinFromPosition(position);
+  }
+
   /// @brief Get the size of the underlying grid structure including
   /// under/overflow bins
   /// @return the size
@@ -538,6 +801,8 @@ class SurfaceArray {
 
  private:
   std::unique_ptr<ISurfaceGridLookup> p_gridLookup;
+  // optional flat copy of the neighbor lookup
+  std::optional<FlatSurfaceGridLookup> m_flat;
   // this vector makes sure we have shared ownership over the surfaces
   std::vector<std::shared_ptr<const Surface>> m_surfaces;
   // this vector is returned, so that (expensive) copying of the shared_ptr
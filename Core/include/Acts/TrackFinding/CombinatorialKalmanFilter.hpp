@@ -21,6 +21,7 @@
 #include "Acts/EventData/TrackHelpers.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
@@ -41,6 +42,7 @@
 
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
 
 namespace Acts {
@@ -203,6 +205,11 @@ struct CombinatorialKalmanFilterOptions {
 
   /// Whether to run smoothing to get fitted parameter
   bool smoothing = true;
+
+  /// Reclaim the track states of abandoned branches once their fraction of
+  /// the states created by a search exceeds this value. Only supported for
+  /// the VectorMultiTrajectory, a value of 1 disables the compaction.
+  double compactionThreshold = 1;
 };
 
 template <typename traj_t>
@@ -304,6 +311,58 @@ class CombinatorialKalmanFilter {
 
   const Logger& logger() const { return *m_logger; }
 
+  /// Reclaim the states of a search which are not part of a found track
+  ///
+  /// @param trajectory The trajectory holding the track states
+  /// @param firstState The first state created by the search
+  /// @param tips The tips of the found tracks
+  /// @param threshold The dead state fraction above which to compact
+  ///
+  /// @return The tips after the compaction
+  std::vector<MultiTrajectoryTraits::IndexType> compactTrackStates(
+      traj_t& trajectory, MultiTrajectoryTraits::IndexType firstState,
+      const std::vector<MultiTrajectoryTraits::IndexType>& tips,
+      double threshold) const {
+    if constexpr (std::is_same_v<traj_t, VectorMultiTrajectory>) {
+      const auto nStates = trajectory.size() - firstState;
+      if (threshold >= 1 or nStates == 0) {
+        return tips;
+      }
+
+      // Count the states of the search which are reachable from the tips
+      std::vector<bool> alive(nStates, false);
+      std::size_t nAlive = 0;
+      for (auto tip : tips) {
+        for (auto i = tip; i != kTrackIndexInvalid and i >= firstState and
+                           not alive[i - firstState];
+             i = trajectory.getTrackState(i).previous()) {
+          alive[i - firstState] = true;
+          ++nAlive;
+        }
+      }
+      const double deadFraction =
+          static_cast<double>(nStates - nAlive) / nStates;
+      if (deadFraction <= threshold) {
+        return tips;
+      }
+
+      ACTS_VERBOSE("Compact " << nStates << " track states with a dead fraction"
+                              << " of " << deadFraction);
+      const auto remap = trajectory.compact(tips, firstState);
+      std::vector<MultiTrajectoryTraits::IndexType> newTips;
+      newTips.reserve(tips.size());
+      for (auto tip : tips) {
+        newTips.push_back(tip < firstState ? tip : remap[tip - firstState]);
+      }
+      return newTips;
+    } else {
+      (void)trajectory;
+      (void)firstState;
+      (void)threshold;
+      return tips;
+    }
+  }
+
   /// @brief Propagator Actor plugin for the CombinatorialKalmanFilter
   ///
   /// @tparam source_link_accessor_t The type of source link accessor
@@ -1339,10 +1398,15 @@ class CombinatorialKalmanFilter {
     r.stateBuffer = stateBuffer;
     r.stateBuffer->clear();
 
+    // The states created by this search start here
+    const auto firstState = trackContainer.trackStateContainer().size();
+
     auto result = m_propagator.template propagate(
         initialParameters, propOptions, std::move(inputResult));
 
     if (!result.ok()) {
+      compactTrackStates(trackContainer.trackStateContainer(), firstState, {},
+                         tfOptions.compactionThreshold);
       ACTS_ERROR("Propapation failed: " << result.error() << " "
                                         << result.error().message()
                                         << " with the initial parameters: \n"
@@ -1374,16 +1438,24 @@ class CombinatorialKalmanFilter {
                  << combKalmanResult.result.error().message()
                  << " with the initial parameters: \n"
                  << initialParameters.parameters());
+      compactTrackStates(trackContainer.trackStateContainer(), firstState, {},
+                         tfOptions.compactionThreshold);
       return combKalmanResult.result.error();
     }
 
+    const auto tips = compactTrackStates(
+        trackContainer.trackStateContainer(), firstState,
+        combKalmanResult.lastMeasurementIndices, tfOptions.compactionThreshold);
+
     std::vector<typename TrackContainer::TrackProxy> tracks;
 
-    for (auto tip : combKalmanResult.lastMeasurementIndices) {
+    for (std::size_t i = 0; i < tips.size(); ++i) {
       auto track = trackContainer.getTrack(trackContainer.addTrack());
-      track.tipIndex() = tip;
+      track.tipIndex() = tips[i];
       const BoundTrackParameters& parameters =
-          combKalmanResult.fittedParameters.find(tip)->second;
+          combKalmanResult.fittedParameters
+              .find(combKalmanResult.lastMeasurementIndices[i])
+              ->second;
       track.parameters() = parameters.parameters();
       track.covariance() = *parameters.covariance();
       track.setReferenceSurface(parameters.referenceSurface().getSharedPtr());
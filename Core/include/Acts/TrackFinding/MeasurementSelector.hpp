@@ -19,12 +19,15 @@
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <array>
 #include <cstddef>
 #include <iterator>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Acts {
 
 /// Selection cuts for associating measurements with predicted track
@@ -106,37 +109,17 @@ class MeasurementSelector {
       return CombinatorialKalmanFilterError::MeasurementSelectionFailed;
     }
 
+    calculateChi2<traj_t>(candidates);
+
     double minChi2 = std::numeric_limits<double>::max();
     size_t minIndex = 0;
     size_t index = 0;
-    // Loop over all measurements to select the compatible measurements
-    for (auto& trackState : candidates) {
-      // Take the parameter covariance
-      // const auto predicted = tackState.predicted();
-      // const auto predictedCovariance = trackState.predictedCovariance();
-
-      double chi2 = calculateChi2(
-          // This abuses an incorrectly sized vector / matrix to access the
-          // data pointer! This works (don't use the matrix as is!), but be
-          // careful!
-          trackState
-              .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
-              .data(),
-          trackState
-              .template calibratedCovariance<
-                  MultiTrajectoryTraits::MeasurementSizeMax>()
-              .data(),
-          trackState.predicted(), trackState.predictedCovariance(),
-          trackState.projector(), trackState.calibratedSize());
-
-      trackState.chi2() = chi2;
-
-      // Search for the measurement with the min chi2
-      if (chi2 < minChi2) {
-        minChi2 = chi2;
+    // Search for the measurement with the min chi2
+    for (const auto& trackState : candidates) {
+      if (trackState.chi2() < minChi2) {
+        minChi2 = trackState.chi2();
         minIndex = index;
       }
-
       index++;
     }
 
@@ -220,6 +203,97 @@ class MeasurementSelector {
     return cuts[bin];
   }
 
+  /// Set the chi2 of all candidates
+  ///
+  /// The candidates on a surface usually share their predicted parameters,
+  /// so one and two dimensional measurements with the same projector are
+  /// grouped and their chi2 is computed in one pass with the projected
+  /// prediction evaluated only once. All other candidates are evaluated one
+  /// at a time.
+  template <typename traj_t>
+  void calculateChi2(
+      std::vector<typename traj_t::TrackStateProxy>& candidates) const {
+    // This abuses an incorrectly sized vector / matrix to access the data
+    // pointer! This works (don't use the matrix as is!), but be careful!
+    constexpr auto kMax = MultiTrajectoryTraits::MeasurementSizeMax;
+
+    auto& first = candidates.front();
+    const double* predicted = first.predicted().data();
+
+    // candidate indices of the one and two dimensional batches
+    std::array<boost::container::small_vector<std::size_t, 16>, 2> batches;
+    std::array<ProjectorBitset, 2> batchProjectors{};
+
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+      auto& trackState = candidates[i];
+      const auto size = trackState.calibratedSize();
+      if ((size == 1 or size == 2) and
+          trackState.predicted().data() == predicted) {
+        auto& batch = batches[size - 1];
+        if (batch.empty()) {
+          batchProjectors[size - 1] = trackState.projectorBitset();
+        }
+        if (trackState.projectorBitset() == batchProjectors[size - 1]) {
+          batch.push_back(i);
+          continue;
+        }
+      }
+
+      trackState.chi2() = calculateChi2(
+          trackState.template calibrated<kMax>().data(),
+          trackState.template calibratedCovariance<kMax>().data(),
+          trackState.predicted(), trackState.predictedCovariance(),
+          trackState.projector(), size);
+    }
+
+    for (unsigned int size = 1; size <= 2; ++size) {
+      const auto& batch = batches[size - 1];
+      if (batch.empty()) {
+        continue;
+      }
+      boost::container::small_vector<const double*, 16> calibrated;
+      boost::container::small_vector<const double*, 16> calibratedCovariance;
+      boost::container::small_vector<double, 16> chi2(batch.size());
+      for (std::size_t i : batch) {
+        calibrated.push_back(
+            candidates[i].template calibrated<kMax>().data());
+        calibratedCovariance.push_back(
+            candidates[i].template calibratedCovariance<kMax>().data());
+      }
+      auto& trackState = candidates[batch.front()];
+      calculateChi2Batch(size, batch.size(), calibrated.data(),
+                         calibratedCovariance.data(), trackState.predicted(),
+                         trackState.predictedCovariance(),
+                         trackState.projector(), chi2.data());
+      for (std::size_t j = 0; j < batch.size(); ++j) {
+        candidates[batch[j]].chi2() = chi2[j];
+      }
+    }
+  }
+
+  /// Compute the chi2 of one or two dimensional measurements which share
+  /// the predicted parameters and the projector
+  ///
+  /// @param calibratedSize The measurement dimension, one or two
+  /// @param n The number of measurements
+  /// @param calibrated Pointers to the calibrated measurements
+  /// @param calibratedCovariance Pointers to the measurement covariances
+  /// @param predicted The common predicted parameters
+  /// @param predictedCovariance The common predicted covariance
+  /// @param projector The common projector
+  /// @param [out] chi2 The chi2 of each measurement
+  void calculateChi2Batch(
+      unsigned int calibratedSize, std::size_t n,
+      const double* const* calibrated,
+      const double* const* calibratedCovariance,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Parameters predicted,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Covariance predictedCovariance,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Projector projector,
+      double* chi2) const;
+
   double calculateChi2(
       double* fullCalibrated, double* fullCalibratedCovariance,
       TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
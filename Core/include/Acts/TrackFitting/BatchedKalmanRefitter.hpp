@@ -0,0 +1,213 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackHelpers.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace Acts {
+
+/// Kalman filter refit of many tracks at once around their previous fit
+///
+/// The tracks must have been fitted with the @c KalmanFitter before, e.g.
+/// with a preliminary calibration. The refit keeps the track states and
+/// reuses the stored transport Jacobians, and the difference between the
+/// stored predicted covariance and the transported filtered covariance as
+/// the process noise. Thus no propagation is needed, and the tracks are
+/// refitted in lock-step: the i-th track states of all tracks are predicted
+/// together and their measurements are updated with a single call to
+/// @c GainMatrixUpdater::updateBatch.
+///
+/// This is a linearization around the previous fit and is exact if only the
+/// measurement covariances change. Changed measurement values are accurate
+/// as long as the trajectory does not move far from the previous one. The
+/// track parameters at the reference surface are not updated.
+///
+/// The type of every track state is kept, i.e. outliers are not
+/// reclassified. An outlier gets the chi2 of its measurement with respect to
+/// the refitted prediction. This differs from the @c KalmanFitter, which
+/// leaves the chi2 of outliers unset. As in the @c KalmanFitter, outliers do
+/// not contribute to the chi2 of the track.
+class BatchedKalmanRefitter {
+ public:
+  struct Config {
+    /// The updater to use for the measurement updates
+    GainMatrixUpdater updater;
+    /// The smoother to use after the filtering
+    GainMatrixSmoother smoother;
+    /// Whether to run the smoother on the refitted tracks
+    bool smoothing = true;
+  };
+
+  /// Constructor
+  ///
+  /// @param config The configuration
+  /// @param logger The logger instance
+  explicit BatchedKalmanRefitter(
+      Config config, std::unique_ptr<const Logger> logger = getDefaultLogger(
+                         "BatchedKalmanRefitter", Logging::INFO))
+      : m_cfg{config}, m_logger{std::move(logger)} {}
+
+  /// Refit tracks in place
+  ///
+  /// @param gctx The geometry context
+  /// @param tracks The track container holding the tracks
+  /// @param trackIndices The tracks to refit
+  /// @return The error of each track, which evaluates to false on success
+  template <typename track_container_t, typename traj_t,
+            template <typename> class holder_t>
+  std::vector<std::error_code> refit(
+      const GeometryContext& gctx,
+      TrackContainer<track_container_t, traj_t, holder_t>& tracks,
+      const std::vector<typename traj_t::IndexType>& trackIndices) const {
+    using TrackStateProxy = typename traj_t::TrackStateProxy;
+
+    const std::size_t nTracks = trackIndices.size();
+    std::vector<std::error_code> errors(nTracks);
+
+    // the track states of each track in filtering order
+    std::vector<std::vector<TrackStateProxy>> states(nTracks);
+    std::size_t nSteps = 0;
+    for (std::size_t i = 0; i < nTracks; ++i) {
+      for (auto trackState : tracks.getTrack(trackIndices[i]).trackStates()) {
+        states[i].push_back(trackState);
+      }
+      std::reverse(states[i].begin(), states[i].end());
+      nSteps = std::max(nSteps, states[i].size());
+    }
+    ACTS_VERBOSE("Refit " << nTracks << " tracks with up to " << nSteps
+                          << " track states");
+
+    // filtered parameters of the previous track state before the refit
+    std::vector<BoundVector> oldFiltered(nTracks);
+    std::vector<BoundSymMatrix> oldFilteredCovariance(nTracks);
+
+    std::vector<std::size_t> lanes;
+    std::vector<TrackStateProxy> measurements;
+    lanes.reserve(nTracks);
+    measurements.reserve(nTracks);
+
+    for (std::size_t step = 0; step < nSteps; ++step) {
+      lanes.clear();
+      measurements.clear();
+
+      for (std::size_t i = 0; i < nTracks; ++i) {
+        if (errors[i] or step >= states[i].size()) {
+          continue;
+        }
+        auto trackState = states[i][step];
+        const bool isMeasurement =
+            trackState.typeFlags().test(TrackStateFlag::MeasurementFlag);
+
+        BoundVector predicted = trackState.predicted();
+        BoundSymMatrix predictedCovariance = trackState.predictedCovariance();
+
+        // holes and outliers share the filtered with the predicted parameters
+        BoundVector filtered =
+            isMeasurement ? BoundVector{trackState.filtered()} : predicted;
+        BoundSymMatrix filteredCovariance =
+            isMeasurement ? BoundSymMatrix{trackState.filteredCovariance()}
+                          : predictedCovariance;
+
+        if (step > 0 and trackState.hasJacobian()) {
+          const auto previous = states[i][step - 1];
+          const BoundMatrix& jacobian = trackState.jacobian();
+          trackState.predicted() =
+              predicted +
+              jacobian * (previous.filtered() - oldFiltered[i]);
+          trackState.predictedCovariance() =
+              predictedCovariance +
+              jacobian *
+                  (previous.filteredCovariance() - oldFilteredCovariance[i]) *
+                  jacobian.transpose();
+        }
+
+        oldFiltered[i] = filtered;
+        oldFilteredCovariance[i] = filteredCovariance;
+
+        if (trackState.typeFlags().test(TrackStateFlag::OutlierFlag) and
+            trackState.hasCalibrated()) {
+          trackState.chi2() = predictedChi2(trackState);
+        }
+
+        if (isMeasurement) {
+          lanes.push_back(i);
+          measurements.push_back(trackState);
+        }
+      }
+
+      if (measurements.empty()) {
+        continue;
+      }
+
+      auto updateErrors = m_cfg.updater.template updateBatch<traj_t>(
+          gctx, measurements, Direction::Forward, logger());
+      for (std::size_t l = 0; l < lanes.size(); ++l) {
+        if (updateErrors[l]) {
+          ACTS_ERROR("Update step failed: " << updateErrors[l]);
+          errors[lanes[l]] = updateErrors[l];
+        }
+      }
+    }
+
+    for (std::size_t i = 0; i < nTracks; ++i) {
+      if (errors[i]) {
+        continue;
+      }
+      auto track = tracks.getTrack(trackIndices[i]);
+      if (m_cfg.smoothing) {
+        auto res = m_cfg.smoother(gctx, tracks.trackStateContainer(),
+                                  track.tipIndex(), logger());
+        if (not res.ok()) {
+          ACTS_ERROR("Smoothing step failed: " << res.error());
+          errors[i] = res.error();
+          continue;
+        }
+      }
+      calculateTrackQuantities(track);
+    }
+
+    return errors;
+  }
+
+ private:
+  const Logger& logger() const { return *m_logger; }
+
+  /// The chi2 of the measurement with respect to the predicted parameters
+  template <typename track_state_proxy_t>
+  static double predictedChi2(const track_state_proxy_t& trackState) {
+    const auto projector = trackState.effectiveProjector();
+    const auto residual = (trackState.effectiveCalibrated() -
+                           projector * trackState.predicted())
+                              .eval();
+    const auto covariance =
+        (trackState.effectiveCalibratedCovariance() +
+         projector * trackState.predictedCovariance() * projector.transpose())
+            .eval();
+    return (residual.transpose() * covariance.inverse() * residual).value();
+  }
+
+  Config m_cfg;
+  std::unique_ptr<const Logger> m_logger;
+};
+
+}  // namespace Acts
@@ -16,12 +16,17 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <mutex>
+#include <new>
 #include <random>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -96,6 +101,9 @@ struct BetheHeitlerApproxSingleCmp {
   }
 };
 
+template <int NComponents>
+class TabulatedBetheHeitlerApprox;
+
 /// This class approximates the Bethe-Heitler distribution as a gaussian
 /// mixture. To enable an approximation for continuous input variables, the
 /// weights, means and variances are internally parametrized as a Nth order
@@ -120,11 +128,57 @@ class AtlasBetheHeitlerApprox {
   constexpr static double higherLimit = 0.20;
 
  private:
+  using Array =
+      boost::container::static_vector<detail::GaussianComponent, NComponents>;
+
   Data m_low_data;
   Data m_high_data;
   bool m_low_transform;
   bool m_high_transform;
 
+  // The tabulated approximation evaluates the parameterizations directly
+  template <int N>
+  friend class TabulatedBetheHeitlerApprox;
+
+  /// Builds the components from the polynomials of one x/x0 range
+  static Array makeMixture(const Data &data, ActsScalar x, bool transform) {
+    // Build a polynom
+    auto poly = [](ActsScalar xx,
+                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
+      ActsScalar sum{0.};
+      for (const auto c : coeffs) {
+        sum = xx * sum + c;
+      }
+      assert((std::isfinite(sum) && "polynom result not finite"));
+      return sum;
+    };
+
+    // Value initialization should garanuee that all is initialized to zero
+    Array ret(NComponents);
+    ActsScalar weight_sum = 0;
+    for (int i = 0; i < NComponents; ++i) {
+      // These transformations must be applied to the data according to ATHENA
+      // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
+      if (transform) {
+        ret[i] = detail::inverseTransformComponent(
+            poly(x, data[i].weightCoeffs), poly(x, data[i].meanCoeffs),
+            poly(x, data[i].varCoeffs));
+      } else {
+        ret[i].weight = poly(x, data[i].weightCoeffs);
+        ret[i].mean = poly(x, data[i].meanCoeffs);
+        ret[i].var = poly(x, data[i].varCoeffs);
+      }
+
+      weight_sum += ret[i].weight;
+    }
+
+    for (int i = 0; i < NComponents; ++i) {
+      ret[i].weight /= weight_sum;
+    }
+
+    return ret;
+  }
+
  public:
   /// Construct the Bethe-Heitler approximation description. Additional to the
   /// coefficients of the polynomials, the information whether these values need
@@ -154,47 +208,6 @@ class AtlasBetheHeitlerApprox {
   ///
   /// @param x pathlength in terms of the radiation length
   auto mixture(ActsScalar x) const {
-    using Array =
-        boost::container::static_vector<detail::GaussianComponent, NComponents>;
-    // Build a polynom
-    auto poly = [](ActsScalar xx,
-                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
-      ActsScalar sum{0.};
-      for (const auto c : coeffs) {
-        sum = xx * sum + c;
-      }
-      assert((std::isfinite(sum) && "polynom result not finite"));
-      return sum;
-    };
-
-    // Lambda which builds the components
-    auto make_mixture = [&](const Data &data, double xx, bool transform) {
-      // Value initialization should garanuee that all is initialized to zero
-      Array ret(NComponents);
-      ActsScalar weight_sum = 0;
-      for (int i = 0; i < NComponents; ++i) {
-        // These transformations must be applied to the data according to ATHENA
-        // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
-        if (transform) {
-          ret[i] = detail::inverseTransformComponent(
-              poly(xx, data[i].weightCoeffs), poly(xx, data[i].meanCoeffs),
-              poly(xx, data[i].varCoeffs));
-        } else {
-          ret[i].weight = poly(xx, data[i].weightCoeffs);
-          ret[i].mean = poly(xx, data[i].meanCoeffs);
-          ret[i].var = poly(xx, data[i].varCoeffs);
-        }
-
-        weight_sum += ret[i].weight;
-      }
-
-      for (int i = 0; i < NComponents; ++i) {
-        ret[i].weight /= weight_sum;
-      }
-
-      return ret;
-    };
-
     // Return no change
     if (x < noChangeLimit) {
       Array ret(1);
@@ -213,12 +226,12 @@ class AtlasBetheHeitlerApprox {
     }
     // Return a component representation for lower x0
     if (x < lowerLimit) {
-      return make_mixture(m_low_data, x, m_low_transform);
+      return makeMixture(m_low_data, x, m_low_transform);
     }
     // Return a component representation for higher x0
     // Cap the x because beyond the parameterization goes wild
     const auto high_x = std::min(higherLimit, x);
-    return make_mixture(m_high_data, high_x, m_high_transform);
+    return makeMixture(m_high_data, high_x, m_high_transform);
   }
 
   /// Loads a parameterization from a file according to the Atlas file
@@ -277,6 +290,320 @@ class AtlasBetheHeitlerApprox {
   }
 };
 
+/// This class tabulates the mixture of an @ref AtlasBetheHeitlerApprox on
+/// equidistant x/x0 nodes in each of its two parameterization ranges, and
+/// interpolates the weights, means and variances linearly between the nodes.
+/// This avoids evaluating the polynomials and the transformations on every
+/// material interaction. Below the single gaussian limit the mixture is
+/// computed as in the @ref AtlasBetheHeitlerApprox. Because building a fine
+/// table takes some time, it can be stored in a binary cache file.
+template <int NComponents>
+class TabulatedBetheHeitlerApprox {
+  static_assert(NComponents > 0);
+
+ public:
+  // Same ranges as in the AtlasBetheHeitlerApprox
+  constexpr static double noChangeLimit = 0.0001;
+  constexpr static double singleGaussianLimit = 0.002;
+  constexpr static double lowerLimit = 0.10;
+  constexpr static double higherLimit = 0.20;
+
+  /// Default number of nodes per parameterization range
+  constexpr static std::size_t defaultNodes = 2000;
+
+ private:
+  using Array =
+      boost::container::static_vector<detail::GaussianComponent, NComponents>;
+  using Table = std::vector<detail::GaussianComponent>;
+
+  constexpr static char s_magic[8] = {'A', 'C', 'T', 'S', 'B', 'H', 'T', 'B'};
+  constexpr static std::uint32_t s_version = 1;
+
+  std::size_t m_nodes;
+  Table m_low_table;
+  Table m_high_table;
+
+  TabulatedBetheHeitlerApprox(std::size_t nodes, Table low_table,
+                              Table high_table)
+      : m_nodes(nodes),
+        m_low_table(std::move(low_table)),
+        m_high_table(std::move(high_table)) {}
+
+  /// Position of a node in the range [low, high]
+  ActsScalar node(std::size_t i, ActsScalar low, ActsScalar high) const {
+    return low + (high - low) * i / (m_nodes - 1);
+  }
+
+  template <typename make_mixture_t>
+  Table tabulate(ActsScalar low, ActsScalar high,
+                 const make_mixture_t &make_mixture) const {
+    Table table;
+    table.reserve(m_nodes * NComponents);
+    for (std::size_t i = 0; i < m_nodes; ++i) {
+      const auto cmps = make_mixture(node(i, low, high));
+      table.insert(table.end(), cmps.begin(), cmps.end());
+    }
+    return table;
+  }
+
+  /// Compares some nodes of a table to a parameterization
+  template <typename make_mixture_t>
+  bool matches(const Table &table, ActsScalar low, ActsScalar high,
+               const make_mixture_t &make_mixture) const {
+    const std::size_t nChecks = std::min<std::size_t>(8, m_nodes - 1);
+    for (std::size_t k = 0; k <= nChecks; ++k) {
+      const std::size_t i = k * (m_nodes - 1) / nChecks;
+      const auto cmps = make_mixture(node(i, low, high));
+      for (std::size_t c = 0; c < NComponents; ++c) {
+        const auto &cmp = table[i * NComponents + c];
+        if (cmp.weight != cmps[c].weight or cmp.mean != cmps[c].mean or
+            cmp.var != cmps[c].var) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  Array interpolate(const Table &table, ActsScalar low, ActsScalar high,
+                    ActsScalar x) const {
+    const ActsScalar t = (x - low) / (high - low) * (m_nodes - 1);
+    const std::size_t i = std::min(static_cast<std::size_t>(std::max(t, 0.)),
+                                   m_nodes - 2);
+    const ActsScalar f = t - i;
+
+    const auto *a = &table[i * NComponents];
+    const auto *b = a + NComponents;
+    Array ret(NComponents);
+    for (int c = 0; c < NComponents; ++c) {
+      ret[c].weight = a[c].weight + f * (b[c].weight - a[c].weight);
+      ret[c].mean = a[c].mean + f * (b[c].mean - a[c].mean);
+      ret[c].var = a[c].var + f * (b[c].var - a[c].var);
+    }
+    return ret;
+  }
+
+ public:
+  /// Tabulate a Bethe-Heitler approximation
+  ///
+  /// @param approx the polynomial parameterization
+  /// @param nodes the number of nodes per x/x0 range
+  template <int PolyDegree>
+  explicit TabulatedBetheHeitlerApprox(
+      const AtlasBetheHeitlerApprox<NComponents, PolyDegree> &approx,
+      std::size_t nodes = defaultNodes)
+      : m_nodes(nodes) {
+    if (m_nodes < 2) {
+      throw std::invalid_argument("Need at least two nodes per range");
+    }
+    m_low_table = tabulate(singleGaussianLimit, lowerLimit, [&](double x) {
+      return approx.makeMixture(approx.m_low_data, x, approx.m_low_transform);
+    });
+    m_high_table = tabulate(lowerLimit, higherLimit, [&](double x) {
+      return approx.makeMixture(approx.m_high_data, x, approx.m_high_transform);
+    });
+  }
+
+  /// Returns the number of components the returned mixture will have
+  constexpr auto numComponents() const { return NComponents; }
+
+  /// Returns the number of nodes per x/x0 range
+  std::size_t nodes() const { return m_nodes; }
+
+  /// Checks if an input is valid for the parameterization
+  ///
+  /// @param x pathlength in terms of the radiation length
+  constexpr bool validXOverX0(ActsScalar x) const { return x < higherLimit; }
+
+  /// Interpolates the mixture between the nodes. The weights sum to 1 up to
+  /// rounding, since the tabulated mixtures are normalized.
+  ///
+  /// @param x pathlength in terms of the radiation length
+  auto mixture(ActsScalar x) const {
+    // Return no change
+    if (x < noChangeLimit) {
+      Array ret(1);
+
+      ret[0].weight = 1.0;
+      ret[0].mean = 1.0;  // p_initial = p_final
+      ret[0].var = 0.0;
+
+      return ret;
+    }
+    // Return single gaussian approximation
+    if (x < singleGaussianLimit) {
+      Array ret(1);
+      ret[0] = BetheHeitlerApproxSingleCmp::mixture(x)[0];
+      return ret;
+    }
+    // Return a component representation for lower x0
+    if (x < lowerLimit) {
+      return interpolate(m_low_table, singleGaussianLimit, lowerLimit, x);
+    }
+    // Return a component representation for higher x0
+    // Cap the x because beyond the parameterization goes wild
+    const auto high_x = std::min(higherLimit, x);
+    return interpolate(m_high_table, lowerLimit, higherLimit, high_x);
+  }
+
+  /// Writes the table to a binary cache file. The file uses the native
+  /// layout and is not meant to be portable between platforms. The table is
+  /// written to a temporary file first, which is then renamed, so that
+  /// concurrent readers never see a partially written cache file.
+  ///
+  /// @param path Path of the cache file
+  void writeToFile(const std::string &path) const {
+    const std::string tmp_path =
+        path + ".tmp" + std::to_string(std::random_device{}());
+    {
+      std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+      if (!file) {
+        throw std::invalid_argument("Could not open '" + tmp_path + "'");
+      }
+
+      const std::uint32_t n_cmps = NComponents;
+      const std::uint64_t nodes = m_nodes;
+      file.write(s_magic, sizeof(s_magic));
+      file.write(reinterpret_cast<const char *>(&s_version),
+                 sizeof(s_version));
+      file.write(reinterpret_cast<const char *>(&n_cmps), sizeof(n_cmps));
+      file.write(reinterpret_cast<const char *>(&nodes), sizeof(nodes));
+      for (const auto *table : {&m_low_table, &m_high_table}) {
+        file.write(reinterpret_cast<const char *>(table->data()),
+                   table->size() * sizeof(detail::GaussianComponent));
+      }
+      file.close();
+
+      if (!file) {
+        std::remove(tmp_path.c_str());
+        throw std::invalid_argument("Could not write '" + tmp_path + "'");
+      }
+    }
+
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      std::remove(tmp_path.c_str());
+      throw std::invalid_argument("Could not rename '" + tmp_path +
+                                  "' to '" + path + "'");
+    }
+  }
+
+  /// Loads a table from a binary cache file. Some nodes of the table are
+  /// compared to the parameterization, to detect a cache file which was
+  /// built from a different one.
+  ///
+  /// @param path Path of the cache file
+  /// @param approx the polynomial parameterization the table was built from
+  template <int PolyDegree>
+  static TabulatedBetheHeitlerApprox loadFromFile(
+      const std::string &path,
+      const AtlasBetheHeitlerApprox<NComponents, PolyDegree> &approx) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw std::invalid_argument("Could not open '" + path + "'");
+    }
+
+    char magic[sizeof(s_magic)] = {};
+    std::uint32_t version = 0, n_cmps = 0;
+    std::uint64_t nodes = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&n_cmps), sizeof(n_cmps));
+    file.read(reinterpret_cast<char *>(&nodes), sizeof(nodes));
+    if (!file or !std::equal(magic, magic + sizeof(magic), s_magic) or
+        version != s_version) {
+      throw std::invalid_argument("Invalid cache file '" + path + "'");
+    }
+    if (n_cmps != NComponents) {
+      throw std::invalid_argument("Wrong number of components in '" + path +
+                                  "'");
+    }
+    if (nodes < 2) {
+      throw std::invalid_argument("Invalid cache file '" + path + "'");
+    }
+
+    // Check the number of nodes against the file size before allocating, so
+    // that a corrupted header cannot trigger a huge allocation
+    const auto header_end = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto file_end = file.tellg();
+    file.seekg(header_end);
+    if (!file or file_end < header_end) {
+      throw std::invalid_argument("Invalid cache file '" + path + "'");
+    }
+    const std::uint64_t node_size =
+        2 * NComponents * sizeof(detail::GaussianComponent);
+    const auto payload = static_cast<std::uint64_t>(file_end - header_end);
+    if (payload % node_size != 0 or payload / node_size != nodes) {
+      throw std::invalid_argument("Truncated cache file '" + path + "'");
+    }
+
+    Table low_table, high_table;
+    try {
+      low_table.resize(nodes * NComponents);
+      high_table.resize(nodes * NComponents);
+    } catch (const std::bad_alloc &) {
+      throw std::invalid_argument("Cache file '" + path + "' is too large");
+    } catch (const std::length_error &) {
+      throw std::invalid_argument("Cache file '" + path + "' is too large");
+    }
+    for (auto *table : {&low_table, &high_table}) {
+      file.read(reinterpret_cast<char *>(table->data()),
+                table->size() * sizeof(detail::GaussianComponent));
+    }
+    if (!file) {
+      throw std::invalid_argument("Truncated cache file '" + path + "'");
+    }
+
+    TabulatedBetheHeitlerApprox ret(nodes, std::move(low_table),
+                                    std::move(high_table));
+    const bool low_matches = ret.matches(
+        ret.m_low_table, singleGaussianLimit, lowerLimit, [&](double x) {
+          return approx.makeMixture(approx.m_low_data, x,
+                                    approx.m_low_transform);
+        });
+    const bool high_matches = ret.matches(
+        ret.m_high_table, lowerLimit, higherLimit, [&](double x) {
+          return approx.makeMixture(approx.m_high_data, x,
+                                    approx.m_high_transform);
+        });
+    if (not low_matches or not high_matches) {
+      throw std::invalid_argument("Cache file '" + path +
+                                  "' does not match the parameterization");
+    }
+
+    return ret;
+  }
+
+  /// Loads the table from a cache file if it exists and matches the
+  /// parameterization and the number of nodes. Otherwise the table is built
+  /// and the cache file is (re)written, if possible.
+  ///
+  /// @param approx the polynomial parameterization
+  /// @param path Path of the cache file
+  /// @param nodes the number of nodes per x/x0 range
+  template <int PolyDegree>
+  static TabulatedBetheHeitlerApprox loadOrCreate(
+      const AtlasBetheHeitlerApprox<NComponents, PolyDegree> &approx,
+      const std::string &path, std::size_t nodes = defaultNodes) {
+    try {
+      auto cached = loadFromFile(path, approx);
+      if (cached.nodes() == nodes) {
+        return cached;
+      }
+    } catch (const std::invalid_argument &) {
+      // No usable cache, build the table below
+    }
+
+    TabulatedBetheHeitlerApprox ret(approx, nodes);
+    try {
+      ret.writeToFile(path);
+    } catch (const std::invalid_argument &) {
+      // A cache location which is not writable does not prevent the usage
+    }
+    return ret;
+  }
+};
+
 /// Creates a @ref AtlasBetheHeitlerApprox object based on an ATLAS
 /// configuration, that are stored as static data in the source code.
 /// This may not be an optimal configuration, but should allow to run
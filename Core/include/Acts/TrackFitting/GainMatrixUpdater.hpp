@@ -20,6 +20,7 @@
 #include <cassert>
 #include <system_error>
 #include <tuple>
+#include <vector>
 
 namespace Acts {
 
@@ -105,10 +106,74 @@ class GainMatrixUpdater {
     return error ? Result<void>::failure(error) : Result<void>::success();
   }
 
+  /// Run the Kalman update step for several trajectory states at once.
+  ///
+  /// States with the same measurement dimension and projector are updated
+  /// together. Their parameters and covariances are laid out across the
+  /// states so the small fixed size linear algebra can be vectorized over
+  /// the states. The result equals the single state update up to rounding.
+  ///
+  /// @param[in] gctx The current geometry context object, e.g. alignment
+  /// @param[in,out] trackStates The track states
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  /// @return The error of each track state, which evaluates to false on
+  ///         success
+  template <typename traj_t>
+  std::vector<std::error_code> updateBatch(
+      const GeometryContext& gctx,
+      const std::vector<typename traj_t::TrackStateProxy>& trackStates,
+      Direction direction = Direction::Forward,
+      const Logger& logger = getDummyLogger()) const {
+    (void)gctx;
+    ACTS_VERBOSE("Invoked GainMatrixUpdater on " << trackStates.size()
+                                                 << " track states");
+
+    std::vector<InternalTrackState> states;
+    states.reserve(trackStates.size());
+    for (auto trackState : trackStates) {
+      assert(trackState.hasCalibrated());
+      assert(trackState.hasPredicted());
+      assert(trackState.hasFiltered());
+
+      states.push_back(InternalTrackState{
+          trackState.predicted(),
+          trackState.predictedCovariance(),
+          trackState.filtered(),
+          trackState.filteredCovariance(),
+          trackState
+              .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data(),
+          trackState
+              .template calibratedCovariance<
+                  MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data(),
+          trackState.projector(),
+          trackState.calibratedSize(),
+      });
+    }
+
+    std::vector<double> chi2(states.size(), 0);
+    std::vector<std::error_code> errors(states.size());
+    visitMeasurementBatch(states, chi2, errors, direction, logger);
+
+    for (std::size_t i = 0; i < trackStates.size(); ++i) {
+      auto trackState = trackStates[i];
+      trackState.chi2() = chi2[i];
+    }
+
+    return errors;
+  }
+
  private:
   std::tuple<double, std::error_code> visitMeasurement(
       InternalTrackState trackState, Direction direction,
       const Logger& logger) const;
+
+  void visitMeasurementBatch(const std::vector<InternalTrackState>& states,
+                             std::vector<double>& chi2,
+                             std::vector<std::error_code>& errors,
+                             Direction direction, const Logger& logger) const;
 };
 
 }  // namespace Acts
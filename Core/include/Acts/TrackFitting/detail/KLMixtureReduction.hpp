@@ -14,6 +14,12 @@
 #include "Acts/TrackFitting/detail/GsfUtils.hpp"
 #include "Acts/Utilities/GaussianMixtureReduction.hpp"
 
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace Acts {
 
 namespace detail {
@@ -172,7 +178,162 @@ class SymmetricKLDistanceMatrix {
   }
 };
 
-template <typename component_t, typename component_projector_t,
+/// @brief Symmetric distance matrix which keeps track of its row minima
+///
+/// Has the same interface and finds the same pairs as the
+/// SymmetricKLDistanceMatrix, but is meant for repeated merging: The q/p
+/// values and variances are cached in packed arrays, so the distances of a
+/// component to all others are evaluated in one vectorizable loop. Every row
+/// of the lower triangle stores its minimum, so finding the closest pair only
+/// scans the rows, and after a merge only the minima of the rows which
+/// involve the changed components are updated.
+class PackedKLDistanceMatrix {
+  using Array = Eigen::Array<ActsScalar, Eigen::Dynamic, 1>;
+  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  static constexpr auto s_noColumn = std::numeric_limits<std::size_t>::max();
+
+  Array m_distances;
+  Array m_qop;
+  Array m_var;
+  Array m_invVar;
+  Array m_rowMin;
+  std::vector<std::size_t> m_rowMinColumn;
+  Mask m_active;
+  std::size_t m_numberComponents;
+
+  static std::size_t rowOffset(std::size_t i) { return i * (i - 1) / 2; }
+
+  /// Same expression as computeSymmetricKlDivergence
+  ActsScalar distance(std::size_t i, std::size_t j) const {
+    const auto diff = m_qop[i] - m_qop[j];
+    return m_var[i] * m_invVar[j] + m_var[j] * m_invVar[i] +
+           diff * (m_invVar[i] + m_invVar[j]) * diff;
+  }
+
+  template <typename component_t, typename projector_t>
+  void setComponent(std::size_t n, const component_t &cmp,
+                    const projector_t &proj) {
+    m_qop[n] = proj(cmp).boundPars[eBoundQOverP];
+    m_var[n] = proj(cmp).boundCov(eBoundQOverP, eBoundQOverP);
+    m_invVar[n] = 1 / m_var[n];
+
+    assert(m_var[n] != 0.0);
+    assert(std::isfinite(m_var[n]));
+  }
+
+  void computeRow(std::size_t i) {
+    const auto offset = rowOffset(i);
+    for (auto j = 0ul; j < i; ++j) {
+      m_distances[offset + j] = distance(i, j);
+    }
+  }
+
+  /// Finds the first minimum of the active entries in a row
+  void findRowMinimum(std::size_t i) {
+    const auto offset = rowOffset(i);
+    m_rowMin[i] = std::numeric_limits<ActsScalar>::max();
+    m_rowMinColumn[i] = s_noColumn;
+    for (auto j = 0ul; j < i; ++j) {
+      if (m_active[j] && m_distances[offset + j] < m_rowMin[i]) {
+        m_rowMin[i] = m_distances[offset + j];
+        m_rowMinColumn[i] = j;
+      }
+    }
+  }
+
+ public:
+  template <typename component_t, typename projector_t>
+  PackedKLDistanceMatrix(const std::vector<component_t> &cmps,
+                         const projector_t &proj)
+      : m_distances(cmps.size() * (cmps.size() - 1) / 2),
+        m_qop(cmps.size()),
+        m_var(cmps.size()),
+        m_invVar(cmps.size()),
+        m_rowMin(cmps.size()),
+        m_rowMinColumn(cmps.size()),
+        m_active(Mask::Ones(cmps.size())),
+        m_numberComponents(cmps.size()) {
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      setComponent(i, cmps[i], proj);
+    }
+    for (auto i = 1ul; i < m_numberComponents; ++i) {
+      computeRow(i);
+      findRowMinimum(i);
+    }
+  }
+
+  auto at(std::size_t i, std::size_t j) const {
+    return m_distances[rowOffset(i) + j];
+  }
+
+  template <typename component_t, typename projector_t>
+  void recomputeAssociatedDistances(std::size_t n,
+                                    const std::vector<component_t> &cmps,
+                                    const projector_t &proj) {
+    assert(cmps.size() == m_numberComponents && "size mismatch");
+
+    setComponent(n, cmps[n], proj);
+
+    // Row
+    if (n > 0) {
+      computeRow(n);
+      findRowMinimum(n);
+    }
+
+    // Column, which only moves the minimum of a row if it involves n
+    for (auto i = n + 1; i < m_numberComponents; ++i) {
+      const auto d = distance(i, n);
+      m_distances[rowOffset(i) + n] = d;
+
+      if (not m_active[n]) {
+        continue;
+      }
+      if (m_rowMinColumn[i] == n) {
+        if (d <= m_rowMin[i]) {
+          m_rowMin[i] = d;
+        } else {
+          findRowMinimum(i);
+        }
+      } else if (d < m_rowMin[i] ||
+                 (d == m_rowMin[i] && n < m_rowMinColumn[i])) {
+        m_rowMin[i] = d;
+        m_rowMinColumn[i] = n;
+      }
+    }
+  }
+
+  void maskAssociatedDistances(std::size_t n) {
+    m_active[n] = false;
+
+    for (auto i = n + 1; i < m_numberComponents; ++i) {
+      if (m_rowMinColumn[i] == n) {
+        findRowMinimum(i);
+      }
+    }
+  }
+
+  std::pair<std::size_t, std::size_t> minDistancePair() const {
+    ActsScalar min = std::numeric_limits<ActsScalar>::max();
+    std::pair<std::size_t, std::size_t> pair = {1, 0};
+
+    for (auto i = 1ul; i < m_numberComponents; ++i) {
+      if (m_active[i] && m_rowMin[i] < min) {
+        min = m_rowMin[i];
+        pair = {i, m_rowMinColumn[i]};
+      }
+    }
+
+    return pair;
+  }
+};
+
+/// Merges the closest pair of components in terms of the KL distance until
+/// only maxCmpsAfterMerge components are left
+///
+/// @tparam distance_matrix_t The distance matrix used to find the pairs
+template <typename distance_matrix_t = PackedKLDistanceMatrix,
+          typename component_t, typename component_projector_t,
           typename angle_desc_t>
 void reduceWithKLDistance(std::vector<component_t> &cmpCache,
                           std::size_t maxCmpsAfterMerge,
@@ -182,7 +343,7 @@ void reduceWithKLDistance(std::vector<component_t> &cmpCache,
     return;
   }
 
-  SymmetricKLDistanceMatrix distances(cmpCache, proj);
+  distance_matrix_t distances(cmpCache, proj);
 
   auto remainingComponents = cmpCache.size();
 
@@ -0,0 +1,867 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/MappedTrackContainer.hpp"
+
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Acts {
+
+namespace {
+
+using namespace Acts::HashedStringLiteral;
+using detail_mtc::ColumnType;
+using detail_mtc::ColumnView;
+using IndexType = MultiTrajectoryTraits::IndexType;
+
+constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
+constexpr char kMagic[8] = {'A', 'C', 'T', 'S', 'T', 'R', 'K', 'S'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kAlignment = 64;
+
+enum class Owner : std::uint32_t {
+  Trajectory,
+  TrajectoryDynamic,
+  Tracks,
+  TracksDynamic,
+};
+
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t indexDataSize;
+  std::uint64_t nColumns;
+};
+
+struct ColumnHeader {
+  Owner owner;
+  std::uint32_t key;
+  ColumnType type;
+  std::uint32_t elementSize;
+  std::uint64_t count;
+  std::uint64_t offset;
+};
+
+enum class SurfaceKind : std::uint32_t {
+  None,
+  Geometry,
+  Perigee,
+};
+
+struct SurfaceRecord {
+  std::uint64_t geometryId = 0;
+  SurfaceKind kind = SurfaceKind::None;
+  std::uint32_t padding = 0;
+  double position[3] = {0, 0, 0};
+};
+
+/// Columns to write with their data
+class ColumnWriter {
+ public:
+  template <typename T>
+  void add(Owner owner, std::uint32_t key, const std::vector<T>& column,
+           ColumnType type = ColumnType::UInt32) {
+    m_columns.push_back(
+        {{owner, key, type, sizeof(T), column.size(), 0}, column.data()});
+  }
+
+  void write(const std::string& path, std::uint32_t indexDataSize) {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (not os) {
+      throw std::runtime_error("Unable to open track file " + path);
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.indexDataSize = indexDataSize;
+    header.nColumns = m_columns.size();
+
+    std::uint64_t offset =
+        sizeof(FileHeader) + m_columns.size() * sizeof(ColumnHeader);
+    for (auto& [column, data] : m_columns) {
+      offset = align(offset);
+      column.offset = offset;
+      offset += column.count * column.elementSize;
+    }
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& column : m_columns) {
+      os.write(reinterpret_cast<const char*>(&column.first),
+               sizeof(ColumnHeader));
+    }
+    for (const auto& [column, data] : m_columns) {
+      const std::uint64_t position = os.tellp();
+      const std::vector<char> padding(column.offset - position, 0);
+      os.write(padding.data(), padding.size());
+      os.write(static_cast<const char*>(data),
+               column.count * column.elementSize);
+    }
+    if (not os) {
+      throw std::runtime_error("Unable to write track file " + path);
+    }
+  }
+
+ private:
+  static std::uint64_t align(std::uint64_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  std::vector<std::pair<ColumnHeader, const void*>> m_columns;
+};
+
+std::vector<SurfaceRecord> encodeSurfaces(
+    const GeometryContext& gctx,
+    const std::vector<std::shared_ptr<const Surface>>& surfaces) {
+  std::vector<SurfaceRecord> records(surfaces.size());
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    const Surface* surface = surfaces[i].get();
+    SurfaceRecord& record = records[i];
+    if (surface == nullptr) {
+      continue;
+    }
+    if (surface->geometryId() != GeometryIdentifier{}) {
+      record.kind = SurfaceKind::Geometry;
+      record.geometryId = surface->geometryId().value();
+    } else if (surface->type() == Surface::Perigee) {
+      record.kind = SurfaceKind::Perigee;
+      const Vector3 center = surface->center(gctx);
+      for (std::size_t j = 0; j < 3; ++j) {
+        record.position[j] = center[j];
+      }
+    } else {
+      throw std::invalid_argument(
+          "Unable to store a reference surface without geometry identifier");
+    }
+  }
+  return records;
+}
+
+using SurfacesById = std::unordered_map<GeometryIdentifier, const Surface*>;
+
+/// Collect all surfaces of a volume which can be a reference surface. Unlike
+/// TrackingGeometry::findSurface, this includes the passive surfaces, i.e. the
+/// boundary, layer and approach surfaces, on which e.g. the CKF records
+/// material states.
+void collectSurfaces(const TrackingVolume& volume, SurfacesById& surfaces) {
+  auto insert = [&](const Surface* surface) {
+    if (surface != nullptr and surface->geometryId() != GeometryIdentifier{}) {
+      surfaces.emplace(surface->geometryId(), surface);
+    }
+  };
+
+  for (const auto& boundary : volume.boundarySurfaces()) {
+    insert(&boundary->surfaceRepresentation());
+  }
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      insert(&layer->surfaceRepresentation());
+      if (layer->approachDescriptor() != nullptr) {
+        for (const Surface* surface :
+             layer->approachDescriptor()->containedSurfaces()) {
+          insert(surface);
+        }
+      }
+      if (layer->surfaceArray() != nullptr) {
+        for (const Surface* surface : layer->surfaceArray()->surfaces()) {
+          insert(surface);
+        }
+      }
+    }
+  }
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& confined : volume.confinedVolumes()->arrayObjects()) {
+      collectSurfaces(*confined, surfaces);
+    }
+  }
+}
+
+std::vector<const Surface*> decodeSurfaces(
+    const SurfacesById& geometrySurfaces,
+    const ColumnView<SurfaceRecord>& records,
+    std::vector<std::shared_ptr<const Surface>>& owned) {
+  std::vector<const Surface*> surfaces(records.size, nullptr);
+  for (std::size_t i = 0; i < records.size; ++i) {
+    const SurfaceRecord& record = records[i];
+    if (record.kind == SurfaceKind::Geometry) {
+      auto it = geometrySurfaces.find(GeometryIdentifier{record.geometryId});
+      if (it == geometrySurfaces.end()) {
+        throw std::runtime_error(
+            "Reference surface of the track file is not in the geometry");
+      }
+      surfaces[i] = it->second;
+    } else if (record.kind == SurfaceKind::Perigee) {
+      Vector3 position(record.position[0], record.position[1],
+                       record.position[2]);
+      owned.push_back(Surface::makeShared<PerigeeSurface>(position));
+      surfaces[i] = owned.back().get();
+    } else if (record.kind != SurfaceKind::None) {
+      throw std::runtime_error("Unknown reference surface in track file");
+    }
+  }
+  return surfaces;
+}
+
+template <typename T>
+bool addDynamicColumn(ColumnWriter& writer, Owner owner, HashedString key,
+                      const detail::DynamicColumnBase& column,
+                      ColumnType type) {
+  const auto* typed = dynamic_cast<const detail::DynamicColumn<T>*>(&column);
+  if (typed == nullptr) {
+    return false;
+  }
+  writer.add(owner, key, typed->m_vector, type);
+  return true;
+}
+
+void addDynamicColumns(
+    ColumnWriter& writer, Owner owner,
+    const std::unordered_map<HashedString,
+                             std::unique_ptr<detail::DynamicColumnBase>>&
+        columns,
+    std::vector<std::vector<std::uint8_t>>& boolColumns) {
+  for (const auto& [key, column] : columns) {
+    if (const auto* typed =
+            dynamic_cast<const detail::DynamicColumn<bool>*>(column.get())) {
+      auto& values = boolColumns.emplace_back();
+      for (const auto& wrapper : typed->m_vector) {
+        values.push_back(wrapper.value ? 1 : 0);
+      }
+      writer.add(owner, key, values, ColumnType::Bool);
+      continue;
+    }
+    bool added =
+        addDynamicColumn<std::uint32_t>(writer, owner, key, *column,
+                                        ColumnType::UInt32) or
+        addDynamicColumn<std::uint64_t>(writer, owner, key, *column,
+                                        ColumnType::UInt64) or
+        addDynamicColumn<std::int32_t>(writer, owner, key, *column,
+                                       ColumnType::Int32) or
+        addDynamicColumn<std::int64_t>(writer, owner, key, *column,
+                                       ColumnType::Int64) or
+        addDynamicColumn<float>(writer, owner, key, *column,
+                                ColumnType::Float) or
+        addDynamicColumn<double>(writer, owner, key, *column,
+                                 ColumnType::Double);
+    if (not added) {
+      throw std::invalid_argument("Unable to store dynamic column of type " +
+                                  std::string(typeid(*column).name()));
+    }
+  }
+}
+
+template <typename T>
+void assign(ColumnView<T>& view, const ColumnHeader& column,
+            const std::byte* base) {
+  if (column.elementSize != sizeof(T)) {
+    throw std::runtime_error("Unexpected element size in track file");
+  }
+  if (column.offset % alignof(T) != 0) {
+    throw std::runtime_error("Misaligned column in track file");
+  }
+  view.data = reinterpret_cast<const T*>(base + column.offset);
+  view.size = column.count;
+}
+
+/// Expand a column of packed values into full values
+///
+/// @param values Output for the expanded values
+/// @param column The packed column, with float or double elements
+/// @param base The start of the mapped file
+/// @param packedSize Number of packed elements per value
+/// @param unpack Expands one value from a pointer to its packed elements
+template <typename value_t, typename unpack_t>
+void expand(std::vector<value_t>& values, const ColumnHeader& column,
+            const std::byte* base, std::size_t packedSize,
+            const unpack_t& unpack) {
+  auto expandAs = [&](auto scalar) {
+    using scalar_t = decltype(scalar);
+    if (column.elementSize != sizeof(scalar_t) or
+        column.count % packedSize != 0) {
+      throw std::runtime_error("Unexpected element size in track file");
+    }
+    if (column.offset % alignof(scalar_t) != 0) {
+      throw std::runtime_error("Misaligned column in track file");
+    }
+    const auto* packed = reinterpret_cast<const scalar_t*>(base + column.offset);
+    values.resize(column.count / packedSize);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      unpack(packed + i * packedSize, values[i]);
+    }
+  };
+  switch (column.type) {
+    case ColumnType::Float:
+      expandAs(float{});
+      break;
+    case ColumnType::Double:
+      expandAs(double{});
+      break;
+    default:
+      throw std::runtime_error("Unexpected element type in track file");
+  }
+}
+
+/// Expand values which are stored element by element
+template <typename value_t>
+void expandElements(std::vector<value_t>& values, const ColumnHeader& column,
+                    const std::byte* base) {
+  expand(values, column, base, value_t::SizeAtCompileTime,
+         [](const auto* packed, value_t& value) {
+           for (Eigen::Index i = 0; i < value_t::SizeAtCompileTime; ++i) {
+             value.data()[i] = packed[i];
+           }
+         });
+}
+
+/// Copy the index records member by member into zeroed memory, so that the
+/// padding bytes written to the file are deterministic
+template <typename index_data_t>
+std::vector<index_data_t> zeroPaddedIndex(
+    const std::vector<index_data_t>& index) {
+  std::vector<index_data_t> records(index.size());
+  std::memset(static_cast<void*>(records.data()), 0,
+              records.size() * sizeof(index_data_t));
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    const index_data_t& in = index[i];
+    index_data_t& out = records[i];
+    out.iprevious = in.iprevious;
+    out.ipredicted = in.ipredicted;
+    out.ifiltered = in.ifiltered;
+    out.ismoothed = in.ismoothed;
+    out.ijacobian = in.ijacobian;
+    out.iprojector = in.iprojector;
+    out.chi2 = in.chi2;
+    out.pathLength = in.pathLength;
+    out.typeFlags = in.typeFlags;
+    out.iuncalibrated = in.iuncalibrated;
+    out.icalibratedsourcelink = in.icalibratedsourcelink;
+    out.measdim = in.measdim;
+    out.allocMask = in.allocMask;
+  }
+  return records;
+}
+
+/// Whether an index stored in the file is invalid or points into a column
+bool isValidIndex(IndexType index, std::size_t size, bool optional = true) {
+  return (optional and index == kInvalid) or index < size;
+}
+
+std::size_t elementSize(ColumnType type) {
+  switch (type) {
+    case ColumnType::UInt32:
+    case ColumnType::Int32:
+    case ColumnType::Float:
+      return 4;
+    case ColumnType::UInt64:
+    case ColumnType::Int64:
+    case ColumnType::Double:
+      return 8;
+    case ColumnType::Bool:
+      return 1;
+  }
+  throw std::runtime_error("Unknown column type in track file");
+}
+
+}  // namespace
+
+std::any detail_mtc::DynamicColumnView::get(std::size_t i) const {
+  switch (type) {
+    case ColumnType::UInt32:
+      return reinterpret_cast<const std::uint32_t*>(data) + i;
+    case ColumnType::UInt64:
+      return reinterpret_cast<const std::uint64_t*>(data) + i;
+    case ColumnType::Int32:
+      return reinterpret_cast<const std::int32_t*>(data) + i;
+    case ColumnType::Int64:
+      return reinterpret_cast<const std::int64_t*>(data) + i;
+    case ColumnType::Float:
+      return reinterpret_cast<const float*>(data) + i;
+    case ColumnType::Double:
+      return reinterpret_cast<const double*>(data) + i;
+    case ColumnType::Bool:
+      return reinterpret_cast<const bool*>(data) + i;
+  }
+  throw std::runtime_error("Unknown column type in track file");
+}
+
+bool MappedMultiTrajectory::has_impl(HashedString key,
+                                     IndexType istate) const {
+  switch (key) {
+    case "predicted"_hash:
+      return m_index[istate].ipredicted != kInvalid;
+    case "filtered"_hash:
+      return m_index[istate].ifiltered != kInvalid;
+    case "smoothed"_hash:
+      return m_index[istate].ismoothed != kInvalid;
+    case "calibrated"_hash:
+      return m_measOffset[istate] != kInvalid;
+    case "calibratedCov"_hash:
+      return m_measCovOffset[istate] != kInvalid;
+    case "jacobian"_hash:
+      return m_index[istate].ijacobian != kInvalid;
+    case "projector"_hash:
+      return m_index[istate].iprojector != kInvalid;
+    case "uncalibratedSourceLink"_hash:
+      return m_sourceLinkValid[m_index[istate].iuncalibrated] != 0;
+    case "previous"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return m_dynamic.find(key) != m_dynamic.end();
+  }
+}
+
+std::any MappedMultiTrajectory::component_impl(HashedString key,
+                                               IndexType istate) const {
+  switch (key) {
+    case "previous"_hash:
+      return &m_index[istate].iprevious;
+    case "predicted"_hash:
+      return &m_index[istate].ipredicted;
+    case "filtered"_hash:
+      return &m_index[istate].ifiltered;
+    case "smoothed"_hash:
+      return &m_index[istate].ismoothed;
+    case "projector"_hash:
+      return &m_projectors[m_index[istate].iprojector];
+    case "measdim"_hash:
+      return &m_index[istate].measdim;
+    case "chi2"_hash:
+      return &m_index[istate].chi2;
+    case "pathLength"_hash:
+      return &m_index[istate].pathLength;
+    case "typeFlags"_hash:
+      return &m_index[istate].typeFlags;
+    default:
+      auto it = m_dynamic.find(key);
+      if (it == m_dynamic.end()) {
+        throw std::runtime_error("Unable to handle this component");
+      }
+      return it->second.get(istate);
+  }
+}
+
+bool MappedMultiTrajectory::hasColumn_impl(HashedString key) const {
+  switch (key) {
+    case "predicted"_hash:
+    case "filtered"_hash:
+    case "smoothed"_hash:
+    case "calibrated"_hash:
+    case "calibratedCov"_hash:
+    case "jacobian"_hash:
+    case "projector"_hash:
+    case "previous"_hash:
+    case "uncalibratedSourceLink"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return m_dynamic.find(key) != m_dynamic.end();
+  }
+}
+
+std::any MappedTrackContainer::component_impl(HashedString key,
+                                              IndexType itrack) const {
+  switch (key) {
+    case "tipIndex"_hash:
+      return &m_tipIndex[itrack];
+    case "params"_hash:
+      return &m_params[itrack];
+    case "cov"_hash:
+      return &m_cov[itrack];
+    case "nMeasurements"_hash:
+      return &m_nMeasurements[itrack];
+    case "nHoles"_hash:
+      return &m_nHoles[itrack];
+    case "chi2"_hash:
+      return &m_chi2[itrack];
+    case "ndf"_hash:
+      return &m_ndf[itrack];
+    case "nOutliers"_hash:
+      return &m_nOutliers[itrack];
+    case "nSharedHits"_hash:
+      return &m_nSharedHits[itrack];
+    default:
+      auto it = m_dynamic.find(key);
+      if (it == m_dynamic.end()) {
+        throw std::runtime_error("Unable to handle this component");
+      }
+      return it->second.get(itrack);
+  }
+}
+
+bool MappedMultiTrajectory::validate() const {
+  const std::size_t nStates = m_index.size;
+  if (m_measOffset.size != nStates or m_measCovOffset.size != nStates or
+      m_params.size != m_cov.size or
+      m_sourceLinkValid.size != m_sourceLinks.size) {
+    return false;
+  }
+  for (std::size_t istate = 0; istate < nStates; ++istate) {
+    const auto& index = m_index[istate];
+    if (not isValidIndex(index.iprevious, nStates) or
+        not isValidIndex(index.ipredicted, m_params.size) or
+        not isValidIndex(index.ifiltered, m_params.size) or
+        not isValidIndex(index.ismoothed, m_params.size) or
+        not isValidIndex(index.ijacobian, m_jac.size) or
+        not isValidIndex(index.iprojector, m_projectors.size) or
+        not isValidIndex(index.iuncalibrated, m_sourceLinks.size, false) or
+        index.measdim > eBoundSize) {
+      return false;
+    }
+    const IndexType measOffset = m_measOffset[istate];
+    const IndexType measCovOffset = m_measCovOffset[istate];
+    if ((measOffset != kInvalid and
+         (measOffset > m_meas.size or
+          index.measdim > m_meas.size - measOffset)) or
+        (measCovOffset != kInvalid and
+         (measCovOffset > m_measCov.size or
+          index.measdim * index.measdim > m_measCov.size - measCovOffset))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MappedTrackContainer::validate(std::size_t nStates) const {
+  const std::size_t nTracks = m_tipIndex.size;
+  if (m_params.size != nTracks or m_cov.size != nTracks or
+      m_nMeasurements.size != nTracks or m_nHoles.size != nTracks or
+      m_chi2.size != nTracks or m_ndf.size != nTracks or
+      m_nOutliers.size != nTracks or m_nSharedHits.size != nTracks) {
+    return false;
+  }
+  for (std::size_t itrack = 0; itrack < nTracks; ++itrack) {
+    if (not isValidIndex(m_tipIndex[itrack], nStates)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename trajectory_t>
+void MappedTrackFile::writeImpl(const std::string& path,
+                                const GeometryContext& gctx,
+                                const VectorTrackContainer& tracks,
+                                const trajectory_t& trajectory,
+                                const SourceLinkEncoder& encoder) {
+  ColumnWriter writer;
+
+  // trajectory columns which are not stored in place
+  std::vector<SourceLinkRecord> sourceLinks;
+  std::vector<std::uint8_t> sourceLinkValid;
+  sourceLinks.reserve(trajectory.m_sourceLinks.size());
+  sourceLinkValid.reserve(trajectory.m_sourceLinks.size());
+  for (const auto& sourceLink : trajectory.m_sourceLinks) {
+    sourceLinks.push_back(sourceLink.has_value() ? encoder(*sourceLink)
+                                                 : SourceLinkRecord{});
+    sourceLinkValid.push_back(sourceLink.has_value() ? 1 : 0);
+  }
+  const auto stateSurfaces =
+      encodeSurfaces(gctx, trajectory.m_referenceSurfaces);
+  const auto trackSurfaces = encodeSurfaces(gctx, tracks.m_referenceSurfaces);
+  const auto index = zeroPaddedIndex(trajectory.m_index);
+  std::vector<std::vector<std::uint8_t>> boolColumns;
+  boolColumns.reserve(trajectory.m_dynamic.size() + tracks.m_dynamic.size());
+
+  constexpr auto kTrajectory = Owner::Trajectory;
+  writer.add(kTrajectory, "index"_hash, index);
+  if constexpr (std::is_same_v<trajectory_t, VectorMultiTrajectory>) {
+    writer.add(kTrajectory, "params"_hash, trajectory.m_params);
+    writer.add(kTrajectory, "cov"_hash, trajectory.m_cov);
+    writer.add(kTrajectory, "jac"_hash, trajectory.m_jac);
+  } else {
+    using Scalar = typename trajectory_t::Scalar;
+    constexpr auto kScalarType = std::is_same_v<Scalar, float>
+                                     ? ColumnType::Float
+                                     : ColumnType::Double;
+    writer.add(kTrajectory, "packedParams"_hash, trajectory.m_params,
+               kScalarType);
+    writer.add(kTrajectory, "packedCov"_hash, trajectory.m_cov, kScalarType);
+    writer.add(kTrajectory, "packedJac"_hash, trajectory.m_jac, kScalarType);
+  }
+  writer.add(kTrajectory, "meas"_hash, trajectory.m_meas);
+  writer.add(kTrajectory, "measOffset"_hash, trajectory.m_measOffset);
+  writer.add(kTrajectory, "measCov"_hash, trajectory.m_measCov);
+  writer.add(kTrajectory, "measCovOffset"_hash, trajectory.m_measCovOffset);
+  writer.add(kTrajectory, "sourceLinks"_hash, sourceLinks);
+  writer.add(kTrajectory, "sourceLinkValid"_hash, sourceLinkValid);
+  writer.add(kTrajectory, "projectors"_hash, trajectory.m_projectors);
+  writer.add(kTrajectory, "referenceSurfaces"_hash, stateSurfaces);
+  addDynamicColumns(writer, Owner::TrajectoryDynamic, trajectory.m_dynamic,
+                    boolColumns);
+
+  constexpr auto kTracks = Owner::Tracks;
+  writer.add(kTracks, "tipIndex"_hash, tracks.m_tipIndex);
+  writer.add(kTracks, "params"_hash, tracks.m_params);
+  writer.add(kTracks, "cov"_hash, tracks.m_cov);
+  writer.add(kTracks, "referenceSurfaces"_hash, trackSurfaces);
+  writer.add(kTracks, "nMeasurements"_hash, tracks.m_nMeasurements);
+  writer.add(kTracks, "nHoles"_hash, tracks.m_nHoles);
+  writer.add(kTracks, "chi2"_hash, tracks.m_chi2);
+  writer.add(kTracks, "ndf"_hash, tracks.m_ndf);
+  writer.add(kTracks, "nOutliers"_hash, tracks.m_nOutliers);
+  writer.add(kTracks, "nSharedHits"_hash, tracks.m_nSharedHits);
+  addDynamicColumns(writer, Owner::TracksDynamic, tracks.m_dynamic,
+                    boolColumns);
+
+  writer.write(path,
+               sizeof(detail_vmt::VectorMultiTrajectoryBase::IndexData));
+}
+
+void MappedTrackFile::write(const std::string& path,
+                            const GeometryContext& gctx,
+                            const VectorTrackContainer& tracks,
+                            const VectorMultiTrajectory& trajectory,
+                            const SourceLinkEncoder& encoder) {
+  writeImpl(path, gctx, tracks, trajectory, encoder);
+}
+
+template <typename scalar_t>
+void MappedTrackFile::write(const std::string& path,
+                            const GeometryContext& gctx,
+                            const VectorTrackContainer& tracks,
+                            const PackedMultiTrajectory<scalar_t>& trajectory,
+                            const SourceLinkEncoder& encoder) {
+  if (trajectory.expandedBytes() != 0) {
+    throw std::invalid_argument(
+        "Track states need to be packed before they are written");
+  }
+  writeImpl(path, gctx, tracks, trajectory, encoder);
+}
+
+template void MappedTrackFile::write(const std::string&,
+                                     const GeometryContext&,
+                                     const VectorTrackContainer&,
+                                     const PackedMultiTrajectory<float>&,
+                                     const SourceLinkEncoder&);
+template void MappedTrackFile::write(const std::string&,
+                                     const GeometryContext&,
+                                     const VectorTrackContainer&,
+                                     const PackedMultiTrajectory<double>&,
+                                     const SourceLinkEncoder&);
+
+MappedTrackFile::MappedTrackFile(const std::string& path,
+                                 const TrackingGeometry& geometry,
+                                 SourceLinkDecoder decoder) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open track file " + path);
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 or
+      static_cast<std::size_t>(info.st_size) < sizeof(FileHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Invalid track file " + path);
+  }
+  m_size = info.st_size;
+  void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Unable to map track file " + path);
+  }
+  m_data = data;
+
+  try {
+    const auto* base = static_cast<const std::byte*>(m_data);
+    const auto* header = reinterpret_cast<const FileHeader*>(base);
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 or
+        header->version != kVersion) {
+      throw std::runtime_error("Invalid track file " + path);
+    }
+    if (header->indexDataSize !=
+        sizeof(detail_vmt::VectorMultiTrajectoryBase::IndexData)) {
+      throw std::runtime_error("Incompatible track file " + path);
+    }
+    if (header->nColumns >
+        (m_size - sizeof(FileHeader)) / sizeof(ColumnHeader)) {
+      throw std::runtime_error("Truncated track file " + path);
+    }
+
+    ColumnView<SurfaceRecord> stateSurfaces;
+    ColumnView<SurfaceRecord> trackSurfaces;
+    // sizes of the dynamic columns, checked once the sizes are known
+    std::vector<std::pair<Owner, std::uint64_t>> dynamicSizes;
+
+    const auto* columns =
+        reinterpret_cast<const ColumnHeader*>(base + sizeof(FileHeader));
+    for (std::uint64_t i = 0; i < header->nColumns; ++i) {
+      const ColumnHeader& column = columns[i];
+      if (column.offset % kAlignment != 0 or column.offset > m_size or
+          (column.elementSize != 0 and
+           column.count > (m_size - column.offset) / column.elementSize)) {
+        throw std::runtime_error("Truncated track file " + path);
+      }
+
+      if (column.owner == Owner::TrajectoryDynamic or
+          column.owner == Owner::TracksDynamic) {
+        if (column.elementSize != elementSize(column.type)) {
+          throw std::runtime_error("Unexpected element size in track file");
+        }
+        auto& dynamic = column.owner == Owner::TrajectoryDynamic
+                            ? m_trajectory.m_dynamic
+                            : m_tracks.m_dynamic;
+        dynamic[column.key] = {base + column.offset, column.type};
+        dynamicSizes.emplace_back(column.owner, column.count);
+        continue;
+      }
+      if (column.owner != Owner::Trajectory and
+          column.owner != Owner::Tracks) {
+        throw std::runtime_error("Unknown column in track file " + path);
+      }
+
+      auto& t = m_trajectory;
+      auto& k = m_tracks;
+      const bool isTrajectory = column.owner == Owner::Trajectory;
+      switch (column.key) {
+        case "index"_hash:
+          assign(t.m_index, column, base);
+          break;
+        case "params"_hash:
+          isTrajectory ? assign(t.m_params, column, base)
+                       : assign(k.m_params, column, base);
+          break;
+        case "cov"_hash:
+          isTrajectory ? assign(t.m_cov, column, base)
+                       : assign(k.m_cov, column, base);
+          break;
+        case "meas"_hash:
+          assign(t.m_meas, column, base);
+          break;
+        case "measOffset"_hash:
+          assign(t.m_measOffset, column, base);
+          break;
+        case "measCov"_hash:
+          assign(t.m_measCov, column, base);
+          break;
+        case "measCovOffset"_hash:
+          assign(t.m_measCovOffset, column, base);
+          break;
+        case "jac"_hash:
+          assign(t.m_jac, column, base);
+          break;
+        case "packedParams"_hash:
+          expandElements(m_params, column, base);
+          t.m_params = {m_params.data(), m_params.size()};
+          break;
+        case "packedCov"_hash:
+          expand(m_cov, column, base,
+                 PackedMultiTrajectory<>::kPackedCovarianceSize,
+                 [](const auto* packed, Covariance& cov) {
+                   using Scalar =
+                       std::remove_const_t<std::remove_reference_t<decltype(
+                           *packed)>>;
+                   PackedMultiTrajectory<Scalar>::unpackCovariance(packed,
+                                                                   cov);
+                 });
+          t.m_cov = {m_cov.data(), m_cov.size()};
+          break;
+        case "packedJac"_hash:
+          expandElements(m_jac, column, base);
+          t.m_jac = {m_jac.data(), m_jac.size()};
+          break;
+        case "sourceLinks"_hash:
+          assign(t.m_sourceLinks, column, base);
+          break;
+        case "sourceLinkValid"_hash:
+          assign(t.m_sourceLinkValid, column, base);
+          break;
+        case "projectors"_hash:
+          assign(t.m_projectors, column, base);
+          break;
+        case "referenceSurfaces"_hash:
+          isTrajectory ? assign(stateSurfaces, column, base)
+                       : assign(trackSurfaces, column, base);
+          break;
+        case "tipIndex"_hash:
+          assign(k.m_tipIndex, column, base);
+          break;
+        case "nMeasurements"_hash:
+          assign(k.m_nMeasurements, column, base);
+          break;
+        case "nHoles"_hash:
+          assign(k.m_nHoles, column, base);
+          break;
+        case "chi2"_hash:
+          assign(k.m_chi2, column, base);
+          break;
+        case "ndf"_hash:
+          assign(k.m_ndf, column, base);
+          break;
+        case "nOutliers"_hash:
+          assign(k.m_nOutliers, column, base);
+          break;
+        case "nSharedHits"_hash:
+          assign(k.m_nSharedHits, column, base);
+          break;
+        default:
+          throw std::runtime_error("Unknown column in track file " + path);
+      }
+    }
+
+    if (stateSurfaces.size != m_trajectory.m_index.size or
+        trackSurfaces.size != m_tracks.m_tipIndex.size) {
+      throw std::runtime_error("Inconsistent track file " + path);
+    }
+    for (const auto& [owner, size] : dynamicSizes) {
+      if (size != (owner == Owner::TrajectoryDynamic
+                       ? m_trajectory.m_index.size
+                       : m_tracks.m_tipIndex.size)) {
+        throw std::runtime_error("Inconsistent track file " + path);
+      }
+    }
+    if (not m_trajectory.validate() or not m_tracks.validate(m_trajectory.size())) {
+      throw std::runtime_error("Inconsistent track file " + path);
+    }
+
+    SurfacesById geometrySurfaces;
+    collectSurfaces(*geometry.highestTrackingVolume(), geometrySurfaces);
+    m_trajectory.m_referenceSurfaces =
+        decodeSurfaces(geometrySurfaces, stateSurfaces, m_surfaces);
+    m_tracks.m_referenceSurfaces =
+        decodeSurfaces(geometrySurfaces, trackSurfaces, m_surfaces);
+    m_trajectory.m_sourceLinkDecoder = std::move(decoder);
+  } catch (...) {
+    ::munmap(const_cast<void*>(m_data), m_size);
+    throw;
+  }
+}
+
+MappedTrackFile::~MappedTrackFile() {
+  ::munmap(const_cast<void*>(m_data), m_size);
+}
+
+}  // namespace Acts
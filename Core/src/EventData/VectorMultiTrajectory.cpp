@@ -12,8 +12,11 @@
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
 
 #include <boost/histogram.hpp>
@@ -186,6 +189,250 @@ void VectorMultiTrajectory::clear_impl() {
   }
 }
 
+auto VectorMultiTrajectory::append(const VectorMultiTrajectory& other)
+    -> IndexType {
+  if (m_dynamic.size() != other.m_dynamic.size()) {
+    throw std::invalid_argument{
+        "Appended trajectory does not have matching dynamic columns"};
+  }
+  for (const auto& [key, value] : other.m_dynamic) {
+    (void)value;
+    if (m_dynamic.find(key) == m_dynamic.end()) {
+      throw std::invalid_argument{
+          "Appended trajectory does not have matching dynamic columns"};
+    }
+  }
+
+  const IndexType stateOffset = m_index.size();
+  const IndexType paramsOffset = m_params.size();
+  const IndexType jacOffset = m_jac.size();
+  const IndexType sourceLinkOffset = m_sourceLinks.size();
+  const IndexType projectorOffset = m_projectors.size();
+  const IndexType measOffset = m_meas.size();
+  const IndexType measCovOffset = m_measCov.size();
+
+  auto shift = [](IndexType index, IndexType offset) {
+    return index == kInvalid ? kInvalid : index + offset;
+  };
+
+  m_index.reserve(m_index.size() + other.m_index.size());
+  for (IndexData p : other.m_index) {
+    p.iprevious = shift(p.iprevious, stateOffset);
+    p.ipredicted = shift(p.ipredicted, paramsOffset);
+    p.ifiltered = shift(p.ifiltered, paramsOffset);
+    p.ismoothed = shift(p.ismoothed, paramsOffset);
+    p.ijacobian = shift(p.ijacobian, jacOffset);
+    p.iprojector = shift(p.iprojector, projectorOffset);
+    p.iuncalibrated = shift(p.iuncalibrated, sourceLinkOffset);
+    p.icalibratedsourcelink = shift(p.icalibratedsourcelink, sourceLinkOffset);
+    m_index.push_back(p);
+  }
+
+  auto appendVector = [](auto& vec, const auto& otherVec) {
+    vec.insert(vec.end(), otherVec.begin(), otherVec.end());
+  };
+  appendVector(m_params, other.m_params);
+  appendVector(m_cov, other.m_cov);
+  appendVector(m_meas, other.m_meas);
+  appendVector(m_measCov, other.m_measCov);
+  appendVector(m_jac, other.m_jac);
+  appendVector(m_sourceLinks, other.m_sourceLinks);
+  appendVector(m_projectors, other.m_projectors);
+  appendVector(m_referenceSurfaces, other.m_referenceSurfaces);
+
+  m_measOffset.reserve(m_measOffset.size() + other.m_measOffset.size());
+  for (IndexType offset : other.m_measOffset) {
+    m_measOffset.push_back(shift(offset, measOffset));
+  }
+  m_measCovOffset.reserve(m_measCovOffset.size() +
+                          other.m_measCovOffset.size());
+  for (IndexType offset : other.m_measCovOffset) {
+    m_measCovOffset.push_back(shift(offset, measCovOffset));
+  }
+
+  for (auto& [key, vec] : m_dynamic) {
+    const auto& otherVec = *other.m_dynamic.at(key);
+    for (IndexType i = 0; i < otherVec.size(); ++i) {
+      vec->add();
+      vec->copyFrom(stateOffset + i, otherVec, i);
+    }
+  }
+
+  return stateOffset;
+}
+
+auto VectorMultiTrajectory::compact(const std::vector<IndexType>& tips,
+                                    IndexType begin)
+    -> std::vector<IndexType> {
+  const IndexType end = m_index.size();
+  if (begin > end) {
+    throw std::out_of_range{"Compaction begins after the last track state"};
+  }
+
+  // Mark the states reachable from the tips and assign their new indices
+  std::vector<IndexType> remap(end - begin, kInvalid);
+  for (IndexType tip : tips) {
+    for (IndexType i = tip;
+         i != kInvalid and i >= begin and remap[i - begin] == kInvalid;
+         i = m_index[i].iprevious) {
+      remap[i - begin] = 0;
+    }
+  }
+  IndexType nStates = begin;
+  for (IndexType& index : remap) {
+    if (index != kInvalid) {
+      index = nStates++;
+    }
+  }
+
+  // Components of the considered states are allocated after the ones of the
+  // earlier states, so everything from the lowest referenced index on can be
+  // rebuilt
+  IndexType paramsBegin = m_params.size();
+  IndexType jacBegin = m_jac.size();
+  IndexType sourceLinkBegin = m_sourceLinks.size();
+  IndexType projectorBegin = m_projectors.size();
+  IndexType measBegin = m_meas.size();
+  IndexType measCovBegin = m_measCov.size();
+  auto lower = [](IndexType& bound, IndexType index) {
+    if (index != kInvalid) {
+      bound = std::min(bound, index);
+    }
+  };
+  for (IndexType i = begin; i < end; ++i) {
+    const IndexData& p = m_index[i];
+    lower(paramsBegin, p.ipredicted);
+    lower(paramsBegin, p.ifiltered);
+    lower(paramsBegin, p.ismoothed);
+    lower(jacBegin, p.ijacobian);
+    lower(sourceLinkBegin, p.iuncalibrated);
+    lower(sourceLinkBegin, p.icalibratedsourcelink);
+    lower(projectorBegin, p.iprojector);
+    lower(measBegin, m_measOffset[i]);
+    lower(measCovBegin, m_measCovOffset[i]);
+  }
+
+  decltype(m_params) params;
+  decltype(m_cov) cov;
+  decltype(m_jac) jac;
+  decltype(m_sourceLinks) sourceLinks;
+  decltype(m_projectors) projectors;
+  decltype(m_meas) meas;
+  decltype(m_measCov) measCov;
+
+  // Shared components are copied once and keep being shared
+  std::vector<IndexType> paramsRemap(m_params.size() - paramsBegin, kInvalid);
+  std::vector<IndexType> jacRemap(m_jac.size() - jacBegin, kInvalid);
+  std::vector<IndexType> sourceLinkRemap(m_sourceLinks.size() - sourceLinkBegin,
+                                         kInvalid);
+  std::vector<IndexType> projectorRemap(m_projectors.size() - projectorBegin,
+                                        kInvalid);
+
+  auto relocate = [](IndexType& index, IndexType offset,
+                     std::vector<IndexType>& componentRemap,
+                     const auto& copy) {
+    if (index == kInvalid or index < offset) {
+      return;
+    }
+    IndexType& target = componentRemap[index - offset];
+    if (target == kInvalid) {
+      target = offset + copy(index);
+    }
+    index = target;
+  };
+  auto copyParams = [&](IndexType index) {
+    params.push_back(m_params[index]);
+    cov.push_back(m_cov[index]);
+    return params.size() - 1;
+  };
+  auto copyJac = [&](IndexType index) {
+    jac.push_back(m_jac[index]);
+    return jac.size() - 1;
+  };
+  auto copySourceLink = [&](IndexType index) {
+    sourceLinks.push_back(m_sourceLinks[index]);
+    return sourceLinks.size() - 1;
+  };
+  auto copyProjector = [&](IndexType index) {
+    projectors.push_back(m_projectors[index]);
+    return projectors.size() - 1;
+  };
+
+  for (IndexType i = begin; i < end; ++i) {
+    const IndexType j = remap[i - begin];
+    if (j == kInvalid) {
+      continue;
+    }
+    // new indices never exceed the old ones, so the per state columns can be
+    // compacted in place
+    IndexData p = m_index[i];
+    if (p.iprevious != kInvalid and p.iprevious >= begin) {
+      p.iprevious = remap[p.iprevious - begin];
+    }
+    relocate(p.ipredicted, paramsBegin, paramsRemap, copyParams);
+    relocate(p.ifiltered, paramsBegin, paramsRemap, copyParams);
+    relocate(p.ismoothed, paramsBegin, paramsRemap, copyParams);
+    relocate(p.ijacobian, jacBegin, jacRemap, copyJac);
+    relocate(p.iuncalibrated, sourceLinkBegin, sourceLinkRemap,
+             copySourceLink);
+    relocate(p.icalibratedsourcelink, sourceLinkBegin, sourceLinkRemap,
+             copySourceLink);
+    relocate(p.iprojector, projectorBegin, projectorRemap, copyProjector);
+    m_index[j] = p;
+
+    IndexType measOffset = m_measOffset[i];
+    if (measOffset != kInvalid and measOffset >= measBegin) {
+      m_measOffset[j] = measBegin + meas.size();
+      meas.insert(meas.end(), m_meas.begin() + measOffset,
+                  m_meas.begin() + measOffset + p.measdim);
+    } else {
+      m_measOffset[j] = measOffset;
+    }
+    IndexType measCovOffset = m_measCovOffset[i];
+    if (measCovOffset != kInvalid and measCovOffset >= measCovBegin) {
+      m_measCovOffset[j] = measCovBegin + measCov.size();
+      measCov.insert(measCov.end(), m_measCov.begin() + measCovOffset,
+                     m_measCov.begin() + measCovOffset + p.measdim * p.measdim);
+    } else {
+      m_measCovOffset[j] = measCovOffset;
+    }
+
+    if (j != i) {
+      m_referenceSurfaces[j] = std::move(m_referenceSurfaces[i]);
+      for (auto& [key, vec] : m_dynamic) {
+        vec->copyFrom(j, *vec, i);
+      }
+    }
+  }
+
+  m_index.erase(m_index.begin() + nStates, m_index.end());
+  m_measOffset.erase(m_measOffset.begin() + nStates, m_measOffset.end());
+  m_measCovOffset.erase(m_measCovOffset.begin() + nStates,
+                        m_measCovOffset.end());
+  m_referenceSurfaces.erase(m_referenceSurfaces.begin() + nStates,
+                            m_referenceSurfaces.end());
+  for (auto& [key, vec] : m_dynamic) {
+    for (std::size_t i = vec->size(); i > nStates; --i) {
+      vec->erase(i - 1);
+    }
+  }
+
+  auto replaceTail = [](auto& vec, IndexType offset, auto& tail) {
+    vec.erase(vec.begin() + offset, vec.end());
+    vec.insert(vec.end(), std::make_move_iterator(tail.begin()),
+               std::make_move_iterator(tail.end()));
+  };
+  replaceTail(m_params, paramsBegin, params);
+  replaceTail(m_cov, paramsBegin, cov);
+  replaceTail(m_jac, jacBegin, jac);
+  replaceTail(m_sourceLinks, sourceLinkBegin, sourceLinks);
+  replaceTail(m_projectors, projectorBegin, projectors);
+  replaceTail(m_meas, measBegin, meas);
+  replaceTail(m_measCov, measCovBegin, measCov);
+
+  return remap;
+}
+
 void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
     std::ostream& os, size_t n) {
   using namespace boost::histogram;
@@ -9,6 +9,7 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 
 #include <iterator>
+#include <stdexcept>
 
 namespace Acts {
 
@@ -111,6 +112,54 @@ void VectorTrackContainer::ensureDynamicColumns_impl(
   }
 }
 
+void VectorTrackContainer::append(const VectorTrackContainer& other,
+                                  IndexType stateOffset) {
+  if (m_dynamic.size() != other.m_dynamic.size()) {
+    throw std::invalid_argument{
+        "Appended container does not have matching dynamic columns"};
+  }
+  for (const auto& [key, value] : other.m_dynamic) {
+    (void)value;
+    if (m_dynamic.find(key) == m_dynamic.end()) {
+      throw std::invalid_argument{
+          "Appended container does not have matching dynamic columns"};
+    }
+  }
+
+  const IndexType trackOffset = m_tipIndex.size();
+
+  m_tipIndex.reserve(m_tipIndex.size() + other.m_tipIndex.size());
+  for (IndexType tip : other.m_tipIndex) {
+    m_tipIndex.push_back(tip == kInvalid ? kInvalid : tip + stateOffset);
+  }
+
+  auto appendVector = [](auto& vec, const auto& otherVec) {
+    vec.insert(vec.end(), otherVec.begin(), otherVec.end());
+  };
+  appendVector(m_params, other.m_params);
+  appendVector(m_cov, other.m_cov);
+  appendVector(m_referenceSurfaces, other.m_referenceSurfaces);
+
+  appendVector(m_nMeasurements, other.m_nMeasurements);
+  appendVector(m_nHoles, other.m_nHoles);
+
+  appendVector(m_chi2, other.m_chi2);
+  appendVector(m_ndf, other.m_ndf);
+
+  appendVector(m_nOutliers, other.m_nOutliers);
+  appendVector(m_nSharedHits, other.m_nSharedHits);
+
+  for (auto& [key, vec] : m_dynamic) {
+    const auto& otherVec = *other.m_dynamic.at(key);
+    for (IndexType i = 0; i < otherVec.size(); ++i) {
+      vec->add();
+      vec->copyFrom(trackOffset + i, otherVec, i);
+    }
+  }
+
+  assert(checkConsistency());
+}
+
 void VectorTrackContainer::reserve(IndexType size) {
   m_tipIndex.reserve(size);
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <vector>
 
 Acts::Layer::Layer(std::unique_ptr<SurfaceArray> surfaceArray, double thickness,
@@ -122,6 +123,12 @@ Acts::Layer::compatibleSurfaces(
   // reserve a few bins
   sIntersections.reserve(20);
 
+  // the cached placement may not apply to the context, e.g. with alignment
+  const SurfaceCandidateCache* candidateCache =
+      (m_candidateCache && m_candidateCache->isValid(gctx))
+          ? m_candidateCache.get()
+          : nullptr;
+
   // (0) End surface check
   // @todo: - we might be able to skip this by use of options.pathLimit
   // check if you have to stop at the endSurface
@@ -183,6 +190,12 @@ Acts::Layer::compatibleSurfaces(
                   sf.geometryId()) != options.externalSurfaces.end()) {
       boundaryCheck = false;
     }
+    // the cached candidates are unique, only the others can be duplicates
+    if (candidateCache != nullptr && !sensitive &&
+        std::any_of(sIntersections.begin(), sIntersections.end(),
+                    [&sf](const auto& sfi) { return sfi.object == &sf; })) {
+      return;
+    }
     // the surface intersection
     SurfaceIntersection sfi =
         sf.intersect(gctx, position, options.navDir * direction, boundaryCheck);
@@ -216,11 +229,30 @@ Acts::Layer::compatibleSurfaces(
   // (B) sensitive surface section
   //
   // check the sensitive surfaces if you have some
-  if (m_surfaceArray && (options.resolveMaterial || options.resolvePassive ||
-                         options.resolveSensitive)) {
+  if (candidateCache != nullptr &&
+      (options.resolveMaterial || options.resolvePassive ||
+       options.resolveSensitive)) {
+    // the bounding circles can only be used with an absolute boundary check
+    // which applies to all surfaces
+    double tolerance = std::numeric_limits<double>::infinity();
+    if (options.boundaryCheck.type() == BoundaryCheck::Type::eAbsolute &&
+        options.externalSurfaces.empty()) {
+      tolerance = options.boundaryCheck.tolerance().norm();
+    }
+    // pre-select the canditates of the bin
+    SurfaceCandidateCache::Candidates candidates;
+    candidateCache->select(m_surfaceArray->globalBinFromPosition(position),
+                           position, options.navDir * direction, pathLimit,
+                           overstepLimit, tolerance, candidates);
+    for (auto& sSurface : candidates) {
+      processSurface(*sSurface, true);
+    }
+  } else if (m_surfaceArray &&
+             (options.resolveMaterial || options.resolvePassive ||
+              options.resolveSensitive)) {
     // get the canditates
-    const std::vector<const Surface*>& sensitiveSurfaces =
-        m_surfaceArray->neighbors(position);
+    SurfaceArray::SurfaceRange sensitiveSurfaces =
+        m_surfaceArray->neighborRange(position);
     // loop through and veto
     // - if the approach surface is the parameter surface
     // - if the surface is not compatible with the type(s) that are collected
@@ -235,19 +267,22 @@ Acts::Layer::compatibleSurfaces(
   const Surface* layerSurface = &surfaceRepresentation();
   processSurface(*layerSurface);
 
-  // Sort by object address
-  std::sort(sIntersections.begin(), sIntersections.end(),
-            [](const auto& a, const auto& b) { return a.object < b.object; });
-  // Now look for duplicates. As we just sorted by path length, duplicates
-  // should be subsequent
-  auto it = std::unique(
-      sIntersections.begin(), sIntersections.end(),
-      [](const SurfaceIntersection& a, const SurfaceIntersection& b) -> bool {
-        return a.object == b.object;
-      });
+  // the cached candidates are free of duplicates already
+  if (candidateCache == nullptr) {
+    // Sort by object address
+    std::sort(sIntersections.begin(), sIntersections.end(),
+              [](const auto& a, const auto& b) { return a.object < b.object; });
+    // Now look for duplicates. As we just sorted by path length, duplicates
+    // should be subsequent
+    auto it = std::unique(
+        sIntersections.begin(), sIntersections.end(),
+        [](const SurfaceIntersection& a, const SurfaceIntersection& b) -> bool {
+          return a.object == b.object;
+        });
 
-  // resize to remove all items that are past the unique range
-  sIntersections.resize(std::distance(sIntersections.begin(), it));
+    // resize to remove all items that are past the unique range
+    sIntersections.resize(std::distance(sIntersections.begin(), it));
+  }
 
   // sort according to the path length
   if (options.navDir == Direction::Forward) {
@@ -259,6 +294,14 @@ Acts::Layer::compatibleSurfaces(
   return sIntersections;
 }
 
+void Acts::Layer::buildSurfaceCandidateCache(const GeometryContext& gctx) {
+  if (!m_surfaceArray) {
+    return;
+  }
+  m_candidateCache =
+      std::make_unique<const SurfaceCandidateCache>(gctx, *m_surfaceArray);
+}
+
 Acts::SurfaceIntersection Acts::Layer::surfaceOnApproach(
     const GeometryContext& gctx, const Vector3& position,
     const Vector3& direction, const NavigationOptions<Layer>& options) const {
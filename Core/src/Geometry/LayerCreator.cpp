@@ -118,6 +118,9 @@ Acts::MutableLayerPtr Acts::LayerCreator::cylinderLayer(
     ACTS_ERROR("Creation of cylinder layer did not succeed!");
   }
   associateSurfacesToLayer(*cLayer);
+  if (m_cfg.surfaceCandidateCache) {
+    cLayer->buildSurfaceCandidateCache(gctx);
+  }
 
   // now return
   return cLayer;
@@ -191,6 +194,9 @@ Acts::MutableLayerPtr Acts::LayerCreator::cylinderLayer(
     ACTS_ERROR("Creation of cylinder layer did not succeed!");
   }
   associateSurfacesToLayer(*cLayer);
+  if (m_cfg.surfaceCandidateCache) {
+    cLayer->buildSurfaceCandidateCache(gctx);
+  }
 
   // now return
   return cLayer;
@@ -256,6 +262,9 @@ Acts::MutableLayerPtr Acts::LayerCreator::discLayer(
     ACTS_ERROR("Creation of disc layer did not succeed!");
   }
   associateSurfacesToLayer(*dLayer);
+  if (m_cfg.surfaceCandidateCache) {
+    dLayer->buildSurfaceCandidateCache(gctx);
+  }
   // return the layer
   return dLayer;
 }
@@ -317,6 +326,9 @@ Acts::MutableLayerPtr Acts::LayerCreator::discLayer(
     ACTS_ERROR("Creation of disc layer did not succeed!");
   }
   associateSurfacesToLayer(*dLayer);
+  if (m_cfg.surfaceCandidateCache) {
+    dLayer->buildSurfaceCandidateCache(gctx);
+  }
   // return the layer
   return dLayer;
 }
@@ -397,6 +409,9 @@ Acts::MutableLayerPtr Acts::LayerCreator::planeLayer(
     ACTS_ERROR("Creation of plane layer did not succeed!");
   }
   associateSurfacesToLayer(*pLayer);
+  if (m_cfg.surfaceCandidateCache) {
+    pLayer->buildSurfaceCandidateCache(gctx);
+  }
 
   // now return
   return pLayer;
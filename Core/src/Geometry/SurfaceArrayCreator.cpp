@@ -69,8 +69,12 @@ Acts::SurfaceArrayCreator::surfaceArrayOnCylinder(
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
 
-  return std::make_unique<SurfaceArray>(std::move(sl), std::move(surfaces),
-                                        ftransform);
+  auto sArray = std::make_unique<SurfaceArray>(std::move(sl),
+                                               std::move(surfaces), ftransform);
+  if (m_cfg.flatLookup) {
+    sArray->buildFlatLookup();
+  }
+  return sArray;
 }
 
 std::unique_ptr<Acts::SurfaceArray>
@@ -135,8 +139,12 @@ Acts::SurfaceArrayCreator::surfaceArrayOnCylinder(
   ACTS_VERBOSE(" -- with phi x z  = " << bins0 << " x " << bins1 << " = "
                                       << bins0 * bins1 << " bins.");
 
-  return std::make_unique<SurfaceArray>(std::move(sl), std::move(surfaces),
-                                        ftransform);
+  auto sArray = std::make_unique<SurfaceArray>(std::move(sl),
+                                               std::move(surfaces), ftransform);
+  if (m_cfg.flatLookup) {
+    sArray->buildFlatLookup();
+  }
+  return sArray;
 }
 
 std::unique_ptr<Acts::SurfaceArray>
@@ -188,8 +196,12 @@ Acts::SurfaceArrayCreator::surfaceArrayOnDisc(
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
 
-  return std::make_unique<SurfaceArray>(std::move(sl), std::move(surfaces),
-                                        ftransform);
+  auto sArray = std::make_unique<SurfaceArray>(std::move(sl),
+                                               std::move(surfaces), ftransform);
+  if (m_cfg.flatLookup) {
+    sArray->buildFlatLookup();
+  }
+  return sArray;
 }
 
 std::unique_ptr<Acts::SurfaceArray>
@@ -295,8 +307,12 @@ Acts::SurfaceArrayCreator::surfaceArrayOnDisc(
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
 
-  return std::make_unique<SurfaceArray>(std::move(sl), std::move(surfaces),
-                                        ftransform);
+  auto sArray = std::make_unique<SurfaceArray>(std::move(sl),
+                                               std::move(surfaces), ftransform);
+  if (m_cfg.flatLookup) {
+    sArray->buildFlatLookup();
+  }
+  return sArray;
 }
 
 /// SurfaceArrayCreator interface method - create an array on a plane
@@ -371,8 +387,12 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
 
-  return std::make_unique<SurfaceArray>(std::move(sl), std::move(surfaces),
-                                        ftransform);
+  auto sArray = std::make_unique<SurfaceArray>(std::move(sl),
+                                               std::move(surfaces), ftransform);
+  if (m_cfg.flatLookup) {
+    sArray->buildFlatLookup();
+  }
+  return sArray;
   //!< @todo implement - take from ATLAS complex TRT builder
 }
 
@@ -0,0 +1,148 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/SurfaceCandidateCache.hpp"
+
+#include "Acts/Definitions/Tolerance.hpp"
+#include "Acts/Surfaces/PlanarBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/SurfaceBounds.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// Whether the bounds are checked in cartesian coordinates within their
+/// bounding box, such that the bounding circle of the box can be used
+bool hasCartesianBounds(const Acts::SurfaceBounds& bounds) {
+  switch (bounds.type()) {
+    case Acts::SurfaceBounds::eRectangle:
+    case Acts::SurfaceBounds::eTrapezoid:
+    case Acts::SurfaceBounds::eDiamond:
+    case Acts::SurfaceBounds::eConvexPolygon:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+Acts::SurfaceCandidateCache::SurfaceCandidateCache(
+    const GeometryContext& gctx, const SurfaceArray& surfaceArray)
+    : m_neighbors(surfaceArray.neighborTable()),
+      m_nominalContext(!gctx.hasValue()) {
+  const std::vector<const Surface*>& surfaces = m_neighbors->surfaces();
+  m_centerX.reserve(surfaces.size());
+  m_centerY.reserve(surfaces.size());
+  m_centerZ.reserve(surfaces.size());
+  m_normalX.reserve(surfaces.size());
+  m_normalY.reserve(surfaces.size());
+  m_normalZ.reserve(surfaces.size());
+  m_radius.reserve(surfaces.size());
+
+  for (const Surface* surface : surfaces) {
+    const auto type = surface->type();
+    if (type != Surface::Plane and type != Surface::Disc) {
+      // no pre-selection for curved surfaces
+      m_centerX.push_back(0.);
+      m_centerY.push_back(0.);
+      m_centerZ.push_back(0.);
+      m_normalX.push_back(0.);
+      m_normalY.push_back(0.);
+      m_normalZ.push_back(0.);
+      m_radius.push_back(-1.);
+      continue;
+    }
+
+    const Transform3& transform = surface->transform(gctx);
+    Vector3 center = transform.translation();
+    double radius = std::numeric_limits<double>::infinity();
+    if (type == Surface::Plane and hasCartesianBounds(surface->bounds())) {
+      const RectangleBounds& box =
+          static_cast<const PlanarBounds&>(surface->bounds()).boundingBox();
+      const Vector2 boxCenter = 0.5 * (box.min() + box.max());
+      center = transform * Vector3(boxCenter.x(), boxCenter.y(), 0.);
+      radius = 0.5 * (box.max() - box.min()).norm();
+    }
+    const Vector3 normal = transform.matrix().block<3, 1>(0, 2);
+
+    m_centerX.push_back(center.x());
+    m_centerY.push_back(center.y());
+    m_centerZ.push_back(center.z());
+    m_normalX.push_back(normal.x());
+    m_normalY.push_back(normal.y());
+    m_normalZ.push_back(normal.z());
+    m_radius.push_back(radius);
+  }
+}
+
+void Acts::SurfaceCandidateCache::select(std::size_t bin,
+                                         const Vector3& position,
+                                         const Vector3& direction,
+                                         double pathLimit,
+                                         double overstepLimit,
+                                         double tolerance,
+                                         Candidates& candidates) const {
+  // margin against the rounding differences to the exact intersection
+  constexpr double margin = s_onSurfaceTolerance;
+  constexpr std::size_t chunkSize = 16;
+
+  const double px = position.x();
+  const double py = position.y();
+  const double pz = position.z();
+  const double ux = direction.x();
+  const double uy = direction.y();
+  const double uz = direction.z();
+  const double minPath = overstepLimit - margin;
+  const double maxPath = std::abs(pathLimit) + s_onSurfaceTolerance + margin;
+  const double extension = tolerance + margin;
+
+  std::array<bool, chunkSize> keep{};
+  const std::vector<const Surface*>& surfaces = m_neighbors->surfaces();
+  for (std::size_t begin = m_neighbors->offset(bin),
+                   end = m_neighbors->offset(bin + 1);
+       begin < end; begin += chunkSize) {
+    const std::size_t n = std::min(chunkSize, end - begin);
+    for (std::size_t k = 0; k < n; ++k) {
+      const std::size_t i = begin + k;
+      const double dx = m_centerX[i] - px;
+      const double dy = m_centerY[i] - py;
+      const double dz = m_centerZ[i] - pz;
+      // the plane intersection, not a number if parallel to the plane
+      const double s =
+          (m_normalX[i] * dx + m_normalY[i] * dy + m_normalZ[i] * dz) /
+          (m_normalX[i] * ux + m_normalY[i] * uy + m_normalZ[i] * uz);
+      // distance of the intersection to the center of the bounding circle
+      const double ex = s * ux - dx;
+      const double ey = s * uy - dy;
+      const double ez = s * uz - dz;
+      const double distance2 = ex * ex + ey * ey + ez * ez;
+      const double reach = m_radius[i] + extension;
+      keep[k] = m_radius[i] < 0. or
+                (s > minPath and std::abs(s) < maxPath and
+                 distance2 <= reach * reach);
+    }
+    for (std::size_t k = 0; k < n; ++k) {
+      if (keep[k]) {
+        candidates.push_back(surfaces[begin + k]);
+      }
+    }
+  }
+}
+
+std::vector<const Acts::Surface*> Acts::SurfaceCandidateCache::surfaces(
+    std::size_t bin) const {
+  SurfaceArray::SurfaceRange range = m_neighbors->neighbors(bin);
+  return {range.begin(), range.end()};
+}
@@ -19,6 +19,105 @@
 #include <boost/math/special_functions/ellint_1.hpp>
 #include <boost/math/special_functions/ellint_2.hpp>
 
+namespace {
+
+/// Refine the interval (a,b] of a table axis until linear interpolation
+/// between the nodes reproduces the field at the interval midpoint along
+/// all lines within the tolerance. Only the upper edge is added to the nodes.
+template <typename field_t>
+void refineInterval(double a, double b, const std::vector<Acts::Vector2>& fa,
+                    const std::vector<Acts::Vector2>& fb,
+                    const std::vector<double>& lines, const field_t& field,
+                    double tolerance, double minWidth,
+                    std::vector<double>& nodes, double& maxError) {
+  const double m = 0.5 * (a + b);
+  std::vector<Acts::Vector2> fm(lines.size());
+  double error = 0;
+  for (std::size_t l = 0; l < lines.size(); ++l) {
+    fm[l] = field(m, lines[l]);
+    error = std::max(error,
+                     (fm[l] - 0.5 * (fa[l] + fb[l])).cwiseAbs().maxCoeff());
+  }
+  if (error > tolerance and b - a > 2 * minWidth) {
+    refineInterval(a, m, fa, fm, lines, field, tolerance, minWidth, nodes,
+                   maxError);
+    refineInterval(m, b, fm, fb, lines, field, tolerance, minWidth, nodes,
+                   maxError);
+    return;
+  }
+  nodes.push_back(b);
+  maxError = std::max(maxError, error);
+}
+
+/// Build the nodes of a table axis in [min,max], starting from equidistant
+/// intervals which are bisected where needed
+///
+/// @param field callable returning the field at an axis value and line
+template <typename field_t>
+std::vector<double> refineAxis(double min, double max,
+                               const std::vector<double>& lines,
+                               const field_t& field, double tolerance,
+                               double& maxError) {
+  constexpr std::size_t nInitial = 32;
+  const double width = (max - min) / nInitial;
+  const double minWidth = 1e-4 * (max - min);
+
+  auto fieldOnLines = [&](double x) {
+    std::vector<Acts::Vector2> values;
+    for (double line : lines) {
+      values.push_back(field(x, line));
+    }
+    return values;
+  };
+
+  std::vector<double> nodes = {min};
+  std::vector<Acts::Vector2> fa = fieldOnLines(min);
+  for (std::size_t i = 0; i < nInitial; ++i) {
+    const double a = min + i * width;
+    const double b = (i + 1 == nInitial) ? max : a + width;
+    std::vector<Acts::Vector2> fb = fieldOnLines(b);
+    refineInterval(a, b, fa, fb, lines, field, tolerance, minWidth, nodes,
+                   maxError);
+    fa = std::move(fb);
+  }
+  return nodes;
+}
+
+/// Convert the derivatives of (B_r, B_z) with respect to (r, z) to the
+/// derivatives of the cartesian field components
+Acts::ActsMatrix<3, 3> cartesianGradient(
+    const Acts::Vector3& position, const Acts::Vector2& rzField,
+    const Acts::ActsMatrix<2, 2>& rzDerivative) {
+  const double dBrdr = rzDerivative(0, 0);
+  const double dBrdz = rzDerivative(0, 1);
+  const double dBzdr = rzDerivative(1, 0);
+  const double dBzdz = rzDerivative(1, 1);
+
+  Acts::ActsMatrix<3, 3> gradient = Acts::ActsMatrix<3, 3>::Zero();
+  gradient(2, 2) = dBzdz;
+  const double r = Acts::VectorHelpers::perp(position);
+  if (r == 0.) {
+    // B_r vanishes linearly on the axis and B_z is extremal
+    gradient(0, 0) = dBrdr;
+    gradient(1, 1) = dBrdr;
+    return gradient;
+  }
+  const double cosPhi = position.x() / r;
+  const double sinPhi = position.y() / r;
+  const double BrOverR = rzField[0] / r;
+  gradient(0, 0) = dBrdr * cosPhi * cosPhi + BrOverR * sinPhi * sinPhi;
+  gradient(0, 1) = (dBrdr - BrOverR) * cosPhi * sinPhi;
+  gradient(0, 2) = dBrdz * cosPhi;
+  gradient(1, 0) = gradient(0, 1);
+  gradient(1, 1) = dBrdr * sinPhi * sinPhi + BrOverR * cosPhi * cosPhi;
+  gradient(1, 2) = dBrdz * sinPhi;
+  gradient(2, 0) = dBzdr * cosPhi;
+  gradient(2, 1) = dBzdr * sinPhi;
+  return gradient;
+}
+
+}  // namespace
+
 Acts::SolenoidBField::SolenoidBField(Config config) : m_cfg(config) {
   m_dz = m_cfg.length / m_cfg.nCoils;
   m_R2 = m_cfg.radius * m_cfg.radius;
@@ -26,20 +125,102 @@ Acts::SolenoidBField::SolenoidBField(Config config) : m_cfg(config) {
   // at the center of the solenoid
   Vector2 field = multiCoilField({0, 0}, 1.);  // scale = 1
   m_scale = m_cfg.bMagCenter / field.norm();
+
+  if (m_cfg.useTable) {
+    buildTable();
+  }
 }
 
-Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
-    const MagneticFieldContext& mctx) const {
-  return MagneticFieldProvider::Cache::make<Cache>(mctx);
+void Acts::SolenoidBField::buildTable() {
+  const double rMax =
+      m_cfg.tableRMax > 0 ? m_cfg.tableRMax : 0.9 * m_cfg.radius;
+  const double zMax = m_cfg.tableZMax > 0 ? m_cfg.tableZMax : m_cfg.length;
+  // the errors along r and z add up in the bilinear interpolation
+  const double tolerance = 0.5 * m_cfg.tableTolerance * m_cfg.bMagCenter;
+
+  // the z nodes are refined along lines of constant r and vice versa, the
+  // lines include the coil end where the field changes fastest
+  const double zEnd = std::min(0.5 * m_cfg.length, zMax);
+  double errorR = 0;
+  double errorZ = 0;
+  m_tableZ = refineAxis(
+      0., zMax, {0., 0.5 * rMax, rMax},
+      [this](double z, double r) { return multiCoilField({r, z}, m_scale); },
+      tolerance, errorZ);
+  m_tableR = refineAxis(
+      0., rMax, {0., 0.5 * zEnd, zEnd, zMax},
+      [this](double r, double z) { return multiCoilField({r, z}, m_scale); },
+      tolerance, errorR);
+  m_tableErrorEstimate = errorR + errorZ;
+
+  m_tableField.clear();
+  m_tableField.reserve(m_tableR.size() * m_tableZ.size());
+  for (double r : m_tableR) {
+    for (double z : m_tableZ) {
+      m_tableField.push_back(multiCoilField({r, z}, m_scale));
+    }
+  }
 }
 
-Acts::Vector3 Acts::SolenoidBField::getField(const Vector3& position) const {
-  using VectorHelpers::perp;
-  Vector2 rzPos(perp(position), position.z());
-  Vector2 rzField = multiCoilField(rzPos, m_scale);
+bool Acts::SolenoidBField::tableField(double r, double z, Vector2& field,
+                                      ActsMatrix<2, 2>* derivative) const {
+  if (m_tableField.empty()) {
+    return false;
+  }
+  const double absZ = std::abs(z);
+  if (r > m_tableR.back() or absZ > m_tableZ.back()) {
+    return false;
+  }
+
+  // index of the lower node of the interval containing x
+  auto lowerNode = [](const std::vector<double>& nodes, double x) {
+    auto it = std::upper_bound(nodes.begin() + 1, nodes.end() - 1, x);
+    return static_cast<std::size_t>(it - nodes.begin()) - 1;
+  };
+  const std::size_t i = lowerNode(m_tableR, r);
+  const std::size_t j = lowerNode(m_tableZ, absZ);
+  const std::size_t nZ = m_tableZ.size();
+  const double hr = m_tableR[i + 1] - m_tableR[i];
+  const double hz = m_tableZ[j + 1] - m_tableZ[j];
+  const double t = (r - m_tableR[i]) / hr;
+  const double s = (absZ - m_tableZ[j]) / hz;
+
+  const Vector2& f00 = m_tableField[i * nZ + j];
+  const Vector2& f01 = m_tableField[i * nZ + j + 1];
+  const Vector2& f10 = m_tableField[(i + 1) * nZ + j];
+  const Vector2& f11 = m_tableField[(i + 1) * nZ + j + 1];
+
+  field = (1 - t) * (1 - s) * f00 + t * (1 - s) * f10 + (1 - t) * s * f01 +
+          t * s * f11;
+  if (derivative != nullptr) {
+    derivative->col(0) = ((1 - s) * (f10 - f00) + s * (f11 - f01)) / hr;
+    derivative->col(1) = ((1 - t) * (f01 - f00) + t * (f11 - f10)) / hz;
+  }
+
+  // B_r is odd and B_z is even in z
+  if (z < 0) {
+    field[0] = -field[0];
+    if (derivative != nullptr) {
+      (*derivative)(0, 0) = -(*derivative)(0, 0);
+      (*derivative)(1, 1) = -(*derivative)(1, 1);
+    }
+  }
+  return true;
+}
+
+Acts::Vector2 Acts::SolenoidBField::localField(double r, double z) const {
+  Vector2 field;
+  if (tableField(r, z, field, nullptr)) {
+    return field;
+  }
+  return multiCoilField({r, z}, m_scale);
+}
+
+Acts::Vector3 Acts::SolenoidBField::toCartesian(const Vector3& position,
+                                                const Vector2& rzField) const {
   Vector3 xyzField(0, 0, rzField[1]);
 
-  if (rzPos[0] != 0.) {
+  if (position.x() != 0. or position.y() != 0.) {
     // add xy field component, radially symmetric
     Vector3 rDir = Vector3(position.x(), position.y(), 0).normalized();
     xyzField += rDir * rzField[0];
@@ -48,19 +229,55 @@ Acts::Vector3 Acts::SolenoidBField::getField(const Vector3& position) const {
   return xyzField;
 }
 
+Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
+    const MagneticFieldContext& mctx) const {
+  return MagneticFieldProvider::Cache::make<Cache>(mctx);
+}
+
+Acts::Vector3 Acts::SolenoidBField::getField(const Vector3& position) const {
+  using VectorHelpers::perp;
+  return toCartesian(position, localField(perp(position), position.z()));
+}
+
 Acts::Result<Acts::Vector3> Acts::SolenoidBField::getField(
     const Vector3& position, MagneticFieldProvider::Cache& /*cache*/) const {
   return Result<Vector3>::success(getField(position));
 }
 
 Acts::Vector2 Acts::SolenoidBField::getField(const Vector2& position) const {
-  return multiCoilField(position, m_scale);
+  Vector2 field = localField(std::abs(position[0]), position[1]);
+  // position[0] is signed, B_r is odd in r
+  if (position[0] < 0) {
+    field[0] = -field[0];
+  }
+  return field;
 }
 
 Acts::Result<Acts::Vector3> Acts::SolenoidBField::getFieldGradient(
-    const Vector3& position, ActsMatrix<3, 3>& /*derivative*/,
+    const Vector3& position, ActsMatrix<3, 3>& derivative,
     MagneticFieldProvider::Cache& /*cache*/) const {
-  return Result<Vector3>::success(getField(position));
+  using VectorHelpers::perp;
+  const double r = perp(position);
+  const double z = position.z();
+
+  Vector2 rzField;
+  ActsMatrix<2, 2> rzDerivative;
+  if (not tableField(r, z, rzField, &rzDerivative)) {
+    rzField = multiCoilField({r, z}, m_scale);
+    // central differences, one-sided at the axis
+    const double h = 1e-4 * m_cfg.radius;
+    const double r0 = std::max(r - h, 0.);
+    const double r1 = r + h;
+    rzDerivative.col(0) = (multiCoilField({r1, z}, m_scale) -
+                           multiCoilField({r0, z}, m_scale)) /
+                          (r1 - r0);
+    rzDerivative.col(1) = (multiCoilField({r, z + h}, m_scale) -
+                           multiCoilField({r, z - h}, m_scale)) /
+                          (2 * h);
+  }
+
+  derivative = cartesianGradient(position, rzField, rzDerivative);
+  return Result<Vector3>::success(toCartesian(position, rzField));
 }
 
 Acts::Vector2 Acts::SolenoidBField::multiCoilField(const Vector2& pos,
@@ -78,10 +295,6 @@ Acts::Vector2 Acts::SolenoidBField::multiCoilField(const Vector2& pos,
 
 Acts::Vector2 Acts::SolenoidBField::singleCoilField(const Vector2& pos,
                                                     double scale) const {
-  return {B_r(pos, scale), B_z(pos, scale)};
-}
-
-double Acts::SolenoidBField::B_r(const Vector2& pos, double scale) const {
   //              _
   //     2       /  pi / 2          2    2          - 1 / 2
   // E (k )  =   |         ( 1  -  k  sin {theta} )         dtheta
@@ -97,9 +310,18 @@ double Acts::SolenoidBField::B_r(const Vector2& pos, double scale) const {
   double z = pos[1];
 
   if (r == 0) {
-    return 0.;
+    double Bz = scale / 2. * m_R2 / (std::sqrt(m_R2 + z * z) * (m_R2 + z * z));
+    return {0., Bz};
   }
 
+  // both components use the same elliptic integrals. The formulas below are
+  // written in terms of the parameter k^2, while boost::math::ellint_1/2
+  // take the modulus k.
+  double k_2 = k2(r, z);
+  double k = std::sqrt(k_2);
+  double E1 = ellint_1(k);
+  double E2 = ellint_2(k);
+
   //                            _                             _
   //              mu  I        |  /     2 \                    |
   //                0     kz   |  |2 - k  |    2          2    |
@@ -107,31 +329,9 @@ double Acts::SolenoidBField::B_r(const Vector2& pos, double scale) const {
   //  r            4pi     ___ |  |      2| 2          1       |
   //                    | /  3 |_ \2 - 2k /                   _|
   //                    |/ Rr
-  double k_2 = k2(r, z);
-  double k = std::sqrt(k_2);
-  double constant =
+  double constantR =
       scale * k * z / (4 * M_PI * std::sqrt(m_cfg.radius * r * r * r));
-
-  double B = (2. - k_2) / (2. - 2. * k_2) * ellint_2(k_2) - ellint_1(k_2);
-
-  // pos[0] is still signed!
-  return r / pos[0] * constant * B;
-}
-
-double Acts::SolenoidBField::B_z(const Vector2& pos, double scale) const {
-  //              _
-  //     2       /  pi / 2          2    2          - 1 / 2
-  // E (k )  =   |         ( 1  -  k  sin {theta} )         dtheta
-  //  1         _/  0
-  using boost::math::ellint_1;
-  //              _          ____________________
-  //     2       /  pi / 2| /       2    2
-  // E (k )  =   |        |/ 1  -  k  sin {theta} dtheta
-  //  2         _/  0
-  using boost::math::ellint_2;
-
-  double r = std::abs(pos[0]);
-  double z = pos[1];
+  double Br = (2. - k_2) / (2. - 2. * k_2) * E2 - E1;
 
   //                         _                                       _
   //             mu  I      |  /         2      \                     |
@@ -139,20 +339,12 @@ double Acts::SolenoidBField::B_z(const Vector2& pos, double scale) const {
   // B (r,z)  =  ----- ---- |  | -------------- | E (k )  +  E (k )   |
   //  z           4pi    __ |  |           2    |  2          1       |
   //                   |/Rr |_ \   2r(1 - k )   /                    _|
+  double constantZ = scale * k / (4 * M_PI * std::sqrt(m_cfg.radius * r));
+  double Bz =
+      ((m_cfg.radius + r) * k_2 - 2. * r) / (2. * r * (1. - k_2)) * E2 + E1;
 
-  if (r == 0) {
-    double res = scale / 2. * m_R2 / (std::sqrt(m_R2 + z * z) * (m_R2 + z * z));
-    return res;
-  }
-
-  double k_2 = k2(r, z);
-  double k = std::sqrt(k_2);
-  double constant = scale * k / (4 * M_PI * std::sqrt(m_cfg.radius * r));
-  double B = ((m_cfg.radius + r) * k_2 - 2. * r) / (2. * r * (1. - k_2)) *
-                 ellint_2(k_2) +
-             ellint_1(k_2);
-
-  return constant * B;
+  // pos[0] is still signed!
+  return {r / pos[0] * constantR * Br, constantZ * Bz};
 }
 
 double Acts::SolenoidBField::k2(double r, double z) const {
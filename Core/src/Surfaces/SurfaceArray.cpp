@@ -13,6 +13,8 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/ThrowAssert.hpp"
 
+#include <algorithm>
+#include <stdexcept>
 #include <utility>
 
 // implementation for pure virtual destructor of ISurfaceGridLookup
@@ -34,6 +36,109 @@ Acts::SurfaceArray::SurfaceArray(std::shared_ptr<const Surface> srf)
   m_surfacesRawPointers.push_back(m_surfaces.at(0).get());
 }
 
+Acts::SurfaceArray::NeighborTable::NeighborTable(
+    const ISurfaceGridLookup& gridLookup) {
+  m_offsets.reserve(gridLookup.size() + 1);
+  m_offsets.push_back(0);
+  for (size_t bin = 0; bin < gridLookup.size(); ++bin) {
+    size_t first = m_surfaces.size();
+    for (const Surface* srf : gridLookup.neighbors(bin)) {
+      if (std::find(m_surfaces.begin() + first, m_surfaces.end(), srf) ==
+          m_surfaces.end()) {
+        m_surfaces.push_back(srf);
+      }
+    }
+    m_offsets.push_back(m_surfaces.size());
+  }
+}
+
+Acts::SurfaceArray::FlatSurfaceGridLookup::FlatSurfaceGridLookup(
+    const ISurfaceGridLookup& gridLookup, const Transform3& transform,
+    LookupCoordinates coordinates)
+    : m_axes(makeAxes(gridLookup.getAxes())),
+      m_stride(gridLookup.getAxes()[1]->getNBins() + 2),
+      m_transform(transform),
+      m_coordinates(coordinates),
+      m_neighbors(std::make_shared<const NeighborTable>(gridLookup)) {}
+
+std::array<Acts::SurfaceArray::FlatSurfaceGridLookup::AnyAxis, 2>
+Acts::SurfaceArray::FlatSurfaceGridLookup::makeAxes(
+    const std::vector<const IAxis*>& axes) {
+  throw_assert(axes.size() == 2, "Only grids with two axes are supported");
+  return {makeAxis(*axes[0]), makeAxis(*axes[1])};
+}
+
+Acts::SurfaceArray::FlatSurfaceGridLookup::AnyAxis
+Acts::SurfaceArray::FlatSurfaceGridLookup::makeAxis(const IAxis& axis) {
+  using detail::AxisBoundaryType;
+  using detail::AxisType;
+
+  if (axis.isEquidistant()) {
+    const ActsScalar min = axis.getMin();
+    const ActsScalar max = axis.getMax();
+    const size_t nBins = axis.getNBins();
+    switch (axis.getBoundaryType()) {
+      case AxisBoundaryType::Open:
+        return detail::Axis<AxisType::Equidistant, AxisBoundaryType::Open>(
+            min, max, nBins);
+      case AxisBoundaryType::Bound:
+        return detail::Axis<AxisType::Equidistant, AxisBoundaryType::Bound>(
+            min, max, nBins);
+      case AxisBoundaryType::Closed:
+        return detail::Axis<AxisType::Equidistant, AxisBoundaryType::Closed>(
+            min, max, nBins);
+    }
+  }
+  switch (axis.getBoundaryType()) {
+    case AxisBoundaryType::Open:
+      return detail::Axis<AxisType::Variable, AxisBoundaryType::Open>(
+          axis.getBinEdges());
+    case AxisBoundaryType::Bound:
+      return detail::Axis<AxisType::Variable, AxisBoundaryType::Bound>(
+          axis.getBinEdges());
+    case AxisBoundaryType::Closed:
+      break;
+  }
+  return detail::Axis<AxisType::Variable, AxisBoundaryType::Closed>(
+      axis.getBinEdges());
+}
+
+void Acts::SurfaceArray::buildFlatLookup() {
+  m_flat.reset();
+  if (p_gridLookup->dimensions() != 2) {
+    return;
+  }
+
+  const std::vector<BinningValue> bValues = p_gridLookup->binningValues();
+  LookupCoordinates coordinates = LookupCoordinates::ePlane;
+  if (bValues == std::vector<BinningValue>{binPhi, binZ}) {
+    coordinates = LookupCoordinates::eCylinder;
+  } else if (bValues == std::vector<BinningValue>{binR, binPhi}) {
+    coordinates = LookupCoordinates::eDisc;
+  }
+
+  FlatSurfaceGridLookup flat(*p_gridLookup, m_transform, coordinates);
+  // the grid lookup converts positions with its own transform, make sure
+  // that both agree on the bins
+  for (size_t bin = 0; bin < p_gridLookup->size(); ++bin) {
+    if (p_gridLookup->isValidBin(bin) &&
+        flat.globalBinFromPosition(p_gridLookup->getBinCenter(bin)) != bin) {
+      throw std::invalid_argument(
+          "SurfaceArray: the local coordinates of the flat lookup do not "
+          "match the grid lookup");
+    }
+  }
+  m_flat.emplace(std::move(flat));
+}
+
+std::shared_ptr<const Acts::SurfaceArray::NeighborTable>
+Acts::SurfaceArray::neighborTable() const {
+  if (m_flat) {
+    return m_flat->neighborTable();
+  }
+  return std::make_shared<const NeighborTable>(*p_gridLookup);
+}
+
 std::ostream& Acts::SurfaceArray::toStream(const GeometryContext& /*gctx*/,
                                            std::ostream& sl) const {
   sl << std::fixed << std::setprecision(4);
@@ -52,4 +52,61 @@ double MeasurementSelector::calculateChi2(
   });
 }
 
+void MeasurementSelector::calculateChi2Batch(
+    unsigned int calibratedSize, std::size_t n,
+    const double* const* calibrated,
+    const double* const* calibratedCovariance,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Parameters predicted,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Covariance predictedCovariance,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Projector projector,
+    double* chi2) const {
+  // The measurements are first gathered into contiguous buffers, so that the
+  // chi2 loops below can be vectorized
+  if (calibratedSize == 1) {
+    const auto H = projector.template topLeftCorner<1, eBoundSize>().eval();
+    const double x = (H * predicted)(0);
+    const double p = (H * predictedCovariance * H.transpose())(0, 0);
+
+    boost::container::small_vector<double, 16> res(n);
+    boost::container::small_vector<double, 16> var(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      res[i] = calibrated[i][0] - x;
+      var[i] = calibratedCovariance[i][0] + p;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      chi2[i] = res[i] * res[i] / var[i];
+    }
+    return;
+  }
+
+  // two dimensional measurements
+  const auto H = projector.template topLeftCorner<2, eBoundSize>().eval();
+  const ActsVector<2> x = H * predicted;
+  const ActsSymMatrix<2> p = H * predictedCovariance * H.transpose();
+
+  // residual and the symmetric residual covariance [[a, b], [b, c]]
+  boost::container::small_vector<double, 16> res0(n);
+  boost::container::small_vector<double, 16> res1(n);
+  boost::container::small_vector<double, 16> a(n);
+  boost::container::small_vector<double, 16> b(n);
+  boost::container::small_vector<double, 16> c(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    res0[i] = calibrated[i][0] - x[0];
+    res1[i] = calibrated[i][1] - x[1];
+    // the covariance is stored column major
+    a[i] = calibratedCovariance[i][0] + p(0, 0);
+    b[i] = calibratedCovariance[i][1] + p(1, 0);
+    c[i] = calibratedCovariance[i][3] + p(1, 1);
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    const double det = a[i] * c[i] - b[i] * b[i];
+    chi2[i] = (c[i] * res0[i] * res0[i] - 2 * b[i] * res0[i] * res1[i] +
+               a[i] * res1[i] * res1[i]) /
+              det;
+  }
+}
+
 }  // namespace Acts
@@ -14,7 +14,11 @@
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <utility>
 
 #include <Eigen/src/Core/MatrixBase.h>
@@ -94,4 +98,238 @@ std::tuple<double, std::error_code> GainMatrixUpdater::visitMeasurement(
   return {chi2, error};
 }
 
+namespace {
+
+/// Bound parameter indices selected by a projector row by row, if the
+/// projector only selects parameters without mixing them
+template <typename projector_t>
+std::optional<std::uint64_t> selectionKey(const projector_t& projector,
+                                          unsigned int calibratedSize) {
+  std::uint64_t key = calibratedSize;
+  for (unsigned int row = 0; row < calibratedSize; ++row) {
+    std::optional<unsigned int> selected;
+    for (unsigned int col = 0; col < eBoundSize; ++col) {
+      const double value = projector(row, col);
+      if (value == 1 and not selected.has_value()) {
+        selected = col;
+      } else if (value != 0) {
+        return std::nullopt;
+      }
+    }
+    if (not selected.has_value()) {
+      return std::nullopt;
+    }
+    key |= static_cast<std::uint64_t>(*selected) << (4 + 3 * row);
+  }
+  return key;
+}
+
+/// Number of track states updated together in one pass
+constexpr std::size_t kLanes = 16;
+
+/// Kalman update of up to @c kLanes track states with the same projector
+///
+/// All quantities are gathered into arrays with the track states as the
+/// innermost dimension, so that every loop over the states is a fixed size
+/// loop which can be vectorized. Unused lanes repeat the first track state.
+template <std::size_t kMeasurementSize, typename state_t>
+void updateLanes(const std::vector<state_t>& states, const std::size_t* group,
+                 std::size_t n,
+                 const std::array<unsigned int, kMeasurementSize>& idx,
+                 std::vector<double>& chi2,
+                 std::vector<std::error_code>& errors,
+                 std::error_code failure) {
+  constexpr std::size_t D = kMeasurementSize;
+  constexpr std::size_t B = eBoundSize;
+  using Lanes = std::array<double, kLanes>;
+
+  std::array<Lanes, B> x;
+  std::array<std::array<Lanes, B>, B> P;
+  std::array<Lanes, D> r;
+  std::array<std::array<Lanes, D>, D> S;
+  std::array<std::array<Lanes, D>, D> Sinv;
+  std::array<std::array<Lanes, D>, B> K;
+  Lanes tmp;
+
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    const auto& state = states[group[l < n ? l : 0]];
+    for (std::size_t i = 0; i < B; ++i) {
+      x[i][l] = state.predicted[i];
+      for (std::size_t j = 0; j < B; ++j) {
+        P[i][j][l] = state.predictedCovariance(i, j);
+      }
+    }
+    for (std::size_t a = 0; a < D; ++a) {
+      r[a][l] = state.calibrated[a];
+      for (std::size_t b = 0; b < D; ++b) {
+        // the measurement covariance is stored column-major
+        S[a][b][l] = state.calibratedCovariance[b * D + a];
+      }
+    }
+  }
+
+  // residual covariance S = H P H^T + V and the predicted residual
+  for (std::size_t a = 0; a < D; ++a) {
+    for (std::size_t b = 0; b < D; ++b) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        S[a][b][l] += P[idx[a]][idx[b]][l];
+      }
+    }
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      r[a][l] -= x[idx[a]][l];
+    }
+  }
+
+  // invert S with Gauss-Jordan elimination, S is symmetric positive definite
+  // so pivoting is not needed
+  for (std::size_t a = 0; a < D; ++a) {
+    for (std::size_t b = 0; b < D; ++b) {
+      Sinv[a][b].fill(a == b ? 1. : 0.);
+    }
+  }
+  for (std::size_t k = 0; k < D; ++k) {
+    for (std::size_t l = 0; l < kLanes; ++l) {
+      tmp[l] = 1. / S[k][k][l];
+    }
+    for (std::size_t b = 0; b < D; ++b) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        S[k][b][l] *= tmp[l];
+        Sinv[k][b][l] *= tmp[l];
+      }
+    }
+    for (std::size_t a = 0; a < D; ++a) {
+      if (a == k) {
+        continue;
+      }
+      tmp = S[a][k];
+      for (std::size_t b = 0; b < D; ++b) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+          S[a][b][l] -= tmp[l] * S[k][b][l];
+          Sinv[a][b][l] -= tmp[l] * Sinv[k][b][l];
+        }
+      }
+    }
+  }
+
+  // gain matrix K = P H^T S^-1
+  for (std::size_t i = 0; i < B; ++i) {
+    for (std::size_t a = 0; a < D; ++a) {
+      K[i][a].fill(0.);
+      for (std::size_t b = 0; b < D; ++b) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+          K[i][a][l] += P[i][idx[b]][l] * Sinv[b][a][l];
+        }
+      }
+    }
+  }
+
+  // chi2 = r^T S^-1 r, which equals the chi2 of the filtered residual
+  tmp.fill(0.);
+  for (std::size_t a = 0; a < D; ++a) {
+    for (std::size_t b = 0; b < D; ++b) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        tmp[l] += r[a][l] * Sinv[a][b][l] * r[b][l];
+      }
+    }
+  }
+
+  // filtered covariance P - K H P, only the upper triangle as it is symmetric
+  std::array<std::array<Lanes, B>, D> HP;
+  for (std::size_t a = 0; a < D; ++a) {
+    HP[a] = P[idx[a]];
+  }
+  for (std::size_t i = 0; i < B; ++i) {
+    for (std::size_t j = i; j < B; ++j) {
+      for (std::size_t a = 0; a < D; ++a) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+          P[i][j][l] -= K[i][a][l] * HP[a][j][l];
+        }
+      }
+    }
+  }
+
+  // filtered parameters x + K r
+  for (std::size_t i = 0; i < B; ++i) {
+    for (std::size_t a = 0; a < D; ++a) {
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        x[i][l] += K[i][a][l] * r[a][l];
+      }
+    }
+  }
+
+  for (std::size_t l = 0; l < n; ++l) {
+    const std::size_t istate = group[l];
+    bool valid = true;
+    for (std::size_t i = 0; i < B; ++i) {
+      for (std::size_t a = 0; a < D; ++a) {
+        valid = valid and not std::isnan(K[i][a][l]);
+      }
+    }
+    if (not valid) {
+      errors[istate] = failure;
+      continue;
+    }
+
+    auto state = states[istate];
+    for (std::size_t i = 0; i < B; ++i) {
+      state.filtered[i] = x[i][l];
+      for (std::size_t j = i; j < B; ++j) {
+        state.filteredCovariance(i, j) = P[i][j][l];
+        state.filteredCovariance(j, i) = P[i][j][l];
+      }
+    }
+    chi2[istate] = tmp[l];
+  }
+}
+
+}  // namespace
+
+void GainMatrixUpdater::visitMeasurementBatch(
+    const std::vector<InternalTrackState>& states, std::vector<double>& chi2,
+    std::vector<std::error_code>& errors, Direction direction,
+    const Logger& logger) const {
+  const std::error_code failure =
+      (direction == Direction::Forward)
+          ? KalmanFitterError::ForwardUpdateFailed
+          : KalmanFitterError::BackwardUpdateFailed;
+
+  // group the states by their projector, there are only a few different
+  // ones. States with a projector that mixes parameters are updated one by one
+  std::vector<std::pair<std::uint64_t, std::vector<std::size_t>>> groups;
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    auto key = selectionKey(states[i].projector, states[i].calibratedSize);
+    if (not key.has_value()) {
+      std::tie(chi2[i], errors[i]) =
+          visitMeasurement(states[i], direction, logger);
+      continue;
+    }
+    auto it = std::find_if(groups.begin(), groups.end(),
+                           [&](const auto& g) { return g.first == *key; });
+    if (it == groups.end()) {
+      it = groups.emplace(groups.end(), *key, std::vector<std::size_t>{});
+      it->second.reserve(states.size() - i);
+    }
+    it->second.push_back(i);
+  }
+
+  for (const auto& [key, group] : groups) {
+    visit_measurement(states[group.front()].calibratedSize, [&](auto N) {
+      constexpr std::size_t kMeasurementSize = decltype(N)::value;
+      std::array<unsigned int, kMeasurementSize> idx{};
+      for (std::size_t a = 0; a < kMeasurementSize; ++a) {
+        idx[a] = (key >> (4 + 3 * a)) & 0x7;
+      }
+      ACTS_VERBOSE("Update " << group.size()
+                             << " track states with measurement dimension "
+                             << kMeasurementSize);
+      for (std::size_t offset = 0; offset < group.size(); offset += kLanes) {
+        updateLanes<kMeasurementSize>(
+            states, group.data() + offset,
+            std::min(kLanes, group.size() - offset), idx, chi2, errors,
+            failure);
+      }
+    });
+  }
+}
+
 }  // namespace Acts
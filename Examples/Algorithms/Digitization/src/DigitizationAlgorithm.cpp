@@ -137,8 +137,8 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
 
   // Prepare output containers
   // need list here for stable addresses
-  IndexSourceLinkContainer sourceLinks;
-  MeasurementContainer measurements;
+  auto sourceLinks = ctx.acquire<IndexSourceLinkContainer>();
+  auto measurements = ctx.acquire<MeasurementContainer>();
   ClusterContainer clusters;
   IndexMultimap<ActsFatras::Barcode> measurementParticlesMap;
   IndexMultimap<Index> measurementSimHitsMap;
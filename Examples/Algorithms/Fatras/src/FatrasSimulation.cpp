@@ -254,20 +254,20 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
              << " simulated particles (final state)");
   ACTS_DEBUG(simHitsUnordered.size() << " simulated hits");
 
-  // order output containers
+  // order output containers, the hits are filled into a recycled container
+  auto simHits = ctx.acquire<SimHitContainer>();
 #if BOOST_VERSION >= 107800
   SimParticleContainer particlesInitial(particlesInitialUnordered.begin(),
                                         particlesInitialUnordered.end());
   SimParticleContainer particlesFinal(particlesFinalUnordered.begin(),
                                       particlesFinalUnordered.end());
-  SimHitContainer simHits(simHitsUnordered.begin(), simHitsUnordered.end());
+  simHits.insert(simHitsUnordered.begin(), simHitsUnordered.end());
 #else
   // working around a nasty boost bug
   // https://github.com/boostorg/container/issues/244
 
   SimParticleContainer particlesInitial;
   SimParticleContainer particlesFinal;
-  SimHitContainer simHits;
 
   particlesInitial.reserve(particlesInitialUnordered.size());
   particlesFinal.reserve(particlesFinalUnordered.size());
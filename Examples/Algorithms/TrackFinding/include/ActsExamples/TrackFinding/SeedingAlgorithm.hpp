@@ -64,6 +64,18 @@ class SeedingAlgorithm final : public IAlgorithm {
     // number of phiBin neighbors at each side of the current bin that will be
     // used to search for SPs
     int numPhiNeighbors = 0;
+
+    // run the doublet search on a structure-of-arrays copy of the space point
+    // grid, this produces the same seeds
+    bool useSpacePointGridSoA = false;
+
+    // number of tasks the groups of middle space points of one event are
+    // split into. With more than one task the groups are processed in
+    // parallel, each task with its own seeding state, and the seeds are merged
+    // in group order. The seeds are identical to the single task result. With
+    // seed confirmation the groups depend on each other through the space
+    // point quality, so they are always processed in a single task.
+    std::size_t numSeedingTasks = 1;
   };
 
   /// Construct the seeding algorithm.
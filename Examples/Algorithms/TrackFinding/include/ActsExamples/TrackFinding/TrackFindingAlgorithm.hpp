@@ -91,6 +91,14 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     Acts::MeasurementSelector::Config measurementSelectorCfg;
     /// Compute shared hit information
     bool computeSharedHits = false;
+    /// Number of tasks the seeds of one event are split into. With more than
+    /// one task, contiguous ranges of seeds are processed in parallel into
+    /// separate track containers. These are appended in seed order, which
+    /// gives the same output as the sequential processing.
+    std::size_t numFindingTasks = 1;
+    /// Compact the track states of a seed once the fraction of abandoned
+    /// branches exceeds this value, 1 disables the compaction
+    double compactionThreshold = 1;
   };
 
   /// Constructor of the track finding algorithm
@@ -14,14 +14,18 @@
 #include "Acts/Seeding/BinFinder.hpp"
 #include "Acts/Seeding/BinnedSPGroup.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/InternalSpacePointStorage.hpp"
 #include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SpacePointGridSoA.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Range1D.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <csignal>
 #include <cstddef>
@@ -205,6 +209,16 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
         });
   }
 
+  // The seed filter only reads the space point quality, which is written by
+  // the seeds of previous groups, with seed confirmation. Without it the
+  // groups are independent and can be split into tasks.
+  if (m_cfg.numSeedingTasks > 1 and m_cfg.seedFilterConfig.seedConfirmation) {
+    ACTS_WARNING("Seed confirmation requires the groups to be processed in "
+                 "order, using a single seeding task instead of "
+                 << m_cfg.numSeedingTasks);
+    m_cfg.numSeedingTasks = 1;
+  }
+
   m_bottomBinFinder = std::make_shared<const Acts::BinFinder<SimSpacePoint>>(
       m_cfg.zBinNeighborsBottom, m_cfg.numPhiNeighbors);
   m_topBinFinder = std::make_shared<const Acts::BinFinder<SimSpacePoint>>(
@@ -251,10 +265,20 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
   auto grid = Acts::SpacePointGridCreator::createGrid<SimSpacePoint>(
       m_cfg.gridConfig, m_cfg.gridOptions);
 
+  // The internal space points are kept in a storage that is reused between
+  // events. With parallel tasks a thread waiting for them can pick up the
+  // seeding of another event, so the storage has to be local then.
+  static thread_local Acts::InternalSpacePointStorage<SimSpacePoint>
+      threadSpacePointStorage;
+  Acts::InternalSpacePointStorage<SimSpacePoint> eventSpacePointStorage;
+  auto& spacePointStorage = m_cfg.numSeedingTasks > 1
+                                ? eventSpacePointStorage
+                                : threadSpacePointStorage;
+
   auto spacePointsGrouping = Acts::BinnedSPGroup<SimSpacePoint>(
       spacePointPtrs.begin(), spacePointPtrs.end(), extractGlobalQuantities,
       m_bottomBinFinder, m_topBinFinder, std::move(grid), rRangeSPExtent,
-      m_cfg.seedFinderConfig, m_cfg.seedFinderOptions);
+      m_cfg.seedFinderConfig, m_cfg.seedFinderOptions, &spacePointStorage);
 
   // safely clamp double to float
   float up = Acts::clampValue<float>(
@@ -266,15 +290,17 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
           m_cfg.seedFinderConfig.deltaRMiddleMinSPRange,
       up - m_cfg.seedFinderConfig.deltaRMiddleMaxSPRange);
 
-  // run the seeding
-  static thread_local SimSeedContainer seeds;
-  seeds.clear();
-  static thread_local decltype(m_seedFinder)::SeedingState state;
-  state.spacePointData.resize(
-      spacePointPtrs.size(),
-      m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo);
+  using SeedingState = decltype(m_seedFinder)::SeedingState;
 
-  if (m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo) {
+  // prepare the space point data of a seeding state for this event
+  auto prepareState = [&](SeedingState& seedingState) {
+    seedingState.spacePointData.resize(
+        spacePointPtrs.size(),
+        m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo);
+
+    if (not m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo) {
+      return;
+    }
     for (std::size_t grid_glob_bin(0);
          grid_glob_bin < spacePointsGrouping.grid().size(); ++grid_glob_bin) {
       const auto& collection = spacePointsGrouping.grid().at(grid_glob_bin);
@@ -290,22 +316,104 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
         const Acts::Vector3 bottomStripDirection =
             m_cfg.seedFinderConfig.getBottomStripDirection(sp->sp());
 
-        state.spacePointData.setTopStripVector(
+        seedingState.spacePointData.setTopStripVector(
             index, topHalfStripLength * topStripDirection);
-        state.spacePointData.setBottomStripVector(
+        seedingState.spacePointData.setBottomStripVector(
             index, bottomHalfStripLength * bottomStripDirection);
-        state.spacePointData.setStripCenterDistance(
+        seedingState.spacePointData.setStripCenterDistance(
             index, m_cfg.seedFinderConfig.getStripCenterDistance(sp->sp()));
-        state.spacePointData.setTopStripCenterPosition(
+        seedingState.spacePointData.setTopStripCenterPosition(
             index, m_cfg.seedFinderConfig.getTopStripCenterPosition(sp->sp()));
       }
     }
+  };
+
+  // run the seeding for one group of middle space points
+  auto createSeeds = [&](SeedingState& seedingState,
+                         const Acts::SpacePointGridSoA<SimSpacePoint>* gridSoA,
+                         SimSeedContainer& groupSeeds, const auto& group) {
+    const auto& [bottom, middle, top] = group;
+    if (gridSoA != nullptr) {
+      m_seedFinder.createSeedsForGroup(
+          m_cfg.seedFinderOptions, seedingState, spacePointsGrouping.grid(),
+          *gridSoA, std::back_inserter(groupSeeds), bottom, middle, top,
+          rMiddleSPRange);
+    } else {
+      m_seedFinder.createSeedsForGroup(
+          m_cfg.seedFinderOptions, seedingState, spacePointsGrouping.grid(),
+          std::back_inserter(groupSeeds), bottom, middle, top, rMiddleSPRange);
+    }
+  };
+
+  if (m_cfg.numSeedingTasks > 1) {
+    // Nothing here may be static thread_local: a thread waiting for the tasks
+    // can pick up the seeding of another event.
+    Acts::SpacePointGridSoA<SimSpacePoint> gridSoA;
+    if (m_cfg.useSpacePointGridSoA) {
+      gridSoA.fill(spacePointsGrouping.grid());
+    }
+
+    std::vector<decltype(*spacePointsGrouping.begin())> groups;
+    for (const auto& group : spacePointsGrouping) {
+      groups.push_back(group);
+    }
+
+    // The split into tasks only depends on the configuration, so that the
+    // seeds do not depend on the number of threads
+    const std::size_t nTasks = std::min(m_cfg.numSeedingTasks, groups.size());
+    std::vector<SimSeedContainer> taskSeeds(nTasks);
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          SeedingState taskState;
+          for (std::size_t task = range.begin(); task != range.end(); ++task) {
+            prepareState(taskState);
+            const std::size_t first = task * groups.size() / nTasks;
+            const std::size_t last = (task + 1) * groups.size() / nTasks;
+            for (std::size_t i = first; i < last; ++i) {
+              createSeeds(taskState,
+                          m_cfg.useSpacePointGridSoA ? &gridSoA : nullptr,
+                          taskSeeds[task], groups[i]);
+            }
+          }
+        });
+
+    // merge in group order
+    std::size_t nSeeds = 0;
+    for (const auto& tSeeds : taskSeeds) {
+      nSeeds += tSeeds.size();
+    }
+    SimSeedContainer seeds;
+    seeds.reserve(nSeeds);
+    for (auto& tSeeds : taskSeeds) {
+      std::move(tSeeds.begin(), tSeeds.end(), std::back_inserter(seeds));
+    }
+
+    ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
+                          << spacePointPtrs.size() << " space points in "
+                          << nTasks << " tasks");
+
+    m_outputSeeds(ctx, std::move(seeds));
+    return ActsExamples::ProcessCode::SUCCESS;
   }
 
-  for (const auto [bottom, middle, top] : spacePointsGrouping) {
-    m_seedFinder.createSeedsForGroup(
-        m_cfg.seedFinderOptions, state, spacePointsGrouping.grid(),
-        std::back_inserter(seeds), bottom, middle, top, rMiddleSPRange);
+  // run the seeding
+  static thread_local SimSeedContainer seeds;
+  seeds.clear();
+  static thread_local SeedingState state;
+  prepareState(state);
+
+  if (m_cfg.useSpacePointGridSoA) {
+    static thread_local Acts::SpacePointGridSoA<SimSpacePoint> gridSoA;
+    gridSoA.fill(spacePointsGrouping.grid());
+    for (const auto& group : spacePointsGrouping) {
+      createSeeds(state, &gridSoA, seeds, group);
+    }
+  } else {
+    for (const auto& group : spacePointsGrouping) {
+      createSeeds(state, nullptr, seeds, group);
+    }
   }
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
@@ -132,7 +132,7 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
         meas);
   };
 
-  SimSpacePointContainer spacePoints;
+  auto spacePoints = ctx.acquire<SimSpacePointContainer>();
   for (Acts::GeometryIdentifier geoId : m_cfg.geometrySelection) {
     // select volume/layer depending on what is set in the geometry id
     auto range = selectLowestNonZeroGeometryObject(sourceLinks, geoId);
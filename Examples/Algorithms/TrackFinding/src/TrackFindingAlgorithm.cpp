@@ -25,8 +25,11 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -94,47 +97,92 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
       .connect<&Acts::MeasurementSelector::select<Acts::VectorMultiTrajectory>>(
           &measSel);
 
-  IndexSourceLinkAccessor slAccessor;
-  slAccessor.container = &sourceLinks;
-  Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
+  // the source links on a surface are looked up in a table built once per
+  // event instead of a binary search at every surface
+  DenseIndexSourceLinkAccessor slAccessor(sourceLinks);
+  Acts::SourceLinkAccessorDelegate<DenseIndexSourceLinkAccessor::Iterator>
       slAccessorDelegate;
-  slAccessorDelegate.connect<&IndexSourceLinkAccessor::range>(&slAccessor);
+  slAccessorDelegate.connect<&DenseIndexSourceLinkAccessor::range>(
+      &slAccessor);
 
   // Set the CombinatorialKalmanFilter options
   ActsExamples::TrackFindingAlgorithm::TrackFinderOptions options(
       ctx.geoContext, ctx.magFieldContext, ctx.calibContext, slAccessorDelegate,
       extensions, pOptions, &(*pSurface));
+  options.compactionThreshold = m_cfg.compactionThreshold;
 
   // Perform the track finding for all initial parameters
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
 
-  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  // Find the tracks for a single seed, which are numbered starting at one
+  auto findTracks = [&](std::size_t iseed, TrackContainer& tracks) {
+    Acts::TrackAccessor<unsigned int> seedNumber("trackGroup");
 
-  TrackContainer tracks(trackContainer, trackStateContainer);
-
-  tracks.addColumn<unsigned int>("trackGroup");
-  Acts::TrackAccessor<unsigned int> seedNumber("trackGroup");
-
-  unsigned int nSeed = 0;
-
-  for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
     auto result =
         (*m_cfg.findTracks)(initialParameters.at(iseed), options, tracks);
     m_nTotalSeeds++;
-    nSeed++;
 
     if (!result.ok()) {
       m_nFailedSeeds++;
       ACTS_WARNING("Track finding failed for seed " << iseed << " with error"
                                                     << result.error());
-      continue;
+      return;
     }
 
     auto& tracksForSeed = result.value();
     for (auto& track : tracksForSeed) {
-      seedNumber(track) = nSeed;
+      seedNumber(track) = iseed + 1;
+    }
+  };
+
+  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+
+  TrackContainer tracks(trackContainer, trackStateContainer);
+
+  tracks.addColumn<unsigned int>("trackGroup");
+
+  const std::size_t nTasks =
+      std::min(m_cfg.numFindingTasks, initialParameters.size());
+  if (nTasks > 1) {
+    // Each task processes a contiguous range of seeds into its own
+    // containers. Appending them in seed order reproduces the containers of
+    // the sequential processing.
+    std::vector<std::shared_ptr<Acts::VectorTrackContainer>>
+        taskTrackContainers(nTasks);
+    std::vector<std::shared_ptr<Acts::VectorMultiTrajectory>>
+        taskTrackStateContainers(nTasks);
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t task = range.begin(); task != range.end(); ++task) {
+            taskTrackContainers[task] =
+                std::make_shared<Acts::VectorTrackContainer>();
+            taskTrackStateContainers[task] =
+                std::make_shared<Acts::VectorMultiTrajectory>();
+            TrackContainer taskTracks(taskTrackContainers[task],
+                                      taskTrackStateContainers[task]);
+            taskTracks.addColumn<unsigned int>("trackGroup");
+
+            const std::size_t nSeeds = initialParameters.size();
+            const std::size_t first = task * nSeeds / nTasks;
+            const std::size_t last = (task + 1) * nSeeds / nTasks;
+            for (std::size_t iseed = first; iseed < last; ++iseed) {
+              findTracks(iseed, taskTracks);
+            }
+          }
+        });
+
+    for (std::size_t task = 0; task < nTasks; ++task) {
+      auto stateOffset =
+          trackStateContainer->append(*taskTrackStateContainers[task]);
+      trackContainer->append(*taskTrackContainers[task], stateOffset);
+    }
+  } else {
+    for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
+      findTracks(iseed, tracks);
     }
   }
 
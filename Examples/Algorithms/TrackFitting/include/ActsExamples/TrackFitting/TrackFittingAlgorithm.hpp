@@ -19,6 +19,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -52,6 +53,11 @@ class TrackFittingAlgorithm final : public IAlgorithm {
     int pickTrack = -1;
     // Type erased calibrator for the measurements
     std::shared_ptr<MeasurementCalibrator> calibrator;
+    // number of tasks the proto tracks of one event are split into. With more
+    // than one task, contiguous chunks of proto tracks are fitted in parallel
+    // into separate track containers, which are appended to the output in
+    // input order. The fitter function must be safe to call concurrently.
+    std::size_t numFittingTasks = 1;
   };
 
   /// Constructor of the fitting algorithm
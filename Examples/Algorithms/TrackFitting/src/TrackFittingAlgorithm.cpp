@@ -22,7 +22,10 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <ostream>
@@ -98,16 +101,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
       ctx.geoContext, ctx.magFieldContext, ctx.calibContext, pSurface.get(),
       Acts::PropagatorPlainOptions()};
 
-  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
-  TrackContainer tracks(trackContainer, trackStateContainer);
-
-  // Perform the fit for each input track
-  std::vector<Acts::SourceLink> trackSourceLinks;
-  for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+  // Fit a single track into the given container, returns false if the
+  // proto track is invalid and the processing must be aborted
+  auto fitTrack = [&](std::size_t itrack, TrackContainer& tracks,
+                      std::vector<Acts::SourceLink>& trackSourceLinks) {
     // Check if you are not in picking mode
     if (m_cfg.pickTrack > -1 and m_cfg.pickTrack != static_cast<int>(itrack)) {
-      continue;
+      return true;
     }
 
     // The list of hits and the initial start parameters
@@ -118,7 +118,7 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
     // of entries in input and output containers matches.
     if (protoTrack.empty()) {
       ACTS_WARNING("Empty track " << itrack << " found.");
-      continue;
+      return true;
     }
 
     ACTS_VERBOSE("Initial parameters: "
@@ -137,7 +137,7 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
       } else {
         ACTS_FATAL("Proto track " << itrack << " contains invalid hit index"
                                   << hitIndex);
-        return ProcessCode::ABORT;
+        return false;
       }
     }
 
@@ -159,6 +159,69 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
                    << itrack << " with error: " << result.error() << ", "
                    << result.error().message());
     }
+    return true;
+  };
+
+  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  TrackContainer tracks(trackContainer, trackStateContainer);
+
+  const std::size_t nTasks =
+      std::min(m_cfg.numFittingTasks, protoTracks.size());
+  if (nTasks > 1) {
+    // Each task fits a contiguous chunk of the proto tracks into its own
+    // containers, which are appended to the output in input order
+    std::vector<std::shared_ptr<Acts::VectorTrackContainer>>
+        taskTrackContainers(nTasks);
+    std::vector<std::shared_ptr<Acts::VectorMultiTrajectory>>
+        taskTrackStateContainers(nTasks);
+    std::atomic<bool> aborted{false};
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          std::vector<Acts::SourceLink> trackSourceLinks;
+          for (std::size_t task = range.begin(); task != range.end(); ++task) {
+            taskTrackContainers[task] =
+                std::make_shared<Acts::VectorTrackContainer>();
+            taskTrackStateContainers[task] =
+                std::make_shared<Acts::VectorMultiTrajectory>();
+            TrackContainer taskTracks(taskTrackContainers[task],
+                                      taskTrackStateContainers[task]);
+            const std::size_t first = task * protoTracks.size() / nTasks;
+            const std::size_t last = (task + 1) * protoTracks.size() / nTasks;
+            for (std::size_t itrack = first; itrack < last; ++itrack) {
+              if (aborted or not fitTrack(itrack, taskTracks,
+                                          trackSourceLinks)) {
+                aborted = true;
+                return;
+              }
+            }
+          }
+        });
+
+    if (aborted) {
+      return ProcessCode::ABORT;
+    }
+
+    // Appending the task containers in input order reproduces the containers
+    // of the sequential fit, including the track states of failed fits
+    for (std::size_t task = 0; task < nTasks; ++task) {
+      TrackContainer taskTracks(taskTrackContainers[task],
+                                taskTrackStateContainers[task]);
+      tracks.ensureDynamicColumns(taskTracks);
+      auto stateOffset =
+          trackStateContainer->append(*taskTrackStateContainers[task]);
+      trackContainer->append(*taskTrackContainers[task], stateOffset);
+    }
+  } else {
+    // Perform the fit for each input track
+    std::vector<Acts::SourceLink> trackSourceLinks;
+    for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+      if (not fitTrack(itrack, tracks, trackSourceLinks)) {
+        return ProcessCode::ABORT;
+      }
+    }
   }
 
   std::stringstream ss;
@@ -10,10 +10,15 @@
 
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/SourceLinkAccessorConcept.hpp"
 #include "ActsExamples/EventData/GeometryContainers.hpp"
 #include "ActsExamples/EventData/Index.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -81,4 +86,59 @@ struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
     return {Iterator{begin}, Iterator{end}};
   }
 };
+
+/// Source link accessor with a constant time lookup per surface
+///
+/// The source links of a surface form a contiguous slice of the container,
+/// which is sorted by geometry identifier. At construction, the slices of all
+/// surfaces without boundary, approach, or extra identifier are stored in
+/// dense tables indexed by the volume, layer, and sensitive identifier. This
+/// replaces the binary search over all source links of the
+/// IndexSourceLinkAccessor by three table lookups. Other surfaces fall back to
+/// the binary search.
+///
+/// The tables refer to the positions in the container, the accessor needs to
+/// be constructed again whenever the container changes.
+struct DenseIndexSourceLinkAccessor
+    : GeometryIdMultisetAccessor<IndexSourceLink> {
+  using BaseIterator = IndexSourceLinkAccessor::BaseIterator;
+  using Iterator = IndexSourceLinkAccessor::Iterator;
+
+  DenseIndexSourceLinkAccessor() = default;
+
+  /// Build the lookup tables for a container
+  ///
+  /// @param sourceLinks The source links of the event
+  explicit DenseIndexSourceLinkAccessor(const Container& sourceLinks);
+
+  // get the range of elements with requested geoId
+  std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const;
+
+  // get the number of elements with requested geoId
+  std::size_t count(const Acts::Surface& surface) const {
+    auto [begin, end] = range(surface);
+    return end - begin;
+  }
+
+  // get the element at a given iterator
+  const Value& at(const Iterator& it) const { return *it.m_iterator; }
+
+ private:
+  struct Slice {
+    std::uint32_t begin = 0;
+    std::uint32_t end = 0;
+  };
+
+  // slice of m_layers for each volume
+  std::vector<Slice> m_volumes;
+  // slice of m_sensitives for each layer
+  std::vector<Slice> m_layers;
+  // slice of the container for each sensitive surface
+  std::vector<Slice> m_sensitives;
+};
+
+static_assert(Acts::SourceLinkAccessorConcept<DenseIndexSourceLinkAccessor>,
+              "DenseIndexSourceLinkAccessor does not fulfill "
+              "SourceLinkAccessorConcept");
+
 }  // namespace ActsExamples
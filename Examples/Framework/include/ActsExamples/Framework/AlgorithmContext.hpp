@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/ObjectPool.hpp"
 #include <Acts/Geometry/GeometryContext.hpp>
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
 #include <Acts/Utilities/CalibrationContext.hpp>
@@ -37,6 +38,15 @@ struct AlgorithmContext {
     return (*this);
   }
 
+  /// @brief get an empty event data container
+  ///
+  /// If an object pool is attached, the container is recycled from a
+  /// previous event and retains its capacity.
+  template <typename T>
+  T acquire() const {
+    return objectPool != nullptr ? objectPool->acquire<T>() : T{};
+  }
+
   size_t algorithmNumber;            ///< Unique algorithm identifier
   size_t eventNumber;                ///< Unique event identifier
   WhiteBoard& eventStore;            ///< Per-event data store
@@ -44,6 +54,7 @@ struct AlgorithmContext {
   Acts::MagneticFieldContext
       magFieldContext;                    ///< Per-event magnetic Field context
   Acts::CalibrationContext calibContext;  ///< Per-event calbiration context
+  ObjectPool* objectPool = nullptr;       ///< Recycled event data, can be null
 };
 
 }  // namespace ActsExamples
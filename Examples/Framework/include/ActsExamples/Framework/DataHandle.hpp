@@ -12,7 +12,9 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <cstddef>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <typeinfo>
 
@@ -48,10 +50,20 @@ class DataHandleBase {
 
   std::string fullName() const { return m_parent->name() + "." + name(); }
 
+  /// White board slot assigned by the sequencer, if any
+  const std::optional<std::size_t>& slot() const { return m_slot; }
+
  protected:
   SequenceElement* m_parent{nullptr};
   std::string m_name;
   std::optional<std::string> m_key{};
+  std::optional<std::size_t> m_slot{};
+
+ private:
+  /// Assign the white board slot once the data flow has been resolved.
+  void assignSlot(std::size_t slot) { m_slot = slot; }
+
+  friend class SequenceElement;
 };
 
 template <typename T>
@@ -74,6 +86,10 @@ class WriteDataHandle final : public DataHandleBase {
       throw std::runtime_error{"WriteDataHandle '" + fullName() +
                                "' not initialized"};
     }
+    if (m_slot.has_value() && m_slot.value() < wb.numSlots()) {
+      wb.addToSlot(m_slot.value(), m_key.value(), std::move(value));
+      return;
+    }
     wb.add(m_key.value(), std::move(value));
   }
 
@@ -117,6 +133,9 @@ class ReadDataHandle final : public DataHandleBase {
       throw std::runtime_error{"ReadDataHandle '" + fullName() +
                                "' not initialized"};
     }
+    if (m_slot.has_value() && m_slot.value() < wb.numSlots()) {
+      return wb.getFromSlot<T>(m_slot.value(), m_key.value());
+    }
     return wb.get<T>(m_key.value());
   }
 
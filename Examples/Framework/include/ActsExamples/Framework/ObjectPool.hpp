@@ -0,0 +1,156 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Recycles event data containers between events.
+///
+/// Algorithms acquire empty containers from the pool instead of creating new
+/// ones. Once the event is finished, the containers stored on the white board
+/// are released back into the pool, where they are cleared but keep their
+/// allocated capacity. A pool serves one event at a time: per type, only as
+/// many objects are retained as have been acquired during the event, and at
+/// most `maxAvailable` of them are kept. All other released objects are
+/// simply destroyed.
+///
+/// The track state columns of Acts::VectorMultiTrajectory are not recycled.
+/// Tracks end up on the white board as a ConstTrackContainer, which shares a
+/// ConstVectorMultiTrajectory through a shared pointer with its readers and
+/// has no `clear()` method. The columns can not be moved back into a mutable
+/// VectorMultiTrajectory, so the pool never sees a recyclable object.
+///
+/// Acquiring and releasing objects is thread-safe.
+class ObjectPool {
+ public:
+  /// @param maxAvailable Maximum number of retained objects per type
+  explicit ObjectPool(std::size_t maxAvailable = 16)
+      : m_maxAvailable(maxAvailable) {}
+
+  // The pool holds unique objects and can not be copied
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  /// Get an empty object, with retained capacity if it was recycled.
+  ///
+  /// @tparam T Object type, must provide a `clear()` method
+  template <typename T>
+  T acquire();
+
+  /// Return an object to the pool.
+  ///
+  /// The object is only retained if an object of the same type has been
+  /// acquired and not yet released during the current event. Objects without
+  /// a `clear()` method are never retained.
+  ///
+  /// @param object Movable reference to the object
+  template <typename T>
+  void release(T&& object);
+
+  /// Forget about acquired objects that have not been released.
+  ///
+  /// Must be called once all objects of an event have been released.
+  void finishEvent();
+
+  /// Number of objects of the given type available for reuse.
+  template <typename T>
+  std::size_t available() const;
+
+ private:
+  struct IFreeList {
+    /// Objects acquired during the current event and not released yet
+    std::size_t outstanding = 0;
+
+    virtual ~IFreeList() = default;
+  };
+  template <typename T>
+  struct FreeList : public IFreeList {
+    std::vector<T> objects;
+
+    /// Retain the object unless the list already holds @p maxSize objects
+    void push(T&& object, std::size_t maxSize) {
+      if (objects.size() >= maxSize) {
+        return;
+      }
+      object.clear();
+      objects.push_back(std::move(object));
+    }
+  };
+
+  /// Only types with a `clear()` method can be recycled
+  template <typename T, typename = void>
+  struct IsRecyclable : std::false_type {};
+  template <typename T>
+  struct IsRecyclable<T, std::void_t<decltype(std::declval<T&>().clear())>>
+      : std::true_type {};
+
+  std::size_t m_maxAvailable;
+  std::unordered_map<std::type_index, std::unique_ptr<IFreeList>> m_freeLists;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace ActsExamples
+
+template <typename T>
+inline T ActsExamples::ObjectPool::acquire() {
+  std::lock_guard lock(m_mutex);
+  auto& list = m_freeLists[std::type_index(typeid(T))];
+  if (!list) {
+    list = std::make_unique<FreeList<T>>();
+  }
+  ++list->outstanding;
+  auto& objects = static_cast<FreeList<T>&>(*list).objects;
+  if (objects.empty()) {
+    return T{};
+  }
+  T object = std::move(objects.back());
+  objects.pop_back();
+  return object;
+}
+
+template <typename T>
+inline void ActsExamples::ObjectPool::release(T&& object) {
+  using Value = std::decay_t<T>;
+  if constexpr (IsRecyclable<Value>::value) {
+    std::lock_guard lock(m_mutex);
+    auto it = m_freeLists.find(std::type_index(typeid(Value)));
+    if (it == m_freeLists.end() || it->second->outstanding == 0) {
+      return;
+    }
+    --it->second->outstanding;
+    static_cast<FreeList<Value>&>(*it->second)
+        .push(Value(std::forward<T>(object)), m_maxAvailable);
+  }
+}
+
+inline void ActsExamples::ObjectPool::finishEvent() {
+  std::lock_guard lock(m_mutex);
+  for (auto& [type, list] : m_freeLists) {
+    list->outstanding = 0;
+  }
+}
+
+template <typename T>
+inline std::size_t ActsExamples::ObjectPool::available() const {
+  std::lock_guard lock(m_mutex);
+  auto it = m_freeLists.find(std::type_index(typeid(T)));
+  if (it == m_freeLists.end()) {
+    return 0;
+  }
+  return static_cast<const FreeList<T>&>(*it->second).objects.size();
+}
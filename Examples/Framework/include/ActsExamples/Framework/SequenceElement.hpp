@@ -11,7 +11,9 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <cstddef>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ActsExamples {
@@ -41,9 +43,15 @@ class SequenceElement {
   const std::vector<const DataHandleBase*>& writeHandles() const;
   const std::vector<const DataHandleBase*>& readHandles() const;
 
+  /// Assign white board slots to the initialized data handles
+  ///
+  /// @param slots The slot of each white board key
+  void assignWhiteBoardSlots(
+      const std::unordered_map<std::string, std::size_t>& slots);
+
  private:
-  void registerWriteHandle(const DataHandleBase& handle);
-  void registerReadHandle(const DataHandleBase& handle);
+  void registerWriteHandle(DataHandleBase& handle);
+  void registerReadHandle(DataHandleBase& handle);
 
   template <typename T>
   friend class WriteDataHandle;
@@ -53,6 +61,8 @@ class SequenceElement {
 
   std::vector<const DataHandleBase*> m_writeHandles;
   std::vector<const DataHandleBase*> m_readHandles;
+  // all handles, for the assignment of the white board slots
+  std::vector<DataHandleBase*> m_handles;
 };
 
 }  // namespace ActsExamples
@@ -27,6 +27,10 @@
 #include <vector>
 
 namespace ActsExamples {
+namespace Test {
+struct SequencerFixture;
+}  // namespace Test
+
 class DataHandleBase;
 class IAlgorithm;
 class IContextDecorator;
@@ -69,6 +73,19 @@ class Sequencer {
     /// Run data flow consistency checks
     /// Defaults to false right now until all components are migrated
     bool runDataFlowChecks = true;
+    /// Execute independent sequence elements of one event concurrently.
+    /// The schedule is derived from the read/write data handles of the
+    /// elements; elements without any data handles act as barriers. Reading
+    /// a key that no previous element writes is a configuration error.
+    bool concurrentElements = false;
+    /// Resolve the data handles to integer white board slots when the
+    /// elements are added and recycle the per-event white boards. Requires
+    /// the data flow checks.
+    bool useWhiteBoardSlots = false;
+    /// Recycle the event data containers stored on the white board. The
+    /// containers are made available to the algorithms of later events
+    /// through `AlgorithmContext::acquire`.
+    bool recycleContainers = false;
   };
 
   Sequencer(const Config &cfg);
@@ -138,6 +155,8 @@ class Sequencer {
   std::vector<std::string> listAlgorithmNames() const;
   /// Determine range of (requested) events; [SIZE_MAX, SIZE_MAX) for error.
   std::pair<size_t, size_t> determineEventsRange() const;
+  /// Record the data dependencies of the most recently added element.
+  void recordElementDependencies();
 
   Config m_cfg;
   tbbWrap::task_arena m_taskArena;
@@ -150,7 +169,20 @@ class Sequencer {
 
   std::unordered_map<std::string, const DataHandleBase *> m_whiteBoardState;
 
+  /// White board slot assigned to each key if slots are used
+  std::unordered_map<std::string, size_t> m_whiteBoardSlots;
+  size_t m_numWhiteBoardSlots = 0;
+
+  /// Index of the sequence element that produces a given white board key
+  std::unordered_map<std::string, size_t> m_whiteBoardProducers;
+  /// Indices of the sequence elements each element needs to wait for
+  std::vector<std::vector<size_t>> m_elementDependencies;
+  /// Index of the last element that has to run in sequence with all others
+  std::optional<size_t> m_lastBarrier;
+
   const Acts::Logger &logger() const { return *m_logger; }
+
+  friend struct ActsExamples::Test::SequencerFixture;
 };
 
 }  // namespace ActsExamples
@@ -8,12 +8,18 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/ObjectPool.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <ostream>
+#include <shared_mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -25,17 +31,38 @@
 
 namespace ActsExamples {
 
+namespace Test {
+struct WhiteBoardFixture;
+}  // namespace Test
+
 /// A container to store arbitrary objects with ownership transfer.
 ///
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the liftime of the white board.
+///
+/// Adding and retrieving objects is thread-safe, so that independent
+/// algorithms of the same event can be executed concurrently.
+///
+/// Optionally, object names can be mapped to integer slots. Objects stored
+/// in a slot are placed in an internal arena and can be accessed by index
+/// without any lookup. The slots are published atomically, so reading a slot
+/// by name or index concurrently with writes to other slots is safe.
+/// Clearing the white board destroys the objects but retains the slot and
+/// arena storage, so that a single white board can be recycled for many
+/// events.
+///
+/// If an object pool is attached, the stored objects are released into it
+/// when the white board is cleared or destroyed instead of being destroyed.
 class WhiteBoard {
  public:
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                  Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO),
-             std::unordered_map<std::string, std::string> objectAliases = {});
+             std::unordered_map<std::string, std::string> objectAliases = {},
+             std::unordered_map<std::string, std::size_t> slots = {},
+             ObjectPool* objectPool = nullptr);
+  ~WhiteBoard();
 
   // A WhiteBoard holds unique elements and can not be copied
   WhiteBoard(const WhiteBoard& other) = delete;
@@ -43,6 +70,17 @@ class WhiteBoard {
 
   bool exists(const std::string& name) const;
 
+  /// Number of slots available for index-based access.
+  std::size_t numSlots() const { return m_slots.size(); }
+
+  /// Destroy all stored objects or release them into the object pool.
+  ///
+  /// The slot and arena storage is retained for the next use.
+  void clear();
+
+  /// The attached object pool; can be null.
+  ObjectPool* objectPool() const { return m_objectPool; }
+
  private:
   /// Store an object on the white board and transfer ownership.
   ///
@@ -60,16 +98,38 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Store an object in a slot and transfer ownership.
+  ///
+  /// @param slot Slot index, must be smaller than `numSlots()`
+  /// @param name Identifier of the object, used for diagnostics only
+  /// @param object Movable reference to the transferable object
+  /// @throws std::invalid_argument if the slot is already occupied
+  template <typename T>
+  void addToSlot(std::size_t slot, const std::string& name, T&& object);
+
+  /// Get access to an object stored in a slot.
+  ///
+  /// @param slot Slot index, must be smaller than `numSlots()`
+  /// @param name Identifier of the object, used for diagnostics only
+  /// @return reference to the stored object
+  /// @throws std::out_of_range if the slot is empty or holds another type
+  template <typename T>
+  const T& getFromSlot(std::size_t slot, const std::string& name) const;
+
  private:
   /// Find similar names for suggestions with levenshtein-distance
   std::vector<std::string_view> similarNames(const std::string_view& name,
                                              int distThreshold,
                                              std::size_t maxNumber) const;
 
+  /// Exception for a missing object including suggestions for similar names
+  std::out_of_range missingObject(const std::string& name) const;
+
   // type-erased value holder for move-constructible types
   struct IHolder {
     virtual ~IHolder() = default;
     virtual const std::type_info& type() const = 0;
+    virtual void recycle(ObjectPool& pool) = 0;
   };
   template <typename T,
             typename =
@@ -79,11 +139,46 @@ class WhiteBoard {
 
     HolderT(T&& v) : value(std::move(v)) {}
     const std::type_info& type() const override { return typeid(T); }
+    void recycle(ObjectPool& pool) override { pool.release(std::move(value)); }
+  };
+
+  /// Simple bump allocator for the slot holders.
+  ///
+  /// Memory is only returned when the arena is destroyed; resetting it makes
+  /// the already allocated chunks available again.
+  class Arena {
+   public:
+    void* allocate(std::size_t size, std::size_t alignment);
+    void reset();
+
+    /// Number of chunks allocated so far
+    std::size_t numChunks() const { return m_chunks.size(); }
+
+   private:
+    static constexpr std::size_t s_chunkSize = 16 * 1024;
+
+    struct Chunk {
+      std::unique_ptr<std::byte[]> data;
+      std::size_t size = 0;
+    };
+
+    std::vector<Chunk> m_chunks;
+    std::size_t m_current = 0;
+    std::size_t m_offset = 0;
   };
 
   std::unique_ptr<const Acts::Logger> m_logger;
   std::unordered_map<std::string, std::shared_ptr<IHolder>> m_store;
   std::unordered_map<std::string, std::string> m_objectAliases;
+  mutable std::shared_mutex m_storeMutex;
+
+  std::unordered_map<std::string, std::size_t> m_slotIndices;
+  // written by the producing algorithm and read by others without a lock:
+  // stores release the constructed holder, loads acquire it
+  std::vector<std::atomic<const IHolder*>> m_slots;
+  Arena m_arena;
+  std::mutex m_arenaMutex;
+  ObjectPool* m_objectPool = nullptr;
 
   const Acts::Logger& logger() const { return *m_logger; }
 
@@ -95,24 +190,45 @@ class WhiteBoard {
 
   template <typename T>
   friend class ReadDataHandle;
+
+  friend struct ActsExamples::Test::WhiteBoardFixture;
 };
 
 }  // namespace ActsExamples
 
 inline ActsExamples::WhiteBoard::WhiteBoard(
     std::unique_ptr<const Acts::Logger> logger,
-    std::unordered_map<std::string, std::string> objectAliases)
-    : m_logger(std::move(logger)), m_objectAliases(std::move(objectAliases)) {}
+    std::unordered_map<std::string, std::string> objectAliases,
+    std::unordered_map<std::string, std::size_t> slots,
+    ObjectPool* objectPool)
+    : m_logger(std::move(logger)),
+      m_objectAliases(std::move(objectAliases)),
+      m_slotIndices(std::move(slots)),
+      m_objectPool(objectPool) {
+  std::size_t nSlots = 0;
+  for (const auto& [name, slot] : m_slotIndices) {
+    nSlots = std::max(nSlots, slot + 1);
+  }
+  m_slots = std::vector<std::atomic<const IHolder*>>(nSlots);
+  for (auto& slot : m_slots) {
+    slot.store(nullptr, std::memory_order_relaxed);
+  }
+}
 
 template <typename T>
 inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
+  if (auto it = m_slotIndices.find(name); it != m_slotIndices.end()) {
+    addToSlot(it->second, name, std::forward<T>(object));
+    return;
+  }
+  auto holder = std::make_shared<HolderT<T>>(std::forward<T>(object));
+  std::unique_lock lock(m_storeMutex);
   if (0 < m_store.count(name)) {
     throw std::invalid_argument("Object '" + name + "' already exists");
   }
-  auto holder = std::make_shared<HolderT<T>>(std::forward<T>(object));
   m_store.emplace(name, holder);
   ACTS_VERBOSE("Added object '" << name << "' of type " << typeid(T).name());
   if (auto it = m_objectAliases.find(name); it != m_objectAliases.end()) {
@@ -125,24 +241,22 @@ template <typename T>
 inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
   ACTS_VERBOSE("Attempt to get object '" << name << "' of type "
                                          << typeid(T).name());
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
-    const auto names = similarNames(name, 10, 3);
-
-    std::stringstream ss;
-    if (not names.empty()) {
-      ss << ", similar ones are: [ ";
-      for (std::size_t i = 0; i < std::min(3ul, names.size()); ++i) {
-        ss << "'" << names[i] << "' ";
-      }
-      ss << "]";
+  const IHolder* holder = nullptr;
+  if (auto sit = m_slotIndices.find(name); sit != m_slotIndices.end()) {
+    holder = m_slots[sit->second].load(std::memory_order_acquire);
+    if (holder == nullptr) {
+      std::shared_lock lock(m_storeMutex);
+      throw missingObject(name);
     }
-
-    throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
+  } else {
+    std::shared_lock lock(m_storeMutex);
+    auto it = m_store.find(name);
+    if (it == m_store.end()) {
+      throw missingObject(name);
+    }
+    holder = it->second.get();
   }
 
-  const IHolder* holder = it->second.get();
-
   const auto* castedHolder = dynamic_cast<const HolderT<T>*>(holder);
   if (castedHolder == nullptr) {
     throw std::out_of_range(
@@ -153,6 +267,51 @@ inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
   return castedHolder->value;
 }
 
+template <typename T>
+inline void ActsExamples::WhiteBoard::addToSlot(std::size_t slot,
+                                                const std::string& name,
+                                                T&& object) {
+  if (m_slots[slot].load(std::memory_order_acquire) != nullptr) {
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  void* memory = nullptr;
+  {
+    std::lock_guard lock(m_arenaMutex);
+    memory = m_arena.allocate(sizeof(HolderT<T>), alignof(HolderT<T>));
+  }
+  const IHolder* holder = new (memory) HolderT<T>(std::forward<T>(object));
+  const IHolder* empty = nullptr;
+  if (not m_slots[slot].compare_exchange_strong(empty, holder,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+    // the arena memory is only reclaimed by the next reset
+    holder->~IHolder();
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  ACTS_VERBOSE("Added object '" << name << "' of type " << typeid(T).name()
+                                << " to slot " << slot);
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::getFromSlot(
+    std::size_t slot, const std::string& name) const {
+  const IHolder* holder = m_slots[slot].load(std::memory_order_acquire);
+  if (holder == nullptr) {
+    std::shared_lock lock(m_storeMutex);
+    throw missingObject(name);
+  }
+  const auto* castedHolder = dynamic_cast<const HolderT<T>*>(holder);
+  if (castedHolder == nullptr) {
+    throw std::out_of_range(
+        typeMismatchMessage(name, typeid(T).name(), holder->type().name()));
+  }
+  return castedHolder->value;
+}
+
 inline bool ActsExamples::WhiteBoard::exists(const std::string& name) const {
+  if (auto it = m_slotIndices.find(name); it != m_slotIndices.end()) {
+    return m_slots[it->second].load(std::memory_order_acquire) != nullptr;
+  }
+  std::shared_lock lock(m_storeMutex);
   return m_store.find(name) != m_store.end();
 }
@@ -0,0 +1,116 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// a surface id that can be looked up in the dense tables
+bool isDense(Acts::GeometryIdentifier id) {
+  return id.boundary() == 0 and id.approach() == 0 and id.extra() == 0;
+}
+
+}  // namespace
+
+ActsExamples::DenseIndexSourceLinkAccessor::DenseIndexSourceLinkAccessor(
+    const Container& sourceLinks) {
+  container = &sourceLinks;
+  if (sourceLinks.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Too many source links for the lookup tables");
+  }
+
+  // The dense surfaces are sorted by volume, layer, and sensitive id, as the
+  // boundary and approach ids are zero. Each new volume and layer appends a
+  // table to m_layers and m_sensitives that covers all ids up to the largest
+  // one found in the container.
+  struct Entry {
+    Acts::GeometryIdentifier id;
+    Slice slice;
+  };
+  std::vector<Entry> entries;
+  for (auto it = sourceLinks.begin(); it != sourceLinks.end();) {
+    const Acts::GeometryIdentifier id = it->geometryId();
+    auto end = std::find_if(it, sourceLinks.end(), [&](const auto& sl) {
+      return sl.geometryId() != id;
+    });
+    if (isDense(id)) {
+      entries.push_back(
+          {id, {static_cast<std::uint32_t>(it - sourceLinks.begin()),
+                static_cast<std::uint32_t>(end - sourceLinks.begin())}});
+    }
+    it = end;
+  }
+
+  for (auto volBegin = entries.begin(); volBegin != entries.end();) {
+    const auto volume = volBegin->id.volume();
+    auto volEnd = std::find_if(volBegin, entries.end(), [&](const Entry& e) {
+      return e.id.volume() != volume;
+    });
+
+    if (m_volumes.size() <= volume) {
+      m_volumes.resize(volume + 1);
+    }
+    const std::size_t nLayers = std::prev(volEnd)->id.layer() + 1;
+    m_volumes[volume] = {static_cast<std::uint32_t>(m_layers.size()),
+                         static_cast<std::uint32_t>(m_layers.size() + nLayers)};
+    const std::size_t firstLayer = m_layers.size();
+    m_layers.resize(m_layers.size() + nLayers);
+
+    for (auto layBegin = volBegin; layBegin != volEnd;) {
+      const auto layer = layBegin->id.layer();
+      auto layEnd = std::find_if(layBegin, volEnd, [&](const Entry& e) {
+        return e.id.layer() != layer;
+      });
+
+      const std::size_t nSensitives = std::prev(layEnd)->id.sensitive() + 1;
+      m_layers[firstLayer + layer] = {
+          static_cast<std::uint32_t>(m_sensitives.size()),
+          static_cast<std::uint32_t>(m_sensitives.size() + nSensitives)};
+      const std::size_t firstSensitive = m_sensitives.size();
+      m_sensitives.resize(m_sensitives.size() + nSensitives);
+      for (auto e = layBegin; e != layEnd; ++e) {
+        m_sensitives[firstSensitive + e->id.sensitive()] = e->slice;
+      }
+      layBegin = layEnd;
+    }
+    volBegin = volEnd;
+  }
+}
+
+std::pair<ActsExamples::DenseIndexSourceLinkAccessor::Iterator,
+          ActsExamples::DenseIndexSourceLinkAccessor::Iterator>
+ActsExamples::DenseIndexSourceLinkAccessor::range(
+    const Acts::Surface& surface) const {
+  assert(container != nullptr);
+  const Acts::GeometryIdentifier id = surface.geometryId();
+  if (not isDense(id)) {
+    auto [begin, end] = container->equal_range(id);
+    return {Iterator{begin}, Iterator{end}};
+  }
+
+  const Iterator empty{container->end()};
+  if (id.volume() >= m_volumes.size()) {
+    return {empty, empty};
+  }
+  const Slice& layers = m_volumes[id.volume()];
+  if (id.layer() >= layers.end - layers.begin) {
+    return {empty, empty};
+  }
+  const Slice& sensitives = m_layers[layers.begin + id.layer()];
+  if (id.sensitive() >= sensitives.end - sensitives.begin) {
+    return {empty, empty};
+  }
+  const Slice& slice = m_sensitives[sensitives.begin + id.sensitive()];
+  return {Iterator{container->begin() + slice.begin},
+          Iterator{container->begin() + slice.end}};
+}
@@ -8,14 +8,30 @@
 
 #include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include "ActsExamples/Framework/DataHandle.hpp"
+
 namespace ActsExamples {
 
-void SequenceElement::registerWriteHandle(const DataHandleBase& handle) {
+void SequenceElement::registerWriteHandle(DataHandleBase& handle) {
   m_writeHandles.push_back(&handle);
+  m_handles.push_back(&handle);
 }
 
-void SequenceElement::registerReadHandle(const DataHandleBase& handle) {
+void SequenceElement::registerReadHandle(DataHandleBase& handle) {
   m_readHandles.push_back(&handle);
+  m_handles.push_back(&handle);
+}
+
+void SequenceElement::assignWhiteBoardSlots(
+    const std::unordered_map<std::string, std::size_t>& slots) {
+  for (auto* handle : m_handles) {
+    if (!handle->isInitialized()) {
+      continue;
+    }
+    if (auto it = slots.find(handle->key()); it != slots.end()) {
+      handle->assignSlot(it->second);
+    }
+  }
 }
 
 const std::vector<const DataHandleBase*>& SequenceElement::writeHandles()
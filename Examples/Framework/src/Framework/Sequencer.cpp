@@ -15,6 +15,7 @@
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ObjectPool.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
@@ -26,6 +27,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <numeric>
 #include <ostream>
 #include <ratio>
@@ -108,6 +110,10 @@ Sequencer::Sequencer(const Sequencer::Config& cfg)
     ACTS_INFO("Create Sequencer with " << m_cfg.numThreads << " threads");
   }
 #endif
+  if (m_cfg.useWhiteBoardSlots && !m_cfg.runDataFlowChecks) {
+    throw std::invalid_argument(
+        "White board slots can only be used with data flow checks");
+  }
 }
 
 void Sequencer::addContextDecorator(
@@ -148,6 +154,7 @@ void Sequencer::addElement(const std::shared_ptr<SequenceElement>& element) {
   }
 
   m_sequenceElements.push_back(element);
+  recordElementDependencies();
 
   std::string elementType{getAlgorithmType(*element)};
   std::string elementTypeCapitalized = elementType;
@@ -227,11 +234,21 @@ void Sequencer::addElement(const std::shared_ptr<SequenceElement>& element) {
 
       m_whiteBoardState.emplace(std::pair{handle->key(), handle});
 
+      if (m_cfg.useWhiteBoardSlots) {
+        m_whiteBoardSlots[handle->key()] = m_numWhiteBoardSlots;
+        ACTS_DEBUG("Key '" << handle->key() << "' stored in slot "
+                           << m_numWhiteBoardSlots);
+        ++m_numWhiteBoardSlots;
+      }
+
       if (auto it = m_whiteboardObjectAliases.find(handle->key());
           it != m_whiteboardObjectAliases.end()) {
         ACTS_DEBUG("Key '" << handle->key() << "' aliased to '" << it->second
                            << "'");
         m_whiteBoardState[it->second] = handle;
+        if (m_cfg.useWhiteBoardSlots) {
+          m_whiteBoardSlots[it->second] = m_whiteBoardSlots.at(handle->key());
+        }
       }
     }
   }
@@ -239,6 +256,11 @@ void Sequencer::addElement(const std::shared_ptr<SequenceElement>& element) {
   if (!valid) {
     throw SequenceConfigurationException{};
   }
+
+  if (m_cfg.useWhiteBoardSlots) {
+    // all inputs and outputs of the element have a slot at this point
+    element->assignWhiteBoardSlots(m_whiteBoardSlots);
+  }
 }
 
 void Sequencer::addWhiteboardAlias(const std::string& aliasName,
@@ -254,6 +276,69 @@ void Sequencer::addWhiteboardAlias(const std::string& aliasName,
       oit != m_whiteBoardState.end()) {
     m_whiteBoardState[aliasName] = oit->second;
   }
+
+  if (auto sit = m_whiteBoardSlots.find(objectName);
+      sit != m_whiteBoardSlots.end()) {
+    m_whiteBoardSlots[aliasName] = sit->second;
+  }
+
+  if (auto pit = m_whiteBoardProducers.find(objectName);
+      pit != m_whiteBoardProducers.end()) {
+    m_whiteBoardProducers[aliasName] = pit->second;
+  }
+}
+
+void Sequencer::recordElementDependencies() {
+  const size_t index = m_sequenceElements.size() - 1;
+  const auto& element = *m_sequenceElements.back();
+
+  std::vector<size_t> dependencies;
+  bool hasHandles = false;
+
+  for (const auto* handle : element.readHandles()) {
+    if (!handle->isInitialized()) {
+      continue;
+    }
+    hasHandles = true;
+    if (auto it = m_whiteBoardProducers.find(handle->key());
+        it != m_whiteBoardProducers.end()) {
+      dependencies.push_back(it->second);
+    } else if (m_cfg.concurrentElements) {
+      // the element could be started before the data is available
+      ACTS_ERROR("No previous element writes key '"
+                 << handle->key() << "' read by '" << handle->fullName()
+                 << "'; undeclared data can not be scheduled concurrently");
+      throw SequenceConfigurationException{};
+    }
+  }
+
+  for (const auto* handle : element.writeHandles()) {
+    if (!handle->isInitialized()) {
+      continue;
+    }
+    hasHandles = true;
+    m_whiteBoardProducers.emplace(handle->key(), index);
+    if (auto it = m_whiteboardObjectAliases.find(handle->key());
+        it != m_whiteboardObjectAliases.end()) {
+      m_whiteBoardProducers.emplace(it->second, index);
+    }
+  }
+
+  if (!hasHandles) {
+    // without declared inputs and outputs we can not reason about the data
+    // flow: the element has to wait for all previous elements and all
+    // following elements have to wait for it.
+    dependencies.resize(index);
+    std::iota(dependencies.begin(), dependencies.end(), 0u);
+    m_lastBarrier = index;
+  } else if (m_lastBarrier.has_value()) {
+    dependencies.push_back(m_lastBarrier.value());
+  }
+
+  std::sort(dependencies.begin(), dependencies.end());
+  dependencies.erase(std::unique(dependencies.begin(), dependencies.end()),
+                     dependencies.end());
+  m_elementDependencies.push_back(std::move(dependencies));
 }
 
 std::vector<std::string> Sequencer::listAlgorithmNames() const {
@@ -442,6 +527,133 @@ int Sequencer::run() {
     }
   }
 
+  // invert the dependencies to know which elements can be started once an
+  // element has finished; elements without dependencies start the event.
+  std::vector<std::vector<size_t>> elementSuccessors(m_sequenceElements.size());
+  std::vector<size_t> rootElements;
+  for (size_t i = 0; i < m_elementDependencies.size(); ++i) {
+    if (m_elementDependencies[i].empty()) {
+      rootElements.push_back(i);
+    }
+    for (size_t dependency : m_elementDependencies[i]) {
+      elementSuccessors[dependency].push_back(i);
+    }
+  }
+
+  if (m_cfg.concurrentElements) {
+    ACTS_INFO("Execute sequence elements concurrently");
+    for (size_t i = 0; i < m_sequenceElements.size(); ++i) {
+      ACTS_DEBUG("  " << m_sequenceElements[i]->name() << " depends on "
+                      << m_elementDependencies[i].size() << " element(s)");
+      for (size_t dependency : m_elementDependencies[i]) {
+        ACTS_VERBOSE("    <- " << m_sequenceElements[dependency]->name());
+      }
+    }
+  }
+
+  // execute the sequence elements of one event as a task graph. each element
+  // is scheduled as soon as all elements it depends on have finished. the
+  // algorithm numbers and timing slots are identical to the sequential case.
+  auto executeElementGraph = [&](const AlgorithmContext& context,
+                                 std::vector<Duration>& localClocks,
+                                 size_t firstClock) {
+    std::vector<std::atomic<size_t>> pending(m_sequenceElements.size());
+    for (size_t i = 0; i < pending.size(); ++i) {
+      pending[i].store(m_elementDependencies[i].size());
+    }
+
+    tbbWrap::task_group group;
+    std::function<void(size_t)> schedule = [&](size_t i) {
+      group.run([&, i]() {
+        auto& alg = m_sequenceElements[i];
+        {
+          StopWatch sw(localClocks[firstClock + i]);
+          AlgorithmContext elementContext = context;
+          elementContext.algorithmNumber += i + 1;
+          ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
+                                  << alg->name());
+          if (alg->internalExecute(elementContext) != ProcessCode::SUCCESS) {
+            ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg) << ": "
+                                            << alg->name());
+            throw std::runtime_error("Failed to process event data");
+          }
+        }
+        for (size_t successor : elementSuccessors[i]) {
+          if (--pending[successor] == 0) {
+            schedule(successor);
+          }
+        }
+      });
+    };
+
+    for (size_t i : rootElements) {
+      schedule(i);
+    }
+    group.wait();
+  };
+
+  // white boards are recycled between events if slots are used. each one
+  // retains its slot and arena storage after it has been cleared. object
+  // pools are handed out to at most one event at a time.
+  std::vector<std::unique_ptr<ObjectPool>> objectPools;
+  std::vector<ObjectPool*> freeObjectPools;
+  std::vector<std::unique_ptr<WhiteBoard>> eventStorePool;
+  size_t nPooledEventStores = 0;
+  tbbWrap::queuing_mutex eventStorePoolMutex;
+  auto acquireEventStore = [&](size_t event) {
+    ObjectPool* objectPool = nullptr;
+    size_t pooledEventStore = 0;
+    {
+      tbbWrap::queuing_mutex::scoped_lock lock(eventStorePoolMutex);
+      if (m_cfg.useWhiteBoardSlots && !eventStorePool.empty()) {
+        auto eventStore = std::move(eventStorePool.back());
+        eventStorePool.pop_back();
+        return eventStore;
+      }
+      if (m_cfg.useWhiteBoardSlots) {
+        pooledEventStore = nPooledEventStores++;
+      }
+      if (m_cfg.recycleContainers) {
+        if (freeObjectPools.empty()) {
+          objectPools.push_back(std::make_unique<ObjectPool>());
+          freeObjectPools.push_back(objectPools.back().get());
+        }
+        objectPool = freeObjectPools.back();
+        freeObjectPools.pop_back();
+      }
+    }
+    if (!m_cfg.useWhiteBoardSlots) {
+      return std::make_unique<WhiteBoard>(
+          Acts::getDefaultLogger("EventStore#" + std::to_string(event),
+                                 m_cfg.logLevel),
+          m_whiteboardObjectAliases,
+          std::unordered_map<std::string, std::size_t>{}, objectPool);
+    }
+    // recycled white boards serve many events, they are named by their
+    // position in the pool instead
+    return std::make_unique<WhiteBoard>(
+        Acts::getDefaultLogger(
+            "EventStorePool#" + std::to_string(pooledEventStore),
+            m_cfg.logLevel),
+        m_whiteboardObjectAliases, m_whiteBoardSlots, objectPool);
+  };
+  auto releaseEventStore = [&](std::unique_ptr<WhiteBoard> eventStore) {
+    if (m_cfg.useWhiteBoardSlots) {
+      // the object pool stays attached to the recycled white board
+      eventStore->clear();
+      tbbWrap::queuing_mutex::scoped_lock lock(eventStorePoolMutex);
+      eventStorePool.push_back(std::move(eventStore));
+      return;
+    }
+    ObjectPool* objectPool = eventStore->objectPool();
+    // releases the stored objects into the object pool
+    eventStore.reset();
+    if (objectPool != nullptr) {
+      tbbWrap::queuing_mutex::scoped_lock lock(eventStorePoolMutex);
+      freeObjectPools.push_back(objectPool);
+    }
+  };
+
   // execute the parallel event loop
   std::atomic<size_t> nProcessedEvents = 0;
   size_t nTotalEvents = eventsRange.second - eventsRange.first;
@@ -456,13 +668,10 @@ int Sequencer::run() {
             ACTS_DEBUG("start processing event " << event);
             m_cfg.iterationCallback();
             // Use per-event store
-            WhiteBoard eventStore(
-                Acts::getDefaultLogger("EventStore#" + std::to_string(event),
-                                       m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
-            AlgorithmContext context(0, event, eventStore);
+            auto eventStore = acquireEventStore(event);
+            // Concurrently executed elements receive their own copies
+            AlgorithmContext context(0, event, *eventStore);
+            context.objectPool = eventStore->objectPool();
             size_t ialgo = 0;
 
             /// Decorate the context
@@ -476,17 +685,23 @@ int Sequencer::run() {
 
             ACTS_VERBOSE("Execute sequence elements");
 
-            for (auto& alg : m_sequenceElements) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
-                                      << alg->name());
-              if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
-                ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg)
-                                                << ": " << alg->name());
-                throw std::runtime_error("Failed to process event data");
+            if (m_cfg.concurrentElements) {
+              executeElementGraph(context, localClocksAlgorithms, ialgo);
+            } else {
+              for (auto& alg : m_sequenceElements) {
+                StopWatch sw(localClocksAlgorithms[ialgo++]);
+                ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
+                                        << alg->name());
+                if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
+                  ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg)
+                                                  << ": " << alg->name());
+                  throw std::runtime_error("Failed to process event data");
+                }
               }
             }
 
+            releaseEventStore(std::move(eventStore));
+
             nProcessedEvents++;
             if (logger().level() <= Acts::Logging::DEBUG) {
               ACTS_DEBUG("finished event " << event);
@@ -9,6 +9,7 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
 #include <array>
+#include <cstdint>
 #include <string_view>
 
 #include <Eigen/Core>
@@ -57,6 +58,70 @@ inline int levenshteinDistance(const std::string_view &a,
 
 }  // namespace
 
+ActsExamples::WhiteBoard::~WhiteBoard() {
+  clear();
+}
+
+void ActsExamples::WhiteBoard::clear() {
+  for (auto &slot : m_slots) {
+    // the holders are created as mutable objects in addToSlot, the slots only
+    // hand out const access to readers
+    auto *holder = const_cast<IHolder *>(
+        slot.exchange(nullptr, std::memory_order_acq_rel));
+    if (holder != nullptr) {
+      if (m_objectPool != nullptr) {
+        holder->recycle(*m_objectPool);
+      }
+      // the memory itself is owned by the arena
+      holder->~IHolder();
+    }
+  }
+  m_arena.reset();
+
+  if (m_objectPool != nullptr) {
+    for (auto &[name, holder] : m_store) {
+      // aliases share the holder; only the last reference recycles it
+      auto released = std::move(holder);
+      if (released.use_count() == 1) {
+        released->recycle(*m_objectPool);
+      }
+    }
+    m_objectPool->finishEvent();
+  }
+  m_store.clear();
+}
+
+void *ActsExamples::WhiteBoard::Arena::allocate(std::size_t size,
+                                                std::size_t alignment) {
+  while (m_current < m_chunks.size()) {
+    auto &chunk = m_chunks[m_current];
+    auto address = reinterpret_cast<std::uintptr_t>(chunk.data.get());
+    std::size_t offset =
+        (address + m_offset + alignment - 1) / alignment * alignment - address;
+    if (offset + size <= chunk.size) {
+      m_offset = offset + size;
+      return chunk.data.get() + offset;
+    }
+    // the chunk is exhausted, continue with the next retained one
+    ++m_current;
+    m_offset = 0;
+  }
+
+  Chunk chunk;
+  chunk.size = std::max(s_chunkSize, size + alignment);
+  // the holders are constructed in place, zero-filling the chunk is not needed
+  chunk.data = std::unique_ptr<std::byte[]>(new std::byte[chunk.size]);
+  m_chunks.push_back(std::move(chunk));
+  m_current = m_chunks.size() - 1;
+  m_offset = 0;
+  return allocate(size, alignment);
+}
+
+void ActsExamples::WhiteBoard::Arena::reset() {
+  m_current = 0;
+  m_offset = 0;
+}
+
 std::vector<std::string_view> ActsExamples::WhiteBoard::similarNames(
     const std::string_view &name, int distThreshold,
     std::size_t maxNumber) const {
@@ -66,6 +131,14 @@ std::vector<std::string_view> ActsExamples::WhiteBoard::similarNames(
       names.push_back({d, n});
     }
   }
+  for (const auto &[n, slot] : m_slotIndices) {
+    if (m_slots[slot].load(std::memory_order_acquire) == nullptr) {
+      continue;
+    }
+    if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
+      names.push_back({d, n});
+    }
+  }
 
   std::sort(names.begin(), names.end(),
             [&](const auto &a, const auto &b) { return a.first < b.first; });
@@ -78,6 +151,22 @@ std::vector<std::string_view> ActsExamples::WhiteBoard::similarNames(
   return selected_names;
 }
 
+std::out_of_range ActsExamples::WhiteBoard::missingObject(
+    const std::string &name) const {
+  const auto names = similarNames(name, 10, 3);
+
+  std::stringstream ss;
+  if (not names.empty()) {
+    ss << ", similar ones are: [ ";
+    for (std::size_t i = 0; i < std::min(3ul, names.size()); ++i) {
+      ss << "'" << names[i] << "' ";
+    }
+    ss << "]";
+  }
+
+  return std::out_of_range("Object '" + name + "' does not exists" + ss.str());
+}
+
 std::string ActsExamples::WhiteBoard::typeMismatchMessage(
     const std::string &name, const char *req, const char *act) {
   return std::string{"Type mismatch for '" + name + "'. Requested " +
@@ -81,14 +81,20 @@ void addMagneticField(Context& ctx) {
                        Config{radius, length, nCoils, bMagCenter}};
                  }),
                  py::arg("radius"), py::arg("length"), py::arg("nCoils"),
-                 py::arg("bMagCenter"));
+                 py::arg("bMagCenter"))
+            .def_property_readonly("tableErrorEstimate",
+                                   &Acts::SolenoidBField::tableErrorEstimate);
 
     py::class_<Config>(sol, "Config")
         .def(py::init<>())
         .def_readwrite("radius", &Config::radius)
         .def_readwrite("length", &Config::length)
         .def_readwrite("nCoils", &Config::nCoils)
-        .def_readwrite("bMagCenter", &Config::bMagCenter);
+        .def_readwrite("bMagCenter", &Config::bMagCenter)
+        .def_readwrite("useTable", &Config::useTable)
+        .def_readwrite("tableRMax", &Config::tableRMax)
+        .def_readwrite("tableZMax", &Config::tableZMax)
+        .def_readwrite("tableTolerance", &Config::tableTolerance);
   }
 
   mex.def(
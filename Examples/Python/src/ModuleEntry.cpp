@@ -245,7 +245,10 @@ PYBIND11_MODULE(ActsPythonBindings, m) {
       .def_readwrite("logLevel", &Config::logLevel)
       .def_readwrite("numThreads", &Config::numThreads)
       .def_readwrite("outputDir", &Config::outputDir)
-      .def_readwrite("outputTimingFile", &Config::outputTimingFile);
+      .def_readwrite("outputTimingFile", &Config::outputTimingFile)
+      .def_readwrite("concurrentElements", &Config::concurrentElements)
+      .def_readwrite("useWhiteBoardSlots", &Config::useWhiteBoardSlots)
+      .def_readwrite("recycleContainers", &Config::recycleContainers);
 
   struct PyFpeMonitor {
     std::optional<Acts::FpeMonitor> mon;
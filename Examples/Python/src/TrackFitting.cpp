@@ -55,7 +55,8 @@ void addTrackFitting(Context& ctx) {
                                 "TrackFittingAlgorithm", inputMeasurements,
                                 inputSourceLinks, inputProtoTracks,
                                 inputInitialTrackParameters, inputClusters,
-                                outputTracks, fit, pickTrack, calibrator);
+                                outputTracks, fit, pickTrack, calibrator,
+                                numFittingTasks);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::RefittingAlgorithm, mex,
                                 "RefittingAlgorithm", inputTracks, outputTracks,
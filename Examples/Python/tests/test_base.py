@@ -71,6 +71,31 @@ def test_sequencer_multi_threaded(ptcl_gun, capfd):
     assert "Processed 2 events" in cap.out
 
 
+def test_sequencer_concurrent_elements(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=-1, events=2, concurrentElements=True)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Execute sequence elements concurrently" in cap.out
+    assert "Processed 2 events" in cap.out
+
+
+@pytest.mark.parametrize("recycleContainers", [False, True])
+def test_sequencer_whiteboard_slots(ptcl_gun, capfd, recycleContainers):
+    s = acts.examples.Sequencer(
+        numThreads=-1,
+        events=4,
+        useWhiteBoardSlots=True,
+        recycleContainers=recycleContainers,
+    )
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
 def test_random_number():
     rnd = acts.examples.RandomNumbers(seed=42)
 
@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  using namespace Acts;
+  using namespace Acts::Test;
+
+  size_t nStates = 1000;
+  size_t runs = 1000;
+  if (argc >= 2) {
+    nStates = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("GainMatrixUpdater", Acts::Logging::Level(0)));
+
+  GeometryContext tgContext = GeometryContext();
+  GainMatrixUpdater updater;
+
+  std::minstd_rand rng;
+  std::normal_distribution<double> normal(0., 1.);
+
+  // pixel like measurements of the local position
+  VectorMultiTrajectory traj;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> trackStates;
+  for (size_t i = 0; i < nStates; ++i) {
+    auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+
+    BoundMatrix A;
+    for (size_t r = 0; r < eBoundSize; ++r) {
+      ts.predicted()[r] = normal(rng);
+      for (size_t c = 0; c < eBoundSize; ++c) {
+        A(r, c) = 0.1 * normal(rng);
+      }
+    }
+    ts.predictedCovariance() =
+        A * A.transpose() + 0.01 * BoundSymMatrix::Identity();
+
+    Vector2 measPar(normal(rng), normal(rng));
+    SymMatrix2 measCov = Vector2(0.01, 0.04).asDiagonal();
+    TestSourceLink sourceLink(eBoundLoc0, eBoundLoc1, measPar, measCov);
+    ts.setUncalibratedSourceLink(SourceLink{sourceLink});
+    testSourceLinkCalibrator<VectorMultiTrajectory>(tgContext, ts);
+
+    trackStates.push_back(ts);
+  }
+
+  ACTS_INFO("Update " << nStates << " track states per iteration");
+
+  const auto single = Acts::Test::microBenchmark(
+      [&] {
+        for (auto ts : trackStates) {
+          auto res = updater.operator()<VectorMultiTrajectory>(tgContext, ts);
+          assumeRead(res);
+        }
+      },
+      1, runs);
+  ACTS_INFO("Single state update: " << single);
+
+  const auto batch = Acts::Test::microBenchmark(
+      [&] {
+        return updater.updateBatch<VectorMultiTrajectory>(tgContext,
+                                                          trackStates);
+      },
+      1, runs);
+  ACTS_INFO("Batch update:        " << batch);
+}
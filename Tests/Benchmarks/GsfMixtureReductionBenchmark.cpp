@@ -0,0 +1,94 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/detail/KLMixtureReduction.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct Component {
+  double weight = 0.0;
+  Acts::BoundVector boundPars = Acts::BoundVector::Zero();
+  Acts::BoundSymMatrix boundCov = Acts::BoundSymMatrix::Identity();
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  using namespace Acts;
+  using namespace Acts::Test;
+  using namespace Acts::UnitLiterals;
+
+  size_t nComponents = 16;
+  size_t nBetheHeitler = 6;
+  size_t runs = 10000;
+  if (argc >= 2) {
+    nComponents = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nBetheHeitler = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    runs = std::stoi(argv[3]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("GsfMixtureReduction", Acts::Logging::Level(0)));
+
+  // Components after the convolution with the Bethe-Heitler mixture, which
+  // are reduced back to the original number on every surface
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> qop(-1. / 1_GeV, 1. / 1_GeV);
+  std::uniform_real_distribution<double> var(1e-3, 1e-1);
+  std::uniform_real_distribution<double> weight(0.1, 1.);
+  std::normal_distribution<double> normal(0., 1.);
+
+  std::vector<Component> cmps(nComponents * nBetheHeitler);
+  for (auto& cmp : cmps) {
+    cmp.weight = weight(rng);
+    for (size_t i = 0; i < eBoundSize; ++i) {
+      cmp.boundPars[i] = 0.1 * normal(rng);
+    }
+    cmp.boundPars[eBoundQOverP] = qop(rng);
+    cmp.boundCov(eBoundQOverP, eBoundQOverP) = var(rng);
+  }
+
+  const auto proj = [](auto& a) -> decltype(auto) { return a; };
+  const auto desc = std::tuple<>{};
+
+  ACTS_INFO("Reduce " << cmps.size() << " components to " << nComponents);
+
+  const auto full = Acts::Test::microBenchmark(
+      [&] {
+        auto reduced = cmps;
+        detail::reduceWithKLDistance<detail::SymmetricKLDistanceMatrix>(
+            reduced, nComponents, proj, desc);
+        return reduced;
+      },
+      1, runs);
+  ACTS_INFO("Full scan distance matrix: " << full);
+
+  const auto packed = Acts::Test::microBenchmark(
+      [&] {
+        auto reduced = cmps;
+        detail::reduceWithKLDistance<detail::PackedKLDistanceMatrix>(
+            reduced, nComponents, proj, desc);
+        return reduced;
+      },
+      1, runs);
+  ACTS_INFO("Packed distance matrix:    " << packed);
+}
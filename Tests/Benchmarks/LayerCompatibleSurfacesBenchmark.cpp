@@ -0,0 +1,150 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/LayerCreator.hpp"
+#include "Acts/Geometry/ProtoLayer.hpp"
+#include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  using namespace Acts;
+  using namespace Acts::Test;
+  using namespace Acts::UnitLiterals;
+
+  size_t nPhi = 32;
+  size_t nZ = 20;
+  size_t runs = 100000;
+  if (argc >= 2) {
+    nPhi = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nZ = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    runs = std::stoi(argv[3]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("LayerCompatibleSurfaces", Acts::Logging::Level(0)));
+
+  GeometryContext gctx;
+
+  // a barrel of tilted, overlapping modules
+  const double radius = 100_mm;
+  const double halfX = 1.1 * M_PI * radius / nPhi;
+  const double halfY = 20_mm;
+  auto bounds = std::make_shared<const RectangleBounds>(halfX, halfY);
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (size_t iz = 0; iz < nZ; ++iz) {
+    const double z = (2. * iz + 1. - nZ) * 0.95 * halfY;
+    for (size_t iphi = 0; iphi < nPhi; ++iphi) {
+      const double phi = 2 * M_PI * iphi / nPhi;
+      const double r = radius + (iz % 2 ? 1_mm : -1_mm);
+      Transform3 transform = Transform3::Identity();
+      transform.translate(Vector3(r * std::cos(phi), r * std::sin(phi), z));
+      transform.rotate(Eigen::AngleAxisd(phi + 0.2, Vector3(0, 0, 1)));
+      transform.rotate(Eigen::AngleAxisd(M_PI / 2, Vector3(0, 1, 0)));
+      transform.rotate(Eigen::AngleAxisd(M_PI / 2, Vector3(0, 0, 1)));
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(transform, bounds));
+    }
+  }
+  ProtoLayer protoLayer(gctx, surfaces);
+  protoLayer.envelope[binR] = {1_mm, 1_mm};
+
+  LayerCreator::Config cfg;
+  cfg.surfaceArrayCreator = std::make_shared<const SurfaceArrayCreator>(
+      getDefaultLogger("SurfaceArrayCreator", Logging::WARNING));
+  LayerCreator creator(cfg);
+  auto layer = creator.cylinderLayer(gctx, surfaces, nPhi, nZ, protoLayer);
+  cfg.surfaceCandidateCache = true;
+  LayerCreator cachedCreator(cfg);
+  auto cachedLayer =
+      cachedCreator.cylinderLayer(gctx, surfaces, nPhi, nZ, protoLayer);
+
+  SurfaceArrayCreator::Config sacCfg;
+  sacCfg.flatLookup = true;
+  cfg.surfaceArrayCreator = std::make_shared<const SurfaceArrayCreator>(
+      sacCfg, getDefaultLogger("SurfaceArrayCreator", Logging::WARNING));
+  cfg.surfaceCandidateCache = false;
+  LayerCreator flatCreator(cfg);
+  auto flatLayer =
+      flatCreator.cylinderLayer(gctx, surfaces, nPhi, nZ, protoLayer);
+  cfg.surfaceCandidateCache = true;
+  LayerCreator flatCachedCreator(cfg);
+  auto flatCachedLayer =
+      flatCachedCreator.cylinderLayer(gctx, surfaces, nPhi, nZ, protoLayer);
+
+  // straight tracks from the origin, starting at the inner layer radius
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-1., 1.);
+  std::vector<std::pair<Vector3, Vector3>> tracks;
+  for (size_t i = 0; i < 1000; ++i) {
+    const double theta = 2 * std::atan(std::exp(-etaDist(rng)));
+    const Vector3 direction =
+        makeDirectionUnitFromPhiTheta(phiDist(rng), theta);
+    const double rStart = protoLayer.min(binR) - 0.5_mm;
+    tracks.emplace_back(rStart / std::sin(theta) * direction, direction);
+  }
+
+  NavigationOptions<Surface> options(Direction::Forward, true);
+
+  ACTS_INFO("Layer with " << surfaces.size() << " surfaces in " << nPhi
+                          << " x " << nZ << " bins");
+
+  const auto run = [&](const Layer& lay) {
+    return Acts::Test::microBenchmark(
+        [&](const auto& track) {
+          return lay.compatibleSurfaces(gctx, track.first, track.second,
+                                        options);
+        },
+        tracks, runs / tracks.size());
+  };
+
+  size_t nFound = 0;
+  for (const auto& track : tracks) {
+    nFound +=
+        layer->compatibleSurfaces(gctx, track.first, track.second, options)
+            .size();
+  }
+  ACTS_INFO("Compatible surfaces per track: "
+            << static_cast<double>(nFound) / tracks.size());
+
+  ACTS_INFO("Neighbor lookup:              " << run(*layer));
+  ACTS_INFO("Surface candidate cache:      " << run(*cachedLayer));
+  ACTS_INFO("Flat neighbor lookup:         " << run(*flatLayer));
+  ACTS_INFO("Flat lookup and cache:        " << run(*flatCachedLayer));
+
+  const auto lookup = [&](const SurfaceArray& surfaceArray) {
+    return Acts::Test::microBenchmark(
+        [&](const auto& track) {
+          return surfaceArray.neighborRange(track.first).size();
+        },
+        tracks, runs / tracks.size());
+  };
+  ACTS_INFO("Grid neighbor range:          "
+            << lookup(*layer->surfaceArray()));
+  ACTS_INFO("Flat neighbor range:          "
+            << lookup(*flatLayer->surfaceArray()));
+}
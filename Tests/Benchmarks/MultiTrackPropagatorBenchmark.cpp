@@ -0,0 +1,96 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackPropagator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  using namespace Acts;
+  using namespace Acts::UnitLiterals;
+
+  size_t nTracks = 1000;
+  size_t runs = 20;
+  if (argc >= 2) {
+    nTracks = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("MultiTrackPropagator", Acts::Logging::Level(0)));
+
+  GeometryContext tgContext = GeometryContext();
+  MagneticFieldContext mfContext = MagneticFieldContext();
+  auto bField = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
+
+  // tracks starting at the first pixel layer, extrapolated to the beam line
+  std::minstd_rand rng;
+  std::uniform_real_distribution<> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<> theta(0.3, M_PI - 0.3);
+  std::uniform_real_distribution<> p(0.5_GeV, 10_GeV);
+  BoundSymMatrix cov = BoundSymMatrix::Identity() * 1e-4;
+  std::vector<BoundTrackParameters> tracks;
+  for (size_t i = 0; i < nTracks; ++i) {
+    Vector3 dir = makeDirectionUnitFromPhiTheta(phi(rng), theta(rng));
+    Vector4 pos4(0, 0, 0, 0);
+    pos4.segment<3>(ePos0) = 50_mm * dir;
+    tracks.push_back(
+        CurvilinearTrackParameters(pos4, dir, p(rng), i % 2 ? 1 : -1, cov));
+  }
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.direction = Direction::Backward;
+
+  ACTS_INFO("Propagate " << nTracks << " tracks to the perigee surface");
+
+  Propagator<EigenStepper<>> propagator{EigenStepper<>(bField)};
+  const auto single = Acts::Test::microBenchmark(
+      [&] {
+        size_t nOk = 0;
+        for (const auto& track : tracks) {
+          nOk += propagator.propagate(track, *perigee, options).ok();
+        }
+        return nOk;
+      },
+      1, runs);
+  ACTS_INFO("Single track propagation: " << single);
+
+  MultiTrackPropagator<4> propagator4{MultiTrackEigenStepper<4>(bField)};
+  const auto lanes4 = Acts::Test::microBenchmark(
+      [&] {
+        return propagator4.propagate(tgContext, mfContext, tracks, *perigee,
+                                     options);
+      },
+      1, runs);
+  ACTS_INFO("Lock-step propagation, 4 lanes: " << lanes4);
+
+  MultiTrackPropagator<8> propagator8{MultiTrackEigenStepper<8>(bField)};
+  const auto lanes8 = Acts::Test::microBenchmark(
+      [&] {
+        return propagator8.propagate(tgContext, mfContext, tracks, *perigee,
+                                     options);
+      },
+      1, runs);
+  ACTS_INFO("Lock-step propagation, 8 lanes: " << lanes8);
+}
@@ -0,0 +1,282 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/InternalSpacePointStorage.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonal.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/DataDirectory.hpp"
+#include "Acts/Utilities/Range1D.hpp"
+#include "SeedingBenchmarkCommon.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace {
+
+using SpacePoint = Acts::Test::SeedingBenchmarkSpacePoint;
+
+// The fixtures start with the magic "ACSP", followed by the number of space
+// points as uint32 and the variances in r and z as float32, which are shared
+// by all space points. Then x, y and z of each space point follow as float32
+// in mm. All values are little endian.
+std::vector<SpacePoint> readSpacePoints(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[4] = {};
+  std::uint32_t nSpacePoints = 0;
+  float varianceR = 0;
+  float varianceZ = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&nSpacePoints), sizeof(nSpacePoints));
+  file.read(reinterpret_cast<char*>(&varianceR), sizeof(varianceR));
+  file.read(reinterpret_cast<char*>(&varianceZ), sizeof(varianceZ));
+  if (not file or std::string(magic, sizeof(magic)) != "ACSP") {
+    throw std::runtime_error("Invalid space point fixture " + path);
+  }
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nSpacePoints);
+  for (std::uint32_t i = 0; i < nSpacePoints; ++i) {
+    float xyz[3] = {};
+    file.read(reinterpret_cast<char*>(xyz), sizeof(xyz));
+    spacePoints.push_back({xyz[0], xyz[1], xyz[2], std::hypot(xyz[0], xyz[1]),
+                           0, varianceR, varianceZ});
+  }
+  if (not file) {
+    throw std::runtime_error("Truncated space point fixture " + path);
+  }
+  return spacePoints;
+}
+
+// Reset the peak resident memory of the process, such that the next call to
+// peakMemory only covers what happened in between. Only supported on Linux.
+bool resetPeakMemory() {
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  clearRefs << "5";
+  clearRefs.flush();
+  return clearRefs.good();
+}
+
+// peak resident memory since the last reset in MB
+double peakMemory() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return std::stod(line.substr(6)) / 1024.;
+    }
+  }
+  return 0;
+}
+
+double milliseconds(std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<unsigned int> sizes;
+  std::size_t runs = 100;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("spacepoints", po::value<std::vector<unsigned int>>(&sizes)->multitoken()->default_value({440, 1320, 4400}, "440 1320 4400"), "number of space points of the synthetic fixtures")
+      ("runs", po::value<std::size_t>(&runs)->default_value(100), "number of benchmark runs per fixture");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  // the same pixel barrel setup is used for both seed finders
+  Acts::SeedFinderConfig<SpacePoint> config =
+      Acts::Test::makeSeedingBenchmarkConfig();
+
+  Acts::SeedFinderOrthogonalConfig<SpacePoint> orthogonalConfig;
+  orthogonalConfig.seedFilter = config.seedFilter;
+  orthogonalConfig.rMax = config.rMax;
+  orthogonalConfig.deltaRMinTopSP = config.deltaRMinTopSP;
+  orthogonalConfig.deltaRMinBottomSP = config.deltaRMinBottomSP;
+  orthogonalConfig.deltaRMaxTopSP = config.deltaRMaxTopSP;
+  orthogonalConfig.deltaRMaxBottomSP = config.deltaRMaxBottomSP;
+  orthogonalConfig.collisionRegionMin = config.collisionRegionMin;
+  orthogonalConfig.collisionRegionMax = config.collisionRegionMax;
+  orthogonalConfig.zMin = config.zMin;
+  orthogonalConfig.zMax = config.zMax;
+  orthogonalConfig.maxSeedsPerSpM = config.maxSeedsPerSpM;
+  orthogonalConfig.cotThetaMax = config.cotThetaMax;
+  orthogonalConfig.sigmaScattering = config.sigmaScattering;
+  orthogonalConfig.minPt = config.minPt;
+  orthogonalConfig.impactMax = config.impactMax;
+  orthogonalConfig.useVariableMiddleSPRange = false;
+
+  Acts::SeedFinderOptions options = Acts::Test::makeSeedingBenchmarkOptions();
+
+  Acts::SpacePointGridConfig gridConf =
+      Acts::Test::makeSeedingBenchmarkGridConfig(config);
+  Acts::SpacePointGridOptions gridOpts;
+  gridOpts.bFieldInZ = options.bFieldInZ;
+
+  gridConf = gridConf.toInternalUnits();
+  gridOpts = gridOpts.toInternalUnits();
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  orthogonalConfig =
+      orthogonalConfig.toInternalUnits().calculateDerivedQuantities();
+  options = options.toInternalUnits().calculateDerivedQuantities(config);
+
+  const Acts::SeedFinder<SpacePoint> finder(config);
+  const Acts::SeedFinderOrthogonal<SpacePoint> orthogonalFinder(
+      orthogonalConfig);
+
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Acts::Vector3, Acts::Vector2> {
+    Acts::Vector3 position(sp.x(), sp.y(), sp.z());
+    Acts::Vector2 covariance(sp.varianceR, sp.varianceZ);
+    return std::make_pair(position, covariance);
+  };
+  std::function<std::pair<Acts::Vector3, Acts::Vector2>(const SpacePoint*)>
+      orthogonalCt = [](const SpacePoint* sp) {
+        Acts::Vector3 position(sp->x(), sp->y(), sp->z());
+        Acts::Vector2 covariance(sp->varianceR, sp->varianceZ);
+        return std::make_pair(position, covariance);
+      };
+  std::vector<std::pair<int, int>> zBinNeighbors;
+  auto binFinder =
+      std::make_shared<Acts::BinFinder<SpacePoint>>(zBinNeighbors, 1);
+  const Acts::Range1D<float> rMiddleSPRange;
+
+  for (unsigned int size : sizes) {
+    // the peak memory covers this fixture only, including the replayed space
+    // points and all seeding containers
+    const bool peakMemoryReset = resetPeakMemory();
+
+    const std::string fixture = "seeding_synthetic_barrel_" +
+                                std::to_string(size) + "_spacepoints.bin";
+    const std::vector<SpacePoint> spacePoints =
+        readSpacePoints(Acts::Test::getDataPath(fixture));
+    std::vector<const SpacePoint*> spVec;
+    spVec.reserve(spacePoints.size());
+    for (const auto& sp : spacePoints) {
+      spVec.push_back(&sp);
+    }
+
+    Acts::InternalSpacePointStorage<SpacePoint> storage;
+    Acts::SeedFinder<SpacePoint>::SeedingState state;
+    std::vector<Acts::Seed<SpacePoint>> seeds;
+    Acts::SeedFinderStageTimes stageTimes;
+    std::chrono::nanoseconds gridTime{0};
+
+    auto runSeeding = [&](bool timeStages) {
+      seeds.clear();
+      Acts::Extent rRangeSPExtent;
+      const auto gridStart = std::chrono::steady_clock::now();
+      auto spGroup = Acts::BinnedSPGroup<SpacePoint>(
+          spVec.begin(), spVec.end(), ct, binFinder, binFinder,
+          Acts::SpacePointGridCreator::createGrid<SpacePoint>(gridConf,
+                                                              gridOpts),
+          rRangeSPExtent, config, options, &storage);
+      if (timeStages) {
+        gridTime += std::chrono::steady_clock::now() - gridStart;
+      }
+
+      state.spacePointData.resize(spVec.size());
+      for (auto [bottom, middle, top] : spGroup) {
+        if (timeStages) {
+          finder.createSeedsForGroup(options, state, spGroup.grid(),
+                                     std::back_inserter(seeds), bottom, middle,
+                                     top, rMiddleSPRange, stageTimes);
+        } else {
+          finder.createSeedsForGroup(options, state, spGroup.grid(),
+                                     std::back_inserter(seeds), bottom, middle,
+                                     top, rMiddleSPRange);
+        }
+      }
+      return seeds.size();
+    };
+
+    const auto result =
+        Acts::Test::microBenchmark([&] { return runSeeding(false); }, 1, runs);
+    // the stages are timed in a separate pass with the timed seed finder
+    // overload, the throughput above is measured without any timing
+    const std::size_t nSeeds = runSeeding(true);
+
+    std::vector<Acts::Seed<SpacePoint>> orthogonalSeeds;
+    const auto orthogonalResult = Acts::Test::microBenchmark(
+        [&] {
+          orthogonalSeeds.clear();
+          orthogonalFinder.createSeeds(options, spVec, orthogonalSeeds,
+                                       orthogonalCt);
+          return orthogonalSeeds.size();
+        },
+        1, runs);
+
+    std::cout << "Fixture " << fixture << ": " << spVec.size()
+              << " space points, synthetic five layer barrel, not a pile-up "
+                 "replay and without a corresponding pile-up level"
+              << std::endl;
+    std::cout << "  SeedFinder:           " << result << std::endl;
+    std::cout << "    " << nSeeds << " seeds, "
+              << nSeeds / std::chrono::duration<double>(
+                              result.iterTimeAverage())
+                              .count()
+              << " seeds/s" << std::endl;
+    std::cout << "    grid fill " << milliseconds(gridTime)
+              << " ms, doublets " << milliseconds(stageTimes.doublets)
+              << " ms, triplets " << milliseconds(stageTimes.triplets)
+              << " ms, filter " << milliseconds(stageTimes.filter) << " ms"
+              << std::endl;
+    std::cout << "  SeedFinderOrthogonal: " << orthogonalResult << std::endl;
+    std::cout << "    " << orthogonalSeeds.size() << " seeds, "
+              << orthogonalSeeds.size() /
+                     std::chrono::duration<double>(
+                         orthogonalResult.iterTimeAverage())
+                         .count()
+              << " seeds/s" << std::endl;
+    if (peakMemoryReset) {
+      std::cout << "  peak memory " << peakMemory() << " MB" << std::endl;
+    } else {
+      std::cout << "  peak memory not available" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <memory>
+
+namespace Acts {
+namespace Test {
+
+/// Minimal space point of the seeding benchmark
+struct SeedingBenchmarkSpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float m_r;
+  int layer;
+  float varianceR;
+  float varianceZ;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float r() const { return m_r; }
+};
+
+/// Seed finder configuration of a five layer pixel barrel in user units
+inline SeedFinderConfig<SeedingBenchmarkSpacePoint>
+makeSeedingBenchmarkConfig() {
+  using namespace Acts::UnitLiterals;
+
+  SeedFilterConfig filterConfig;
+  filterConfig = filterConfig.toInternalUnits();
+
+  SeedFinderConfig<SeedingBenchmarkSpacePoint> config;
+  config.seedFilter = std::make_shared<SeedFilter<SeedingBenchmarkSpacePoint>>(
+      filterConfig);
+  config.rMax = 160._mm;
+  config.deltaRMin = 5._mm;
+  config.deltaRMax = 160._mm;
+  config.deltaRMinTopSP = config.deltaRMin;
+  config.deltaRMinBottomSP = config.deltaRMin;
+  config.deltaRMaxTopSP = config.deltaRMax;
+  config.deltaRMaxBottomSP = config.deltaRMax;
+  config.collisionRegionMin = -250._mm;
+  config.collisionRegionMax = 250._mm;
+  config.zMin = -2800._mm;
+  config.zMax = 2800._mm;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.00000;
+  config.minPt = 500._MeV;
+  config.impactMax = 10._mm;
+  return config;
+}
+
+/// Seed finder options matching the above configuration in user units
+inline SeedFinderOptions makeSeedingBenchmarkOptions() {
+  using namespace Acts::UnitLiterals;
+
+  SeedFinderOptions options;
+  options.beamPos = {-.5_mm, -.5_mm};
+  options.bFieldInZ = 1.99724_T;
+  return options;
+}
+
+/// Space point grid configuration for the given seed finder configuration
+///
+/// @param config seed finder configuration in user units
+inline SpacePointGridConfig makeSeedingBenchmarkGridConfig(
+    const SeedFinderConfig<SeedingBenchmarkSpacePoint>& config) {
+  SpacePointGridConfig gridConf;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+  return gridConf;
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -14,11 +14,13 @@
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iostream>
 #include <random>
 #include <string>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -88,6 +90,72 @@ int main(int argc, char* argv[]) {
   std::cout << solenoid_result << std::endl;
   csv("solenoid", solenoid_result);
 
+  // The tabulated SolenoidBField replaces the coil sum by an interpolation,
+  // compare it to the exact field within the extent of the table
+  {
+    std::cout << "Building tabulated SolenoidBField" << std::endl;
+    Acts::SolenoidBField::Config tableConfig{R, L, nCoils, bMagCenter};
+    tableConfig.useTable = true;
+    const auto start = std::chrono::steady_clock::now();
+    Acts::SolenoidBField bTableField(tableConfig);
+    const std::chrono::duration<double> buildTime =
+        std::chrono::steady_clock::now() - start;
+    std::cout << "Table with " << bTableField.tableSize().first << " x "
+              << bTableField.tableSize().second << " nodes built in "
+              << buildTime.count() << " s, estimated interpolation error "
+              << bTableField.tableErrorEstimate() / 1_T << " T"
+              << std::endl;
+
+    std::uniform_real_distribution<> rTableDist(0, 0.9 * R);
+    std::uniform_real_distribution<> zTableDist(-L, L);
+    auto genTablePos = [&]() -> Acts::Vector3 {
+      const double z = zTableDist(rng), r = rTableDist(rng),
+                   phi = phiDist(rng);
+      return {r * std::cos(phi), r * std::sin(phi), z};
+    };
+
+    double maxError = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+      const Acts::Vector3 pos = genTablePos();
+      const Acts::Vector3 deviation =
+          bTableField.getField(pos) - bSolenoidField.getField(pos);
+      maxError = std::max(maxError, deviation.cwiseAbs().maxCoeff());
+    }
+    std::cout << "Maximum deviation from the exact field at 1000 random "
+                 "positions: "
+              << maxError / 1_T << " T" << std::endl;
+
+    std::cout << "Benchmarking random exact SolenoidBField lookup in the "
+                 "table extent: "
+              << std::flush;
+    const auto exact_table_result = Acts::Test::microBenchmark(
+        [&] { return bSolenoidField.getField(genTablePos()); },
+        iters_solenoid, runs_solenoid);
+    std::cout << exact_table_result << std::endl;
+    csv("solenoid_exact_table_extent", exact_table_result);
+
+    std::cout << "Benchmarking random tabulated SolenoidBField lookup: "
+              << std::flush;
+    const auto table_result = Acts::Test::microBenchmark(
+        [&] { return bTableField.getField(genTablePos()); }, iters_map);
+    std::cout << table_result << std::endl;
+    csv("solenoid_table", table_result);
+
+    std::cout << "Benchmarking random tabulated SolenoidBField gradient: "
+              << std::flush;
+    auto tableCache = bTableField.makeCache(mctx);
+    Acts::ActsMatrix<3, 3> derivative;
+    const auto table_gradient_result = Acts::Test::microBenchmark(
+        [&] {
+          return bTableField
+              .getFieldGradient(genTablePos(), derivative, tableCache)
+              .value();
+        },
+        iters_map);
+    std::cout << table_gradient_result << std::endl;
+    csv("solenoid_table_gradient", table_gradient_result);
+  }
+
   // ...but for interpolated B-field map, the overhead of a field lookup is
   // comparable to that of generating a random position, so we must be more
   // careful. Hence we do two microbenchmarks which represent a kind of
@@ -183,5 +251,72 @@ int main(int argc, char* argv[]) {
         steps);
     std::cout << map_adv_result_cache << std::endl;
     csv("interp_cache_adv", map_adv_result_cache);
+
+    // - The last benchmarks compare the lookup of the same advancing
+    //   positions, one at a time through the generic provider interface
+    //   against a single batch lookup. The field map uses the default batch
+    //   implementation, so this measures the overhead of the batch interface.
+    const Acts::MagneticFieldProvider& provider = bFieldMap;
+    std::vector<Acts::Vector3> fields(steps.size());
+
+    std::cout << "Benchmarking scalar advancing interpolated field lookup: "
+              << std::flush;
+    auto scalarCache = provider.makeCache(mctx);
+    const auto map_adv_result_scalar = Acts::Test::microBenchmark(
+        [&] {
+          for (size_t i = 0; i < steps.size(); ++i) {
+            fields[i] = provider.getField(steps[i], scalarCache).value();
+          }
+          return fields.back();
+        },
+        1);
+    std::cout << map_adv_result_scalar << std::endl;
+    csv("interp_scalar_adv", map_adv_result_scalar);
+
+    std::cout << "Benchmarking batch advancing interpolated field lookup: "
+              << std::flush;
+    auto batchCache = provider.makeCache(mctx);
+    const auto map_adv_result_batch = Acts::Test::microBenchmark(
+        [&] {
+          provider.getFields(steps, fields, batchCache);
+          return fields.back();
+        },
+        1);
+    std::cout << map_adv_result_batch << std::endl;
+    csv("interp_batch_adv", map_adv_result_batch);
+  }
+
+  // - The same comparison for the SolenoidBField at random positions
+  {
+    const Acts::MagneticFieldProvider& provider = bSolenoidField;
+    std::vector<Acts::Vector3> positions(iters_solenoid);
+    std::generate(positions.begin(), positions.end(), genPos);
+    std::vector<Acts::Vector3> fields(positions.size());
+
+    std::cout << "Benchmarking scalar random SolenoidBField lookup: "
+              << std::flush;
+    auto scalarCache = provider.makeCache(mctx);
+    const auto solenoid_result_scalar = Acts::Test::microBenchmark(
+        [&] {
+          for (size_t i = 0; i < positions.size(); ++i) {
+            fields[i] = provider.getField(positions[i], scalarCache).value();
+          }
+          return fields.back();
+        },
+        1, runs_solenoid);
+    std::cout << solenoid_result_scalar << std::endl;
+    csv("solenoid_scalar", solenoid_result_scalar);
+
+    std::cout << "Benchmarking batch random SolenoidBField lookup: "
+              << std::flush;
+    auto batchCache = provider.makeCache(mctx);
+    const auto solenoid_result_batch = Acts::Test::microBenchmark(
+        [&] {
+          provider.getFields(positions, fields, batchCache);
+          return fields.back();
+        },
+        1, runs_solenoid);
+    std::cout << solenoid_result_batch << std::endl;
+    csv("solenoid_batch", solenoid_result_batch);
   }
 }
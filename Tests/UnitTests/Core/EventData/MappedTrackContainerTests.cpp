@@ -0,0 +1,361 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/MappedTrackContainer.hpp"
+#include "Acts/EventData/PackedMultiTrajectory.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/Tests/CommonHelpers/TestTrackState.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::HashedStringLiteral;
+
+GeometryContext gctx;
+// fixed seed for reproducible tests
+std::default_random_engine rng(31415);
+
+SourceLinkRecord encode(const SourceLink& sourceLink) {
+  const auto& sl = sourceLink.get<TestSourceLink>();
+  return {sl.m_geometryId.value(), sl.sourceId};
+}
+
+SourceLink decode(const SourceLinkRecord& record) {
+  TestSourceLink sl;
+  sl.m_geometryId = GeometryIdentifier{record[0]};
+  sl.sourceId = record[1];
+  return SourceLink{sl};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataMappedTrackContainer)
+
+BOOST_AUTO_TEST_CASE(WriteAndMap) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  std::vector<const Surface*> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+  BOOST_REQUIRE_GE(surfaces.size(), 4u);
+
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.addColumn<unsigned int>("group");
+  tc.trackStateContainer().addColumn<double>("weight");
+  tc.trackStateContainer().addColumn<bool>("flag");
+
+  for (unsigned int itrack = 0; itrack < 2; ++itrack) {
+    auto track = tc.getTrack(tc.addTrack());
+    auto previous = MultiTrajectoryTraits::kInvalid;
+    for (unsigned int i = 0; i < 4; ++i) {
+      TestTrackState pc(rng, 1 + i % 2);
+      pc.sourceLink.m_geometryId = surfaces[i]->geometryId();
+      pc.sourceLink.sourceId = 10 * itrack + i;
+      auto ts = tc.trackStateContainer().getTrackState(
+          tc.trackStateContainer().addTrackState(TrackStatePropMask::All,
+                                                 previous));
+      fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+      ts.setReferenceSurface(surfaces[i]->getSharedPtr());
+      ts.template component<double>("weight") = 0.5 * i;
+      ts.template component<bool>("flag") = (i % 2 == 0);
+      previous = ts.index();
+    }
+    track.tipIndex() = previous;
+    track.parameters() = BoundVector::Constant(itrack);
+    track.covariance() = BoundSymMatrix::Identity() * (1 + itrack);
+    track.setReferenceSurface(
+        Surface::makeShared<PerigeeSurface>(Vector3(1., 2., itrack)));
+    track.template component<unsigned int>("group") = 7 + itrack;
+    track.nMeasurements() = 4;
+    track.chi2() = 1.5;
+  }
+
+  const auto path =
+      (std::filesystem::temp_directory_path() / "acts_mapped_tracks.bin")
+          .string();
+
+  MappedTrackFile::SourceLinkEncoder encoder;
+  encoder.connect<&encode>();
+  MappedTrackFile::write(path, gctx, tc.container(), tc.trackStateContainer(),
+                         encoder);
+
+  MappedTrackFile::SourceLinkDecoder decoder;
+  decoder.connect<&decode>();
+  MappedTrackFile file(path, *geometry, decoder);
+  TrackContainer mapped{file.tracks(), file.trajectory()};
+
+  BOOST_REQUIRE_EQUAL(mapped.size(), tc.size());
+  BOOST_REQUIRE_EQUAL(file.trajectory().size(),
+                      tc.trackStateContainer().size());
+  BOOST_CHECK(mapped.hasColumn("group"));
+  BOOST_CHECK(file.trajectory().hasColumn("weight"_hash));
+  BOOST_CHECK(not file.trajectory().hasColumn("missing"_hash));
+
+  for (std::size_t itrack = 0; itrack < tc.size(); ++itrack) {
+    auto track = tc.getTrack(itrack);
+    auto mappedTrack = mapped.getTrack(itrack);
+    BOOST_CHECK_EQUAL(mappedTrack.tipIndex(), track.tipIndex());
+    BOOST_CHECK_EQUAL(mappedTrack.parameters(), track.parameters());
+    BOOST_CHECK_EQUAL(mappedTrack.covariance(), track.covariance());
+    BOOST_CHECK_EQUAL(mappedTrack.nMeasurements(), 4u);
+    BOOST_CHECK_EQUAL(mappedTrack.chi2(), 1.5);
+    BOOST_CHECK_EQUAL(
+        mappedTrack.template component<unsigned int>("group"), 7 + itrack);
+    BOOST_CHECK_EQUAL(mappedTrack.referenceSurface().center(gctx),
+                      track.referenceSurface().center(gctx));
+
+    auto states = track.trackStates();
+    auto mappedStates = mappedTrack.trackStates();
+    std::vector<std::size_t> indices;
+    for (const auto ts : states) {
+      indices.push_back(ts.index());
+    }
+    std::size_t i = 0;
+    for (const auto mts : mappedStates) {
+      BOOST_REQUIRE_LT(i, indices.size());
+      auto ts = tc.trackStateContainer().getTrackState(indices[i++]);
+      BOOST_CHECK_EQUAL(mts.index(), ts.index());
+      BOOST_CHECK_EQUAL(mts.predicted(), ts.predicted());
+      BOOST_CHECK_EQUAL(mts.filteredCovariance(), ts.filteredCovariance());
+      BOOST_CHECK_EQUAL(mts.smoothed(), ts.smoothed());
+      BOOST_CHECK_EQUAL(mts.jacobian(), ts.jacobian());
+      BOOST_CHECK_EQUAL(mts.calibratedSize(), ts.calibratedSize());
+      BOOST_CHECK_EQUAL(mts.effectiveCalibrated(), ts.effectiveCalibrated());
+      BOOST_CHECK_EQUAL(mts.projectorBitset(), ts.projectorBitset());
+      BOOST_CHECK_EQUAL(mts.chi2(), ts.chi2());
+      BOOST_CHECK_EQUAL(&mts.referenceSurface(), &ts.referenceSurface());
+      BOOST_CHECK_EQUAL(mts.template component<double>("weight"),
+                        ts.template component<double>("weight"));
+      BOOST_CHECK_EQUAL(mts.template component<bool>("flag"),
+                        ts.template component<bool>("flag"));
+      const TestSourceLink sl =
+          mts.getUncalibratedSourceLink().get<TestSourceLink>();
+      const TestSourceLink expected =
+          ts.getUncalibratedSourceLink().get<TestSourceLink>();
+      BOOST_CHECK_EQUAL(sl.m_geometryId, expected.m_geometryId);
+      BOOST_CHECK_EQUAL(sl.sourceId, expected.sourceId);
+    }
+    BOOST_CHECK_EQUAL(i, indices.size());
+  }
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(MaterialStates) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  const Surface* sensitive = nullptr;
+  geometry->visitSurfaces([&](const Surface* surface) {
+    if (sensitive == nullptr) {
+      sensitive = surface;
+    }
+  });
+  BOOST_REQUIRE_NE(sensitive, nullptr);
+
+  // passive surfaces which are not found by TrackingGeometry::findSurface
+  const Layer* layer =
+      geometry->associatedLayer(gctx, sensitive->center(gctx));
+  BOOST_REQUIRE_NE(layer, nullptr);
+  const Surface& layerSurface = layer->surfaceRepresentation();
+  const Surface& boundarySurface = geometry->highestTrackingVolume()
+                                       ->boundarySurfaces()
+                                       .front()
+                                       ->surfaceRepresentation();
+  BOOST_CHECK_EQUAL(geometry->findSurface(layerSurface.geometryId()),
+                    nullptr);
+
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  auto track = tc.getTrack(tc.addTrack());
+  auto previous = MultiTrajectoryTraits::kInvalid;
+  for (const Surface* surface : {&layerSurface, sensitive, &boundarySurface}) {
+    const bool isMaterial = surface != sensitive;
+    auto ts = tc.trackStateContainer().getTrackState(
+        tc.trackStateContainer().addTrackState(
+            isMaterial ? TrackStatePropMask::Predicted
+                       : TrackStatePropMask::All,
+            previous));
+    TestTrackState pc(rng, 2);
+    pc.sourceLink.m_geometryId = surface->geometryId();
+    fillTrackState<VectorMultiTrajectory>(
+        pc,
+        isMaterial ? TrackStatePropMask::Predicted : TrackStatePropMask::All,
+        ts);
+    if (isMaterial) {
+      ts.typeFlags().set(TrackStateFlag::MaterialFlag);
+    }
+    ts.setReferenceSurface(surface->getSharedPtr());
+    previous = ts.index();
+  }
+  track.tipIndex() = previous;
+  track.setReferenceSurface(layerSurface.getSharedPtr());
+
+  const auto path =
+      (std::filesystem::temp_directory_path() / "acts_mapped_material.bin")
+          .string();
+  MappedTrackFile::SourceLinkEncoder encoder;
+  encoder.connect<&encode>();
+  MappedTrackFile::write(path, gctx, tc.container(), tc.trackStateContainer(),
+                         encoder);
+
+  MappedTrackFile::SourceLinkDecoder decoder;
+  decoder.connect<&decode>();
+  MappedTrackFile file(path, *geometry, decoder);
+  TrackContainer mapped{file.tracks(), file.trajectory()};
+  BOOST_REQUIRE_EQUAL(mapped.size(), 1u);
+  BOOST_CHECK_EQUAL(&mapped.getTrack(0).referenceSurface(), &layerSurface);
+
+  std::size_t nStates = 0;
+  for (const auto mts : mapped.getTrack(0).trackStates()) {
+    auto ts = tc.trackStateContainer().getTrackState(mts.index());
+    BOOST_CHECK_EQUAL(&mts.referenceSurface(), &ts.referenceSurface());
+    BOOST_CHECK_EQUAL(mts.typeFlags().test(TrackStateFlag::MaterialFlag),
+                      ts.typeFlags().test(TrackStateFlag::MaterialFlag));
+    BOOST_CHECK_EQUAL(mts.hasFiltered(), ts.hasFiltered());
+    BOOST_CHECK_EQUAL(mts.predicted(), ts.predicted());
+    ++nStates;
+  }
+  BOOST_CHECK_EQUAL(nStates, 3u);
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(PackedStates) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  std::vector<const Surface*> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.trackStateContainer().addColumn<double>("weight");
+  auto track = tc.getTrack(tc.addTrack());
+  auto previous = MultiTrajectoryTraits::kInvalid;
+  for (unsigned int i = 0; i < 4; ++i) {
+    TestTrackState pc(rng, 2);
+    pc.sourceLink.m_geometryId = surfaces[i]->geometryId();
+    auto ts = tc.trackStateContainer().getTrackState(
+        tc.trackStateContainer().addTrackState(TrackStatePropMask::All,
+                                               previous));
+    fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+    ts.setReferenceSurface(surfaces[i]->getSharedPtr());
+    ts.template component<double>("weight") = 0.5 * i;
+    previous = ts.index();
+  }
+  track.tipIndex() = previous;
+  track.setReferenceSurface(surfaces[0]->getSharedPtr());
+
+  const auto path =
+      (std::filesystem::temp_directory_path() / "acts_mapped_packed.bin")
+          .string();
+  MappedTrackFile::SourceLinkEncoder encoder;
+  encoder.connect<&encode>();
+  MappedTrackFile::SourceLinkDecoder decoder;
+  decoder.connect<&decode>();
+
+  const auto& trajectory = tc.trackStateContainer();
+  PackedMultiTrajectory<float> packed{trajectory};
+
+  // expanded values need to be packed first
+  packed.getTrackState(0).predictedCovariance();
+  BOOST_CHECK_THROW(
+      MappedTrackFile::write(path, gctx, tc.container(), packed, encoder),
+      std::invalid_argument);
+  packed.pack();
+  MappedTrackFile::write(path, gctx, tc.container(), packed, encoder);
+
+  MappedTrackFile file(path, *geometry, decoder);
+  BOOST_REQUIRE_EQUAL(file.trajectory().size(), trajectory.size());
+  for (unsigned int i = 0; i < trajectory.size(); ++i) {
+    auto ts = trajectory.getTrackState(i);
+    auto pts = packed.getTrackState(i);
+    auto mts = file.trajectory().getTrackState(i);
+    BOOST_CHECK_EQUAL(mts.predicted(), pts.predicted());
+    BOOST_CHECK_EQUAL(mts.filteredCovariance(), pts.filteredCovariance());
+    BOOST_CHECK_EQUAL(mts.smoothedCovariance(), pts.smoothedCovariance());
+    CHECK_CLOSE_REL(mts.smoothed(), ts.smoothed(), 1e-6);
+    BOOST_CHECK(not mts.hasJacobian());
+    BOOST_CHECK_EQUAL(mts.effectiveCalibrated(), ts.effectiveCalibrated());
+    BOOST_CHECK_EQUAL(&mts.referenceSurface(), &ts.referenceSurface());
+    BOOST_CHECK_EQUAL(mts.template component<double>("weight"), 0.5 * i);
+  }
+  std::remove(path.c_str());
+
+  // Jacobians in double precision are kept on request
+  PackedMultiTrajectory<double> withJacobians{trajectory, true};
+  MappedTrackFile::write(path, gctx, tc.container(), withJacobians, encoder);
+  MappedTrackFile jacobianFile(path, *geometry, decoder);
+  for (unsigned int i = 0; i < trajectory.size(); ++i) {
+    auto ts = trajectory.getTrackState(i);
+    auto pts = withJacobians.getTrackState(i);
+    auto mts = jacobianFile.trajectory().getTrackState(i);
+    BOOST_CHECK_EQUAL(mts.jacobian(), ts.jacobian());
+    BOOST_CHECK_EQUAL(mts.filteredCovariance(), pts.filteredCovariance());
+  }
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedFile) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  auto track = tc.getTrack(tc.addTrack());
+  auto ts = tc.trackStateContainer().getTrackState(
+      tc.trackStateContainer().addTrackState(TrackStatePropMask::All));
+  TestTrackState pc(rng, 2);
+  fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+  track.tipIndex() = ts.index();
+
+  const auto path =
+      (std::filesystem::temp_directory_path() / "acts_mapped_truncated.bin")
+          .string();
+  MappedTrackFile::SourceLinkEncoder encoder;
+  encoder.connect<&encode>();
+  MappedTrackFile::write(path, gctx, tc.container(), tc.trackStateContainer(),
+                         encoder);
+  const auto size = std::filesystem::file_size(path);
+  std::filesystem::resize_file(path, size - 8);
+
+  MappedTrackFile::SourceLinkDecoder decoder;
+  decoder.connect<&decode>();
+  BOOST_CHECK_THROW(MappedTrackFile(path, *geometry, decoder),
+                    std::runtime_error);
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidFile) {
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  MappedTrackFile::SourceLinkDecoder decoder;
+  decoder.connect<&decode>();
+
+  BOOST_CHECK_THROW(MappedTrackFile("/does/not/exist", *geometry, decoder),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -190,6 +190,66 @@ BOOST_AUTO_TEST_CASE(MultiTrajectoryExtraColumnsRuntime) {
   ct.testMultiTrajectoryExtraColumnsRuntime();
 }
 
+BOOST_AUTO_TEST_CASE(Compact) {
+  VectorMultiTrajectory mt;
+  mt.addColumn<unsigned int>("hits");
+
+  auto fill = [&](auto ts, unsigned int i) {
+    ts.predicted() = ParametersVector::Constant(i);
+    ts.filtered() = ParametersVector::Constant(10 + i);
+    ts.jacobian() = Jacobian::Identity() * i;
+    ts.allocateCalibrated(2);
+    ts.template calibrated<2>() = Vector2::Constant(20 + i);
+    ts.template calibratedCovariance<2>() = SymMatrix2::Identity() * i;
+    ts.template component<unsigned int>("hits") = i;
+  };
+
+  // a state which is not considered, followed by the branches
+  // 1 - 2 - 4 and 1 - 3 with 4 sharing the prediction of 3
+  auto i0 = mt.addTrackState();
+  auto i1 = mt.addTrackState(TrackStatePropMask::All, i0);
+  auto i2 = mt.addTrackState(TrackStatePropMask::All, i1);
+  auto i3 = mt.addTrackState(TrackStatePropMask::All, i1);
+  auto i4 = mt.addTrackState(TrackStatePropMask::All, i2);
+  for (auto i : {i0, i1, i2, i3, i4}) {
+    fill(mt.getTrackState(i), i);
+  }
+  mt.getTrackState(i4).shareFrom(mt.getTrackState(i3),
+                                 TrackStatePropMask::Predicted);
+
+  BOOST_CHECK_THROW(mt.compact({}, 6), std::out_of_range);
+
+  auto remap = mt.compact({i4}, i1);
+  BOOST_CHECK_EQUAL(mt.size(), 4u);
+  BOOST_CHECK_EQUAL(remap.size(), 4u);
+  BOOST_CHECK_EQUAL(remap[i1 - i1], i1);
+  BOOST_CHECK_EQUAL(remap[i2 - i1], i2);
+  BOOST_CHECK_EQUAL(remap[i3 - i1], MultiTrajectoryTraits::kInvalid);
+  BOOST_CHECK_EQUAL(remap[i4 - i1], 3u);
+
+  std::vector<unsigned int> expected = {4, 2, 1, 0};
+  std::vector<unsigned int> visited;
+  mt.visitBackwards(3u, [&](const auto& ts) {
+    unsigned int i = visited.empty() ? 4u : ts.index();
+    visited.push_back(i);
+    BOOST_CHECK_EQUAL(ts.filtered(), ParametersVector::Constant(10 + i));
+    BOOST_CHECK_EQUAL(ts.jacobian(), Jacobian::Identity() * i);
+    BOOST_CHECK_EQUAL(ts.template calibrated<2>(), Vector2::Constant(20 + i));
+    BOOST_CHECK_EQUAL(ts.template calibratedCovariance<2>(),
+                      SymMatrix2::Identity() * i);
+    BOOST_CHECK_EQUAL(ts.template component<unsigned int>("hits"), i);
+  });
+  BOOST_CHECK_EQUAL_COLLECTIONS(visited.begin(), visited.end(),
+                                expected.begin(), expected.end());
+  // the shared prediction of the removed state survives
+  BOOST_CHECK_EQUAL(mt.getTrackState(3u).predicted(),
+                    ParametersVector::Constant(i3));
+
+  // removing everything
+  mt.compact({}, 0);
+  BOOST_CHECK_EQUAL(mt.size(), 0u);
+}
+
 BOOST_AUTO_TEST_CASE(MemoryStats) {
   using namespace boost::histogram;
   using cat = axis::category<std::string>;
@@ -0,0 +1,245 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/PackedMultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/MultiTrajectoryTestsCommon.hpp"
+#include "Acts/Tests/CommonHelpers/TestTrackState.hpp"
+
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+
+// fixed seed for reproducible tests
+std::default_random_engine rng(31415);
+
+template <typename scalar_t>
+struct Factory {
+  using trajectory_t = PackedMultiTrajectory<scalar_t>;
+  using const_trajectory_t = PackedMultiTrajectory<scalar_t>;
+
+  trajectory_t create() { return {}; }
+};
+
+using factory_types = std::tuple<Factory<double>, Factory<float>>;
+
+VectorMultiTrajectory makeTrajectory() {
+  VectorMultiTrajectory mt;
+  mt.addColumn<unsigned int>("hits");
+
+  auto previous = MultiTrajectoryTraits::kInvalid;
+  for (unsigned int i = 0; i < 4; ++i) {
+    TestTrackState pc(rng, 1 + i % 2);
+    auto ts = mt.getTrackState(mt.addTrackState(TrackStatePropMask::All,
+                                                previous));
+    fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+    ts.template component<unsigned int>("hits") = i;
+    previous = ts.index();
+  }
+  // shared components stay shared
+  mt.getTrackState(3).shareFrom(mt.getTrackState(2),
+                                TrackStatePropMask::Predicted);
+  return mt;
+}
+
+template <typename packed_t>
+void checkPacked(const VectorMultiTrajectory& mt, const packed_t& packed,
+                 double tolerance, bool jacobians) {
+  BOOST_REQUIRE_EQUAL(packed.size(), mt.size());
+  for (unsigned int i = 0; i < mt.size(); ++i) {
+    auto ts = mt.getTrackState(i);
+    auto pts = packed.getTrackState(i);
+
+    BOOST_CHECK_EQUAL(pts.previous(), ts.previous());
+    BOOST_CHECK_EQUAL(pts.chi2(), ts.chi2());
+    BOOST_CHECK_EQUAL(pts.calibratedSize(), ts.calibratedSize());
+    BOOST_CHECK_EQUAL(pts.projectorBitset(), ts.projectorBitset());
+    BOOST_CHECK_EQUAL(pts.effectiveCalibrated(), ts.effectiveCalibrated());
+    BOOST_CHECK_EQUAL(pts.template component<unsigned int>("hits"), i);
+    BOOST_CHECK_EQUAL(&pts.referenceSurface(), &ts.referenceSurface());
+
+    CHECK_CLOSE_REL(pts.predicted(), ts.predicted(), tolerance);
+    CHECK_CLOSE_REL(pts.filtered(), ts.filtered(), tolerance);
+    CHECK_CLOSE_REL(pts.smoothed(), ts.smoothed(), tolerance);
+    CHECK_CLOSE_COVARIANCE(pts.predictedCovariance(), ts.predictedCovariance(),
+                           tolerance);
+    CHECK_CLOSE_COVARIANCE(pts.filteredCovariance(), ts.filteredCovariance(),
+                           tolerance);
+    CHECK_CLOSE_COVARIANCE(pts.smoothedCovariance(), ts.smoothedCovariance(),
+                           tolerance);
+
+    BOOST_CHECK_EQUAL(pts.hasJacobian(), jacobians);
+    if (jacobians) {
+      CHECK_CLOSE_REL(pts.jacobian(), ts.jacobian(), tolerance);
+    }
+  }
+  auto predictedIndex = [&packed](unsigned int i) {
+    return packed.getTrackState(i)
+        .template component<MultiTrajectoryTraits::IndexType,
+                            hashString("predicted")>();
+  };
+  BOOST_CHECK_EQUAL(predictedIndex(3), predictedIndex(2));
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataPackedMultiTrajectory)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Build, factory_t, factory_types) {
+  MultiTrajectoryTestsCommon<factory_t> ct;
+  ct.testBuild();
+  ct.testClear();
+  ct.testAddTrackStateWithBitMask();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(TrackStateProxy, factory_t, factory_types) {
+  MultiTrajectoryTestsCommon<factory_t> ct;
+  ct.testTrackStateProxyCrossTalk(rng);
+  ct.testTrackStateReassignment(rng);
+  ct.testTrackStateProxyStorage(rng, 2u);
+  ct.testTrackStateProxyAllocations(rng);
+  ct.testTrackStateProxyCopy(rng);
+  ct.testTrackStateProxyShare(rng);
+  ct.testMultiTrajectoryExtraColumns();
+}
+
+BOOST_AUTO_TEST_CASE(DoublePrecision) {
+  auto mt = makeTrajectory();
+
+  PackedMultiTrajectory<double> packed{mt};
+  checkPacked(mt, packed, 1e-12, false);
+
+  // symmetric covariances without Jacobians
+  BOOST_CHECK_EQUAL(packed.packedBytes(),
+                    3 * 4 * (eBoundSize + 21) * sizeof(double));
+
+  PackedMultiTrajectory<double> withJacobians{mt, true};
+  checkPacked(mt, withJacobians, 1e-12, true);
+}
+
+BOOST_AUTO_TEST_CASE(SinglePrecision) {
+  auto mt = makeTrajectory();
+
+  PackedMultiTrajectory<float> packed{mt, true};
+  checkPacked(mt, packed, 1e-6, true);
+
+  // expanded values are owned by the trajectory and keep their address
+  std::vector<const double*> addresses;
+  std::vector<BoundSymMatrix> expected;
+  for (unsigned int n = 0; n < 10; ++n) {
+    for (unsigned int i = 0; i < packed.size(); ++i) {
+      auto cov = packed.getTrackState(i).filteredCovariance();
+      if (n == 0) {
+        addresses.push_back(cov.data());
+        expected.push_back(cov);
+      }
+      BOOST_CHECK_EQUAL(cov.data(), addresses[i]);
+    }
+  }
+  for (unsigned int i = 0; i < packed.size(); ++i) {
+    BOOST_CHECK_EQUAL(Eigen::Map<const BoundSymMatrix>(addresses[i]),
+                      expected[i]);
+  }
+  BOOST_CHECK_GT(packed.expandedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(Pack) {
+  using PackedFloat = PackedMultiTrajectory<float>;
+  const BoundVector params = BoundVector::Constant(1. / 3.);
+  const BoundSymMatrix cov =
+      BoundSymMatrix::Identity() + BoundSymMatrix::Constant(1e-9);
+  const Eigen::Matrix<float, eBoundSize, 1> roundedParams = params.cast<float>();
+  const Eigen::Matrix<float, eBoundSize, eBoundSize> roundedCov = cov.cast<float>();
+
+  for (bool keepJacobians : {false, true}) {
+    PackedFloat packed{keepJacobians};
+    for (unsigned int i = 0; i < 3; ++i) {
+      auto ts = packed.getTrackState(packed.addTrackState(
+          TrackStatePropMask::Predicted | TrackStatePropMask::Jacobian));
+      ts.predicted() = params;
+      ts.predictedCovariance() = cov;
+      ts.jacobian() = BoundMatrix::Identity() * i;
+    }
+
+    // values are not rounded before packing
+    BOOST_CHECK_EQUAL(packed.getTrackState(1).predicted(), params);
+    BOOST_CHECK_EQUAL(packed.getTrackState(1).predictedCovariance(), cov);
+    BOOST_CHECK_GT(packed.expandedBytes(), 0u);
+
+    packed.pack();
+    BOOST_CHECK_EQUAL(packed.expandedBytes(), 0u);
+    BOOST_CHECK_EQUAL(packed.packedBytes(),
+                      3 * (eBoundSize + PackedFloat::kPackedCovarianceSize +
+                           (keepJacobians ? eBoundSize * eBoundSize : 0)) *
+                          sizeof(float));
+
+    auto ts = packed.getTrackState(2);
+    BOOST_CHECK_EQUAL(ts.predicted(), roundedParams.cast<double>());
+    BOOST_CHECK_EQUAL(ts.predictedCovariance(), roundedCov.cast<double>());
+    BOOST_CHECK_EQUAL(ts.hasJacobian(), keepJacobians);
+    if (keepJacobians) {
+      BOOST_CHECK_EQUAL(ts.jacobian(), BoundMatrix::Identity() * 2);
+    }
+
+    // track states can still be added after packing
+    auto added = packed.getTrackState(packed.addTrackState());
+    added.filtered() = params;
+    BOOST_CHECK_EQUAL(added.filtered(), params);
+    BOOST_CHECK_EQUAL(packed.getTrackState(2).predicted(), ts.predicted());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentReads) {
+  auto mt = makeTrajectory();
+  PackedMultiTrajectory<float> packed{mt, true};
+
+  // the first access expands the values, all threads see the same ones
+  std::vector<std::vector<BoundSymMatrix>> covariances(4);
+  std::vector<std::thread> threads;
+  for (auto& threadCovariances : covariances) {
+    threads.emplace_back([&packed, &threadCovariances]() {
+      const auto& cpacked = packed;
+      for (unsigned int n = 0; n < 100; ++n) {
+        for (unsigned int i = 0; i < cpacked.size(); ++i) {
+          auto pts = cpacked.getTrackState(i);
+          threadCovariances.push_back(pts.filteredCovariance() +
+                                      pts.predictedCovariance());
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& threadCovariances : covariances) {
+    BOOST_REQUIRE_EQUAL(threadCovariances.size(), 100 * mt.size());
+    for (std::size_t i = 0; i < threadCovariances.size(); ++i) {
+      auto ts = mt.getTrackState(i % mt.size());
+      CHECK_CLOSE_COVARIANCE(threadCovariances[i],
+                             BoundSymMatrix(ts.filteredCovariance() +
+                                            ts.predictedCovariance()),
+                             1e-6);
+    }
+  }
+  checkPacked(mt, packed, 1e-6, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
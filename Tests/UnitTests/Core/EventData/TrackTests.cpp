@@ -666,6 +666,79 @@ BOOST_AUTO_TEST_CASE(EnsureDynamicColumns) {
   BOOST_CHECK(tc2.hasColumn("odd"));
 }
 
+BOOST_AUTO_TEST_CASE(AppendContainers) {
+  auto fill = [](auto& tc, size_t i) {
+    auto t = tc.getTrack(tc.addTrack());
+    for (size_t j = 0; j < 3; j++) {
+      auto ts = t.appendTrackState();
+      ts.predicted() = BoundVector::Ones() * (i + j);
+      ts.filtered() = BoundVector::Ones() * (i - j);
+      ts.allocateCalibrated(2);
+      ts.template calibrated<2>() = Vector2::Ones() * (i * j);
+      if (j > 0) {
+        // share the predicted parameters with the previous state
+        ts.shareFrom(tc.trackStateContainer().getTrackState(ts.previous()),
+                     TrackStatePropMask::Predicted);
+      }
+    }
+    t.parameters() = BoundVector::Ones() * i;
+    t.template component<size_t>("counter") = i;
+  };
+
+  // all tracks in one container
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.addColumn<size_t>("counter");
+  for (size_t i = 0; i < 6; i++) {
+    fill(tc, i);
+  }
+
+  // the same tracks in two containers which are then appended
+  TrackContainer tcA{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  TrackContainer tcB{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tcA.addColumn<size_t>("counter");
+  tcB.addColumn<size_t>("counter");
+  for (size_t i = 0; i < 6; i++) {
+    fill(i < 2 ? tcA : tcB, i);
+  }
+  auto offset = tcA.trackStateContainer().append(tcB.trackStateContainer());
+  BOOST_CHECK_EQUAL(offset, 6u);
+  tcA.container().append(tcB.container(), offset);
+
+  BOOST_REQUIRE_EQUAL(tcA.size(), tc.size());
+  BOOST_CHECK_EQUAL(tcA.trackStateContainer().size(),
+                    tc.trackStateContainer().size());
+  for (size_t i = 0; i < tc.size(); i++) {
+    auto t = tc.getTrack(i);
+    auto tA = tcA.getTrack(i);
+    BOOST_CHECK_EQUAL(t.tipIndex(), tA.tipIndex());
+    BOOST_CHECK_EQUAL(t.parameters(), tA.parameters());
+    BOOST_CHECK_EQUAL(t.template component<size_t>("counter"),
+                      tA.template component<size_t>("counter"));
+    BOOST_REQUIRE_EQUAL(t.nTrackStates(), tA.nTrackStates());
+    for (auto [ts, tsA] : zip(t.trackStates(), tA.trackStates())) {
+      BOOST_CHECK_EQUAL(ts.index(), tsA.index());
+      BOOST_CHECK_EQUAL(ts.predicted(), tsA.predicted());
+      BOOST_CHECK_EQUAL(ts.filtered(), tsA.filtered());
+      BOOST_CHECK_EQUAL(ts.template calibrated<2>(),
+                        tsA.template calibrated<2>());
+      if (tsA.hasPrevious()) {
+        // the shared parameters still point to the same storage
+        BOOST_CHECK_EQUAL(tsA.predicted().data(), tcA.trackStateContainer()
+                                                      .getTrackState(
+                                                          tsA.previous())
+                                                      .predicted()
+                                                      .data());
+      }
+    }
+  }
+
+  // the dynamic columns have to match
+  TrackContainer tcC{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  fill(tcB, 6);
+  BOOST_CHECK_THROW(tcC.container().append(tcB.container(), 0),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(AppendTrackState) {
   TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
   auto t = tc.getTrack(tc.addTrack());
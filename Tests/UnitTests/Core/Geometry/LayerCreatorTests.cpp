@@ -17,6 +17,8 @@
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Geometry/ProtoLayer.hpp"
 #include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Geometry/SurfaceCandidateCache.hpp"
+#include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
@@ -30,6 +32,7 @@
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Range1D.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
 
 #include <algorithm>
 #include <array>
@@ -38,6 +41,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <utility>
@@ -469,6 +473,128 @@ BOOST_FIXTURE_TEST_CASE(LayerCreator_barrelStagger, LayerCreatorFixture) {
   checkBinning(tgContext, *layer->surfaceArray());
 }
 
+BOOST_FIXTURE_TEST_CASE(LayerCreator_surfaceCandidateCache,
+                        LayerCreatorFixture) {
+  SrfVec srf = makeBarrel(30, 7, 2, 1.5);
+  ProtoLayer pl(tgContext, srf);
+  pl.envelope[Acts::binR] = {0.1, 0.1};
+  pl.envelope[Acts::binZ] = {0.5, 0.5};
+
+  LayerCreator::Config cfg;
+  cfg.surfaceArrayCreator = p_SAC;
+  cfg.surfaceCandidateCache = true;
+  LayerCreator cachedCreator(cfg);
+
+  auto layer = p_LC->cylinderLayer(tgContext, srf, 30, 7, pl);
+  auto cachedLayer = cachedCreator.cylinderLayer(tgContext, srf, 30, 7, pl);
+  BOOST_CHECK_EQUAL(layer->surfaceCandidateCache(), nullptr);
+  BOOST_REQUIRE_NE(cachedLayer->surfaceCandidateCache(), nullptr);
+  BOOST_CHECK_EQUAL(cachedLayer->surfaceCandidateCache()->size(),
+                    cachedLayer->surfaceArray()->size());
+
+  // the layers only share the sensitive surfaces, the others are labelled
+  // by their role on the layer
+  auto found = [&](const Layer& lay, const Vector3& position,
+                   const Vector3& direction,
+                   const NavigationOptions<Surface>& options) {
+    const auto& approach = lay.approachDescriptor()->containedSurfaces();
+    std::vector<std::pair<double, size_t>> result;
+    for (const auto& sfi :
+         lay.compatibleSurfaces(tgContext, position, direction, options)) {
+      auto sit = std::find_if(srf.begin(), srf.end(), [&](const auto& s) {
+        return s.get() == sfi.object;
+      });
+      auto ait = std::find(approach.begin(), approach.end(), sfi.object);
+      size_t label = srf.size() + approach.size();
+      if (sit != srf.end()) {
+        label = std::distance(srf.begin(), sit);
+      } else if (ait != approach.end()) {
+        label = srf.size() + std::distance(approach.begin(), ait);
+      }
+      result.emplace_back(sfi.intersection.pathLength, label);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  // the cached layer must find exactly the same surfaces
+  auto check = [&](const Vector3& position, const Vector3& direction,
+                   const NavigationOptions<Surface>& options) {
+    auto expected = found(*layer, position, direction, options);
+    auto actual = found(*cachedLayer, position, direction, options);
+    BOOST_CHECK(actual == expected);
+    return expected.size();
+  };
+
+  std::default_random_engine rng(1234);
+  std::uniform_real_distribution<> rDist(9.5, 10.7);
+  std::uniform_real_distribution<> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<> zDist(-15, 15);
+  std::uniform_real_distribution<> thetaDist(0.1, M_PI - 0.1);
+
+  size_t nFound = 0;
+  for (size_t i = 0; i < 1000; ++i) {
+    double r = rDist(rng);
+    double phi = phiDist(rng);
+    Vector3 position(r * std::cos(phi), r * std::sin(phi), zDist(rng));
+    Vector3 direction =
+        makeDirectionUnitFromPhiTheta(phiDist(rng), thetaDist(rng));
+
+    for (auto navDir : {Direction::Forward, Direction::Backward}) {
+      NavigationOptions<Surface> options(navDir, true, true, true, true);
+      nFound += check(position, direction, options);
+      options.boundaryCheck = BoundaryCheck(true, true, 0.5, 0.5);
+      nFound += check(position, direction, options);
+      options.boundaryCheck = BoundaryCheck(false);
+      nFound += check(position, direction, options);
+    }
+  }
+  // make sure the comparison is not trivial
+  BOOST_CHECK_GT(nFound, 1000u);
+}
+
+BOOST_FIXTURE_TEST_CASE(LayerCreator_surfaceCandidateCacheContext,
+                        LayerCreatorFixture) {
+  SrfVec srf = makeBarrel(30, 7, 2, 1.5);
+  ProtoLayer pl(tgContext, srf);
+  pl.envelope[Acts::binR] = {0.1, 0.1};
+  pl.envelope[Acts::binZ] = {0.5, 0.5};
+
+  LayerCreator::Config cfg;
+  cfg.surfaceArrayCreator = p_SAC;
+  cfg.surfaceCandidateCache = true;
+  LayerCreator cachedCreator(cfg);
+  auto cachedLayer = cachedCreator.cylinderLayer(tgContext, srf, 30, 7, pl);
+  BOOST_REQUIRE_NE(cachedLayer->surfaceCandidateCache(), nullptr);
+
+  // contexts with a value may move the surfaces
+  GeometryContext alignedContext(1);
+  const auto& cache = *cachedLayer->surfaceCandidateCache();
+  BOOST_CHECK(cache.isValid(tgContext));
+  BOOST_CHECK(not cache.isValid(alignedContext));
+
+  // a cache built with such a context is never used
+  SurfaceCandidateCache alignedCache(alignedContext,
+                                     *cachedLayer->surfaceArray());
+  BOOST_CHECK(not alignedCache.isValid(tgContext));
+  BOOST_CHECK(not alignedCache.isValid(alignedContext));
+
+  // the fallback to the uncached lookup finds the same surfaces
+  NavigationOptions<Surface> options(Direction::Forward, true, true, true,
+                                     true);
+  Vector3 position(10, 0, 0);
+  Vector3 direction(1, 0, 0);
+  auto nominal =
+      cachedLayer->compatibleSurfaces(tgContext, position, direction, options);
+  auto aligned = cachedLayer->compatibleSurfaces(alignedContext, position,
+                                                 direction, options);
+  BOOST_CHECK(not nominal.empty());
+  BOOST_REQUIRE_EQUAL(aligned.size(), nominal.size());
+  for (size_t i = 0; i < nominal.size(); ++i) {
+    BOOST_CHECK_EQUAL(aligned[i].object, nominal[i].object);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 
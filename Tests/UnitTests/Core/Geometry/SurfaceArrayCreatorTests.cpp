@@ -38,6 +38,7 @@
 #include <iomanip>
 #include <iterator>
 #include <memory>
+#include <random>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -740,6 +741,63 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArrayCreator_barrelStagger,
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SurfaceArrayCreator_flatLookup,
+                        SurfaceArrayCreatorFixture) {
+  SurfaceArrayCreator::Config cfg;
+  cfg.flatLookup = true;
+  SurfaceArrayCreator flatSAC(cfg);
+
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<> uniform(-30, 30);
+
+  // the flat lookup must find the same bins and neighbors as the grid
+  auto compare = [&](const SurfaceArray& grid, const SurfaceArray& flat) {
+    BOOST_CHECK(not grid.hasFlatLookup());
+    BOOST_REQUIRE(flat.hasFlatLookup());
+    for (size_t i = 0; i < 1000; ++i) {
+      Vector3 position(uniform(rng), uniform(rng), uniform(rng));
+      BOOST_CHECK_EQUAL(flat.globalBinFromPosition(position),
+                        grid.globalBinFromPosition(position));
+
+      const SurfaceVector& neighbors = grid.neighbors(position);
+      SurfaceArray::SurfaceRange range = flat.neighborRange(position);
+      std::set<const Surface*> exp(neighbors.begin(), neighbors.end());
+      std::set<const Surface*> act(range.begin(), range.end());
+      BOOST_CHECK(act == exp);
+      BOOST_CHECK_EQUAL(range.size(), act.size());
+    }
+  };
+
+  SrfVec barrel = makeBarrel(30, 7, 2, 1.5);
+  compare(*m_SAC.surfaceArrayOnCylinder(tgContext, barrel, 30, 7),
+          *flatSAC.surfaceArrayOnCylinder(tgContext, barrel, 30, 7));
+  compare(*m_SAC.surfaceArrayOnCylinder(tgContext, barrel, arbitrary,
+                                        arbitrary),
+          *flatSAC.surfaceArrayOnCylinder(tgContext, barrel, arbitrary,
+                                          arbitrary));
+
+  SrfVec endcap = fullPhiTestSurfacesEC(10, 0, 0, 10, 2, 3);
+  SrfVec ringB = fullPhiTestSurfacesEC(15, 0, 0, 15, 2, 3.5);
+  endcap.insert(endcap.end(), ringB.begin(), ringB.end());
+  compare(*m_SAC.surfaceArrayOnDisc(tgContext, endcap, 2, 10),
+          *flatSAC.surfaceArrayOnDisc(tgContext, endcap, 2, 10));
+  compare(*m_SAC.surfaceArrayOnDisc(tgContext, endcap, arbitrary, arbitrary),
+          *flatSAC.surfaceArrayOnDisc(tgContext, endcap, arbitrary,
+                                      arbitrary));
+
+  SrfVec plane;
+  auto bounds = std::make_shared<const RectangleBounds>(1.5, 2);
+  for (int ix = 0; ix < 5; ++ix) {
+    for (int iy = 0; iy < 4; ++iy) {
+      Transform3 trans = Transform3::Identity();
+      trans.translate(Vector3(3. * ix - 6., 4. * iy - 6., 0.));
+      plane.push_back(Surface::makeShared<PlaneSurface>(trans, bounds));
+    }
+  }
+  compare(*m_SAC.surfaceArrayOnPlane(tgContext, plane, 5, 4, binZ),
+          *flatSAC.surfaceArrayOnPlane(tgContext, plane, 5, 4, binZ));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <functional>
 #include <optional>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -174,6 +175,120 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(c.isInside(transformPos((pos << 0, 2, -4.7).finished())));
   BOOST_CHECK(not c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_xyz_cell_coefficients) {
+  // trilinear in x, y and z so the interpolation and its gradient are exact
+  auto value = [](const Vector3& pos) {
+    return Vector3(pos.x() * pos.y(), pos.y() * pos.z() + pos.x(),
+                   pos.x() * pos.y() * pos.z());
+  };
+  auto gradient = [](const Vector3& pos) {
+    ActsMatrix<3, 3> grad;
+    grad << pos.y(), pos.x(), 0,  //
+        1, pos.z(), pos.y(),      //
+        pos.y() * pos.z(), pos.x() * pos.z(), pos.x() * pos.y();
+    return grad;
+  };
+
+  auto transformPos = [](const Vector3& pos) { return pos; };
+  auto transformBField = [](const Vector3& field, const Vector3&) {
+    return field;
+  };
+
+  using Grid_t = detail::Grid<Vector3, detail::EquidistantAxis,
+                              detail::EquidistantAxis, detail::EquidistantAxis>;
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  Grid_t g(std::make_tuple(detail::EquidistantAxis(-3., 3., 6u),
+                           detail::EquidistantAxis(-2., 4., 5u),
+                           detail::EquidistantAxis(-5., 7., 9u)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        const auto& llCorner = g.lowerLeftBinEdge(indices);
+        g.atLocalBins(indices) =
+            value(Vector3(llCorner[0], llCorner[1], llCorner[2]));
+      }
+    }
+  }
+
+  BField_t reference{{transformPos, transformBField, g}};
+  BField_t::Config cfg{transformPos, transformBField, g};
+  cfg.useCellCoefficients = true;
+  BField_t b{cfg};
+
+  auto referenceCache = reference.makeCache(mfContext);
+  auto bCache = b.makeCache(mfContext);
+
+  for (const Vector3& pos : {Vector3(0.1, 0.2, 0.3), Vector3(-2.9, -1.9, -4.9),
+                            Vector3(1.95, 2.75, 5.6), Vector3(1., 1., 1.),
+                            Vector3(-1.3, 2.7, 5.1)}) {
+    BOOST_CHECK(b.isInside(pos));
+    CHECK_CLOSE_ABS(b.getField(pos, bCache).value(), value(pos), 1e-9);
+    CHECK_CLOSE_ABS(b.getField(pos, bCache).value(),
+                    reference.getField(pos, referenceCache).value(), 1e-9);
+    CHECK_CLOSE_ABS(b.getField(pos).value(), value(pos), 1e-9);
+    CHECK_CLOSE_ABS(b.getFieldUnchecked(pos), value(pos), 1e-9);
+
+    ActsMatrix<3, 3> deriv = ActsMatrix<3, 3>::Zero();
+    CHECK_CLOSE_ABS(b.getFieldGradient(pos, deriv, bCache).value(), value(pos),
+                    1e-9);
+    CHECK_CLOSE_ABS(deriv, gradient(pos), 1e-9);
+  }
+
+  ActsMatrix<3, 3> deriv;
+  Vector3 outside(2.5, 0., 0.);
+  BOOST_CHECK(!b.isInside(outside));
+  BOOST_CHECK(!b.getField(outside, bCache).ok());
+  BOOST_CHECK(!b.getFieldGradient(outside, deriv, bCache).ok());
+
+  // a translated grid has the same gradient
+  const Vector3 shift(10., -20., 30.);
+  BField_t::Config shiftedCfg{
+      [shift](const Vector3& pos) { return Vector3(pos - shift); },
+      transformBField, g};
+  shiftedCfg.useCellCoefficients = true;
+  BField_t shifted{shiftedCfg};
+  auto shiftedCache = shifted.makeCache(mfContext);
+  for (const Vector3& pos : {Vector3(0.1, 0.2, 0.3), Vector3(-1.3, 2.7, 5.1)}) {
+    ActsMatrix<3, 3> shiftedDeriv = ActsMatrix<3, 3>::Zero();
+    CHECK_CLOSE_ABS(
+        shifted.getFieldGradient(pos + shift, shiftedDeriv, shiftedCache)
+            .value(),
+        value(pos), 1e-9);
+    CHECK_CLOSE_ABS(shiftedDeriv, gradient(pos), 1e-9);
+  }
+
+  // the gradient in grid coordinates is not the global gradient for scaled,
+  // rotated or curvilinear grids, so these are rejected
+  BField_t::Config scaledCfg{
+      [](const Vector3& pos) { return Vector3(2. * pos); }, transformBField,
+      g};
+  scaledCfg.useCellCoefficients = true;
+  BOOST_CHECK_THROW(BField_t{scaledCfg}, std::invalid_argument);
+
+  BField_t::Config rotatedCfg{
+      [](const Vector3& pos) { return Vector3(pos.y(), -pos.x(), pos.z()); },
+      [](const Vector3& field, const Vector3&) {
+        return Vector3(-field.y(), field.x(), field.z());
+      },
+      g};
+  rotatedCfg.useCellCoefficients = true;
+  BOOST_CHECK_THROW(BField_t{rotatedCfg}, std::invalid_argument);
+
+  BField_t::Config fieldScaledCfg{
+      transformPos,
+      [](const Vector3& field, const Vector3&) { return Vector3(3. * field); },
+      g};
+  fieldScaledCfg.useCellCoefficients = true;
+  BOOST_CHECK_THROW(BField_t{fieldScaledCfg}, std::invalid_argument);
+
+  // without cell coefficients any transformation is accepted
+  scaledCfg.useCellCoefficients = false;
+  BOOST_CHECK_NO_THROW(BField_t{scaledCfg});
+}
+
 }  // namespace Test
 
 }  // namespace Acts
@@ -8,8 +8,13 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldError.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+
+#include <vector>
 
 namespace tt = boost::test_tools;
 
@@ -77,6 +82,59 @@ BOOST_AUTO_TEST_CASE(CacheNonCopyable) {
   // a = std::make_any<MyCache>(42);
 }
 
+BOOST_AUTO_TEST_CASE(BatchFieldLookup) {
+  // uses the default batch implementation
+  struct PositionField final : public MagneticFieldProvider {
+    struct Cache {
+      Cache(const MagneticFieldContext& /*mctx*/) {}
+    };
+
+    MagneticFieldProvider::Cache makeCache(
+        const MagneticFieldContext& mctx) const override {
+      return MagneticFieldProvider::Cache::make<Cache>(mctx);
+    }
+
+    Result<Vector3> getField(const Vector3& position,
+                             MagneticFieldProvider::Cache& /*cache*/)
+        const override {
+      if (position.x() < 0) {
+        return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
+      }
+      return Result<Vector3>::success(position);
+    }
+
+    Result<Vector3> getFieldGradient(
+        const Vector3& position, ActsMatrix<3, 3>& /*derivative*/,
+        MagneticFieldProvider::Cache& cache) const override {
+      return getField(position, cache);
+    }
+  };
+
+  std::vector<Vector3> positions = {
+      {0, 0, 0}, {100, 0, 50}, {30, -40, 1000}, {1, 2, -3}};
+  std::vector<Vector3> fields;
+
+  const PositionField positionField;
+  const ConstantBField constantField(Vector3(1, 2, 3));
+  const SolenoidBField solenoidField({100, 1000, 20, 5});
+  for (const MagneticFieldProvider* field :
+       {static_cast<const MagneticFieldProvider*>(&positionField),
+        static_cast<const MagneticFieldProvider*>(&constantField),
+        static_cast<const MagneticFieldProvider*>(&solenoidField)}) {
+    auto cache = field->makeCache(mfContext);
+    BOOST_CHECK(field->getFields(positions, fields, cache).ok());
+    BOOST_CHECK_EQUAL(fields.size(), positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      BOOST_CHECK_EQUAL(fields[i],
+                        field->getField(positions[i], cache).value());
+    }
+  }
+
+  auto cache = positionField.makeCache(mfContext);
+  positions.push_back({-1, 0, 0});
+  BOOST_CHECK(!positionField.getFields(positions, fields, cache).ok());
+}
+
 }  // namespace Test
 
 }  // namespace Acts
@@ -113,5 +113,149 @@ BOOST_AUTO_TEST_CASE(TestSolenoidBField) {
   // outf.close();
 }
 
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldDivergence) {
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+
+  // the field is free of sources, in particular also close to the coil ends
+  // and off the axis where the elliptic integrals matter most
+  const double h = 1_mm;
+  for (const Vector3& position :
+       {Vector3{200_mm, 0, 1_m}, Vector3{300_mm, 400_mm, 2.8_m},
+        Vector3{-800_mm, 200_mm, -2.9_m}, Vector3{1_m, -50_mm, 3.5_m}}) {
+    BOOST_TEST_CONTEXT("position=" << position.transpose()) {
+      double divergence = 0;
+      for (size_t j = 0; j < 3; j++) {
+        Vector3 step = Vector3::Zero();
+        step[j] = h;
+        divergence += (bField.getField(Vector3(position + step))[j] -
+                       bField.getField(Vector3(position - step))[j]) /
+                      (2 * h);
+      }
+      CHECK_SMALL(divergence, 1e-8_T / 1_mm);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldAxisLimit) {
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+
+  // towards the axis the elliptic integrals have to approach the closed form
+  // used on the axis: B_z is continuous and, the field being free of
+  // sources, B_r = -r/2 dB_z/dz vanishes linearly
+  const double h = 1_mm;
+  for (double z : {0_m, 1_m, 2.5_m, 2.9_m, 3.5_m}) {
+    BOOST_TEST_CONTEXT("z=" << z) {
+      const Vector3 onAxis = bField.getField(Vector3{0, 0, z});
+      const double dBzdz = (bField.getField(Vector3{0, 0, z + h}).z() -
+                            bField.getField(Vector3{0, 0, z - h}).z()) /
+                           (2 * h);
+      for (double r : {1_mm, 10_um}) {
+        const Vector3 offAxis = bField.getField(Vector3{r, 0, z});
+        CHECK_CLOSE_ABS(offAxis.x(), -0.5 * r * dBzdz, 1e-6_T * r / 1_mm);
+        CHECK_SMALL(offAxis.y(), 1e-12_T);
+        CHECK_CLOSE_ABS(offAxis.z(), onAxis.z(), 1e-6_T);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldGradient) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+  auto cache = bField.makeCache(mfContext);
+
+  // the radial component vanishes on the axis and the field is homogeneous
+  // in the center of a long solenoid
+  CHECK_CLOSE_ABS(bField.getField(Vector3{1_mm, 0, 0}),
+                  Vector3(0, 0, 2.0_T), 1e-3_T);
+  CHECK_SMALL(bField.getField(Vector3{1_mm, 0, 2_m}).x(), 1e-3_T);
+
+  const double h = 1_mm;
+  for (const Vector3& position :
+       {Vector3{0, 0, 1_m}, Vector3{300_mm, 400_mm, 2.8_m},
+        Vector3{-800_mm, 200_mm, -3.1_m}, Vector3{100_mm, -50_mm, 0}}) {
+    BOOST_TEST_CONTEXT("position=" << position.transpose()) {
+      ActsMatrix<3, 3> derivative;
+      Vector3 field =
+          bField.getFieldGradient(position, derivative, cache).value();
+      CHECK_CLOSE_ABS(field, bField.getField(position), 1e-12_T);
+      for (size_t j = 0; j < 3; j++) {
+        Vector3 step = Vector3::Zero();
+        step[j] = h;
+        Vector3 numerical = (bField.getField(Vector3(position + step)) -
+                             bField.getField(Vector3(position - step))) /
+                            (2 * h);
+        CHECK_CLOSE_ABS(derivative.col(j), numerical, 1e-6_T / 1_mm);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldTable) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField exact(cfg);
+
+  cfg.useTable = true;
+  cfg.tableTolerance = 1e-3;
+  SolenoidBField table(cfg);
+  BOOST_CHECK_GT(table.tableErrorEstimate(), 0.);
+  BOOST_CHECK_LE(table.tableErrorEstimate(),
+                 cfg.tableTolerance * cfg.bMagCenter);
+  BOOST_CHECK_EQUAL(exact.tableErrorEstimate(), 0.);
+
+  // the error is only sampled on a few lines when the table is built, allow
+  // for a margin in between
+  const double tolerance = 2 * table.tableErrorEstimate();
+
+  auto cache = table.makeCache(mfContext);
+  auto exactCache = exact.makeCache(mfContext);
+  size_t steps = 20;
+  for (size_t i = 0; i <= steps; i++) {
+    // the table covers 0.9 * radius by default
+    double r = 0.9 * cfg.radius / steps * i;
+    for (size_t j = 0; j <= 2 * steps; j++) {
+      double z = cfg.length / steps * j - cfg.length;
+      BOOST_TEST_CONTEXT("r=" << r << ", z=" << z) {
+        Vector3 position(0.6 * r, -0.8 * r, z);
+        CHECK_CLOSE_ABS(table.getField(position, cache).value(),
+                        exact.getField(position), tolerance);
+
+        ActsMatrix<3, 3> derivative;
+        ActsMatrix<3, 3> exactDerivative;
+        table.getFieldGradient(position, derivative, cache);
+        exact.getFieldGradient(position, exactDerivative, exactCache);
+        CHECK_CLOSE_ABS(derivative, exactDerivative, 3e-4_T / 1_mm);
+      }
+    }
+  }
+
+  // outside of the table the field is evaluated exactly
+  Vector3 outside(1.2 * cfg.radius, 0, 0);
+  CHECK_CLOSE_ABS(table.getField(outside, cache).value(),
+                  exact.getField(outside), 1e-12_T);
+}
+
 }  // namespace Test
 }  // namespace Acts
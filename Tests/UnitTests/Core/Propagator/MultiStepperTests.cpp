@@ -276,6 +276,81 @@ BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen) {
   test_multi_stepper_vs_eigen_stepper<MultiStepperLoop>();
 }
 
+////////////////////////////////////////////////////////////////////////
+// Compare distinct components against individual Eigen-Stepper states
+////////////////////////////////////////////////////////////////////////
+template <typename multi_stepper_t>
+void test_multi_stepper_vs_eigen_stepper_distinct_components() {
+  using MultiState = typename multi_stepper_t::State;
+  using MultiStepper = multi_stepper_t;
+
+  // More components than are stepped together, one of them on the surface
+  const std::size_t n = 11;
+  const std::size_t onSurface = 3;
+
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Vector3::Zero(), Vector3::Ones().normalized());
+
+  std::vector<std::tuple<double, BoundVector, std::optional<BoundSymMatrix>>>
+      cmps;
+  std::vector<SingleStepper::State> single_states;
+  for (std::size_t i = 0; i < n; ++i) {
+    BoundVector pars = BoundVector::Ones();
+    pars[eBoundPhi] = -3. + 0.5 * i;
+    pars[eBoundTheta] = 0.3 + 0.2 * i;
+    pars[eBoundQOverP] = (i % 2 ? 1. : -1.) / (1. + i);
+    const BoundSymMatrix cov = BoundSymMatrix::Identity() * (1. + i);
+
+    cmps.push_back({1. / n, pars, cov});
+    single_states.emplace_back(
+        geoCtx, defaultBField->makeCache(magCtx),
+        SingleBoundTrackParameters<SinglyCharged>(surface, pars, cov),
+        defaultNDir, defaultStepSize, defaultTolerance);
+  }
+
+  MultiComponentBoundTrackParameters<SinglyCharged> multi_pars(surface, cmps);
+  MultiState multi_state(geoCtx, magCtx, defaultBField, multi_pars, defaultNDir,
+                         defaultStepSize, defaultTolerance);
+
+  MultiStepper multi_stepper(defaultBField);
+  SingleStepper single_stepper(defaultBField);
+
+  std::size_t i = 0;
+  for (auto cmp : multi_stepper.componentIterable(multi_state)) {
+    cmp.status() = i++ == onSurface ? Acts::Intersection3D::Status::onSurface
+                                    : Acts::Intersection3D::Status::reachable;
+  }
+
+  for (int step = 0; step < 10; ++step) {
+    auto multi_prop_state = DummyPropState(multi_state);
+    auto multi_result = multi_stepper.step(multi_prop_state, mockNavigator);
+    BOOST_REQUIRE(multi_result.ok());
+    BOOST_REQUIRE_EQUAL(multi_stepper.numberComponents(multi_state), n);
+
+    i = 0;
+    for (const auto cmp : multi_stepper.constComponentIterable(multi_state)) {
+      auto &single_state = single_states[i];
+      if (i++ != onSurface) {
+        auto single_prop_state = DummyPropState(single_state);
+        auto single_result =
+            single_stepper.step(single_prop_state, mockNavigator);
+        BOOST_REQUIRE(single_result.ok());
+      }
+
+      BOOST_CHECK_EQUAL(cmp.pars(), single_state.pars);
+      BOOST_CHECK_EQUAL(cmp.jacTransport(), single_state.jacTransport);
+      BOOST_CHECK_EQUAL(cmp.derivative(), single_state.derivative);
+      BOOST_CHECK_EQUAL(cmp.pathAccumulated(), single_state.pathAccumulated);
+      BOOST_CHECK_EQUAL(cmp.cmp.state.stepSize.value(),
+                        single_state.stepSize.value());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen_distinct_components) {
+  test_multi_stepper_vs_eigen_stepper_distinct_components<MultiStepperLoop>();
+}
+
 /////////////////////////////
 // Test stepsize accessors
 /////////////////////////////
@@ -0,0 +1,172 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackEigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackPropagator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+auto bField = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
+
+std::vector<BoundTrackParameters> makeTracks(std::size_t n) {
+  // fixed seed for reproducible tests
+  std::default_random_engine rng(4242);
+  std::uniform_real_distribution<> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<> theta(0.3, M_PI - 0.3);
+  std::uniform_real_distribution<> p(0.5_GeV, 10_GeV);
+
+  BoundSymMatrix cov = BoundSymMatrix::Identity() * 1e-4;
+  std::vector<BoundTrackParameters> tracks;
+  for (std::size_t i = 0; i < n; ++i) {
+    Vector3 dir = makeDirectionUnitFromPhiTheta(phi(rng), theta(rng));
+    // start at the first pixel layer, moving away from the beam line
+    Vector4 pos4(0, 0, 0, 0);
+    pos4.segment<3>(ePos0) = 50_mm * dir + Vector3(0.1_mm, -0.2_mm, 1_mm);
+    tracks.push_back(
+        CurvilinearTrackParameters(pos4, dir, p(rng), i % 2 ? 1 : -1, cov));
+  }
+  return tracks;
+}
+
+template <std::size_t kLanes>
+void checkAgainstPropagator(std::size_t nTracks) {
+  const auto tracks = makeTracks(nTracks);
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.direction = Direction::Backward;
+
+  Propagator<EigenStepper<>> propagator{EigenStepper<>(bField)};
+  MultiTrackPropagator<kLanes> multiPropagator{
+      MultiTrackEigenStepper<kLanes>(bField)};
+
+  auto results =
+      multiPropagator.propagate(tgContext, mfContext, tracks, *perigee,
+                                options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    auto expected = propagator.propagate(tracks[i], *perigee, options);
+    BOOST_REQUIRE(expected.ok());
+    BOOST_REQUIRE(results[i].ok());
+    const auto& expectedParams = *expected->endParameters;
+    const auto& params = *results[i];
+
+    BOOST_CHECK_EQUAL(&params.referenceSurface(), perigee.get());
+    CHECK_CLOSE_ABS(params.parameters(), expectedParams.parameters(), 1e-6);
+    CHECK_CLOSE_COVARIANCE(*params.covariance(), *expectedParams.covariance(),
+                           1e-6);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MultiTrackPropagatorTests)
+
+BOOST_AUTO_TEST_CASE(FourLanes) {
+  // not a multiple of the number of lanes
+  checkAgainstPropagator<4>(11);
+}
+
+BOOST_AUTO_TEST_CASE(EightLanes) {
+  checkAgainstPropagator<8>(21);
+}
+
+BOOST_AUTO_TEST_CASE(UnusedLanes) {
+  MultiTrackEigenStepper<4> stepper(bField);
+  auto state = stepper.makeState(tgContext, mfContext);
+  stepper.loadLane(state, 1, makeTracks(1).front(), Direction::Forward, 1_m);
+
+  MultiTrackEigenStepper<4>::Errors errors;
+  stepper.step(state, 139.57_MeV, 1e-4, 1e-4, 1_m, 10000, errors);
+  BOOST_CHECK(state.active[1]);
+  BOOST_CHECK_GT(state.pathAccumulated[1], 0.);
+
+  // lanes without a track neither move nor pick up an invalid time
+  for (std::size_t l : {0u, 2u, 3u}) {
+    BOOST_CHECK(not state.active[l]);
+    BOOST_CHECK(not errors[l]);
+    BOOST_CHECK_EQUAL(state.pathAccumulated[l], 0.);
+    BOOST_CHECK_EQUAL(stepper.position(state, l), Vector3::Zero());
+    BOOST_CHECK_EQUAL(state.pars[eFreeTime][l], 0.);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NeutralTimeDerivative) {
+  MultiTrackEigenStepper<4> stepper(bField);
+  auto state = stepper.makeState(tgContext, mfContext);
+  const auto tracks = makeTracks(2);
+  stepper.loadLane(state, 0, tracks[0], Direction::Forward, 1_m);
+  stepper.loadLane(state, 1, tracks[1], Direction::Forward, 1_m);
+  // without a charge q/p is 1/p like in the EigenStepper
+  state.absCharge[1] = 0.;
+
+  const double mass = 139.57_MeV;
+  MultiTrackEigenStepper<4>::Errors errors;
+  stepper.step(state, mass, 1e-4, 1e-4, 1_m, 10000, errors);
+
+  for (std::size_t l : {0u, 1u}) {
+    BOOST_TEST_CONTEXT("lane " << l) {
+      BOOST_CHECK(not errors[l]);
+      const double p = 1. / std::abs(state.pars[eFreeQOverP][l]);
+      const double dtds = std::hypot(1., mass / p);
+      CHECK_CLOSE_REL(state.derivative[l][3], dtds, 1e-12);
+      CHECK_CLOSE_REL(state.pars[eFreeTime][l],
+                      tracks[l].time() + state.pathAccumulated[l] * dtds,
+                      1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(UnreachableTarget) {
+  auto tracks = makeTracks(5);
+  // plane along the beam axis far away, which the helices do not reach
+  auto plane = Surface::makeShared<PlaneSurface>(Vector3(0, 0, 100_m),
+                                                 Vector3(0, 0, 1));
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.direction = Direction::Backward;
+  options.maxSteps = 100;
+
+  MultiTrackPropagator<4> multiPropagator{MultiTrackEigenStepper<4>(bField)};
+  auto results =
+      multiPropagator.propagate(tgContext, mfContext, tracks, *plane, options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+  for (const auto& result : results) {
+    BOOST_CHECK(not result.ok());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
 #include "Acts/Seeding/SeedFinder.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/SpacePointGridSoA.hpp"
 #include "Acts/Utilities/Range1D.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
@@ -169,11 +170,11 @@ int main(int argc, char** argv) {
   auto topBinFinder = std::make_shared<Acts::BinFinder<SpacePoint>>(
       Acts::BinFinder<SpacePoint>(zBinNeighborsTop, numPhiNeighbors));
   Acts::SeedFilterConfig sfconf;
+  sfconf = sfconf.toInternalUnits();
   Acts::ATLASCuts<SpacePoint> atlasCuts = Acts::ATLASCuts<SpacePoint>();
   config.seedFilter = std::make_unique<Acts::SeedFilter<SpacePoint>>(
       Acts::SeedFilter<SpacePoint>(sfconf, &atlasCuts));
   Acts::SeedFinder<SpacePoint> a;  // test creation of unconfigured finder
-  a = Acts::SeedFinder<SpacePoint>(config);
 
   // covariance tool, sets covariances per spacepoint as required
   auto ct = [=](const SpacePoint& sp, float, float,
@@ -194,6 +195,11 @@ int main(int argc, char** argv) {
   // setup spacepoint grid options
   Acts::SpacePointGridOptions gridOpts;
   gridOpts.bFieldInZ = options.bFieldInZ;
+  gridConf = gridConf.toInternalUnits();
+  gridOpts = gridOpts.toInternalUnits();
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  options = options.toInternalUnits().calculateDerivedQuantities(config);
+  a = Acts::SeedFinder<SpacePoint>(config);
   // create grid with bin sizes according to the configured geometry
   std::unique_ptr<Acts::SpacePointGrid<SpacePoint>> grid =
       Acts::SpacePointGridCreator::createGrid<SpacePoint>(gridConf, gridOpts);
@@ -203,6 +209,7 @@ int main(int argc, char** argv) {
 
   std::vector<std::vector<Acts::Seed<SpacePoint>>> seedVector;
   decltype(a)::SeedingState state;
+  state.spacePointData.resize(spVec.size());
   auto start = std::chrono::system_clock::now();
   for (auto [bottom, middle, top] : spGroup) {
     auto& v = seedVector.emplace_back();
@@ -218,6 +225,51 @@ int main(int argc, char** argv) {
     numSeeds += outVec.size();
   }
   std::cout << "Number of seeds generated: " << numSeeds << std::endl;
+
+  auto sameSeeds =
+      [&seedVector](
+          const std::vector<std::vector<Acts::Seed<SpacePoint>>>& other) {
+        if (seedVector.size() != other.size()) {
+          return false;
+        }
+        for (size_t r = 0; r < seedVector.size(); r++) {
+          if (seedVector[r].size() != other[r].size()) {
+            return false;
+          }
+          for (size_t i = 0; i < seedVector[r].size(); i++) {
+            if (seedVector[r][i].sp() != other[r][i].sp() or
+                seedVector[r][i].z() != other[r][i].z() or
+                seedVector[r][i].seedQuality() != other[r][i].seedQuality()) {
+              return false;
+            }
+          }
+        }
+        return true;
+      };
+
+  // the batched doublet search on the structure-of-arrays copy of the grid
+  // has to produce exactly the same seeds, starting from a fresh state
+  std::vector<std::vector<Acts::Seed<SpacePoint>>> seedVectorSoA;
+  decltype(a)::SeedingState stateSoA;
+  stateSoA.spacePointData.resize(spVec.size());
+  auto start_soa = std::chrono::system_clock::now();
+  Acts::SpacePointGridSoA<SpacePoint> gridSoA(spGroup.grid());
+  for (auto [bottom, middle, top] : spGroup) {
+    auto& v = seedVectorSoA.emplace_back();
+    a.createSeedsForGroup(options, stateSoA, spGroup.grid(), gridSoA,
+                          std::back_inserter(v), bottom, middle, top,
+                          rMiddleSPRange);
+  }
+  auto end_soa = std::chrono::system_clock::now();
+  std::chrono::duration<double> elapsed_soa = end_soa - start_soa;
+  std::cout << "time to create seeds with SoA grid: " << elapsed_soa.count()
+            << std::endl;
+  if (not sameSeeds(seedVectorSoA)) {
+    std::cerr << "seeds differ between the SoA and the default doublet search"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
   if (!quiet) {
     for (auto& regionVec : seedVector) {
       for (size_t i = 0; i < regionVec.size(); i++) {
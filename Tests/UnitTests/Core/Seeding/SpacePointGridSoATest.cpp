@@ -0,0 +1,171 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/SpacePointGridSoA.hpp"
+#include "Acts/Tests/CommonHelpers/DataDirectory.hpp"
+#include "Acts/Utilities/Range1D.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts::UnitLiterals;
+
+// Reads a seeding fixture, see Tests/Data/README.md for the format
+std::vector<SpacePoint> readFixture(const std::string& name) {
+  std::ifstream file(Acts::Test::getDataPath(name), std::ios::binary);
+  char magic[4] = {};
+  std::uint32_t nSpacePoints = 0;
+  float varianceR = 0;
+  float varianceZ = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&nSpacePoints), sizeof(nSpacePoints));
+  file.read(reinterpret_cast<char*>(&varianceR), sizeof(varianceR));
+  file.read(reinterpret_cast<char*>(&varianceZ), sizeof(varianceZ));
+  BOOST_REQUIRE(file);
+  BOOST_REQUIRE_EQUAL(std::string(magic, sizeof(magic)), "ACSP");
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nSpacePoints);
+  for (std::uint32_t i = 0; i < nSpacePoints; ++i) {
+    float xyz[3] = {};
+    file.read(reinterpret_cast<char*>(xyz), sizeof(xyz));
+    spacePoints.push_back({xyz[0], xyz[1], xyz[2], std::hypot(xyz[0], xyz[1]),
+                           0, varianceR, varianceZ});
+  }
+  BOOST_REQUIRE(file);
+  return spacePoints;
+}
+
+}  // namespace
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_AUTO_TEST_CASE(space_point_grid_soa_same_seeds) {
+  const std::vector<SpacePoint> spacePoints =
+      readFixture("seeding_synthetic_barrel_440_spacepoints.bin");
+  std::vector<const SpacePoint*> spVec;
+  for (const SpacePoint& sp : spacePoints) {
+    spVec.push_back(&sp);
+  }
+
+  SeedFilterConfig sfconf;
+  sfconf = sfconf.toInternalUnits();
+
+  SeedFinderConfig<SpacePoint> config;
+  config.seedFilter = std::make_unique<SeedFilter<SpacePoint>>(sfconf);
+  config.rMax = 160._mm;
+  config.deltaRMin = 5._mm;
+  config.deltaRMax = 160._mm;
+  config.deltaRMinTopSP = config.deltaRMin;
+  config.deltaRMinBottomSP = config.deltaRMin;
+  config.deltaRMaxTopSP = config.deltaRMax;
+  config.deltaRMaxBottomSP = config.deltaRMax;
+  config.collisionRegionMin = -250._mm;
+  config.collisionRegionMax = 250._mm;
+  config.zMin = -2800._mm;
+  config.zMax = 2800._mm;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.00000;
+  config.minPt = 500._MeV;
+  config.impactMax = 10._mm;
+  config.useVariableMiddleSPRange = false;
+
+  SeedFinderOptions options;
+  options.beamPos = {-.5_mm, -.5_mm};
+  options.bFieldInZ = 1.99724_T;
+
+  SpacePointGridConfig gridConf;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+  SpacePointGridOptions gridOpts;
+  gridOpts.bFieldInZ = options.bFieldInZ;
+  gridConf = gridConf.toInternalUnits();
+  gridOpts = gridOpts.toInternalUnits();
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  options = options.toInternalUnits().calculateDerivedQuantities(config);
+
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR, sp.varianceZ)};
+  };
+  std::vector<std::pair<int, int>> zBinNeighbors;
+  auto binFinder = std::make_shared<BinFinder<SpacePoint>>(zBinNeighbors, 1);
+  Extent rRangeSPExtent;
+  const Range1D<float> rMiddleSPRange;
+
+  auto spGroup = BinnedSPGroup<SpacePoint>(
+      spVec.begin(), spVec.end(), ct, binFinder, binFinder,
+      SpacePointGridCreator::createGrid<SpacePoint>(gridConf, gridOpts),
+      rRangeSPExtent, config, options);
+  SpacePointGridSoA<SpacePoint> gridSoA(spGroup.grid());
+
+  SeedFinder<SpacePoint> finder(config);
+  SeedFinder<SpacePoint>::SeedingState state;
+  SeedFinder<SpacePoint>::SeedingState stateSoA;
+  state.spacePointData.resize(spVec.size());
+  stateSoA.spacePointData.resize(spVec.size());
+
+  std::size_t nSeeds = 0;
+  for (auto [bottom, middle, top] : spGroup) {
+    std::vector<Seed<SpacePoint>> seeds;
+    std::vector<Seed<SpacePoint>> seedsSoA;
+    finder.createSeedsForGroup(options, state, spGroup.grid(),
+                               std::back_inserter(seeds), bottom, middle, top,
+                               rMiddleSPRange);
+    finder.createSeedsForGroup(options, stateSoA, spGroup.grid(), gridSoA,
+                               std::back_inserter(seedsSoA), bottom, middle,
+                               top, rMiddleSPRange);
+
+    BOOST_REQUIRE_EQUAL(seeds.size(), seedsSoA.size());
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+      BOOST_CHECK(seeds[i].sp() == seedsSoA[i].sp());
+      BOOST_CHECK_EQUAL(seeds[i].z(), seedsSoA[i].z());
+      BOOST_CHECK_EQUAL(seeds[i].seedQuality(), seedsSoA[i].seedQuality());
+    }
+    nSeeds += seeds.size();
+  }
+  // the comparison is only meaningful if the fixture produces seeds
+  BOOST_CHECK_GT(nSeeds, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -25,12 +25,14 @@
 #include "Acts/Utilities/detail/Grid.hpp"
 #include "Acts/Utilities/detail/grid_helper.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -247,6 +249,60 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SurfaceArray_flatLookup, SurfaceArrayFixture) {
+  GeometryContext tgContext = GeometryContext();
+
+  SrfVec brl = makeBarrel(30, 7, 2, 1);
+  std::vector<const Surface*> brlRaw = unpack_shared_vector(brl);
+
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Closed>
+      phiAxis(-M_PI, M_PI, 30u);
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Bound>
+      zAxis(-14, 14, 7u);
+  using SGL =
+      SurfaceArray::SurfaceGridLookup<decltype(phiAxis), decltype(zAxis)>;
+
+  double R = 10;
+  auto makeArray = [&](double angleShift, std::vector<BinningValue> bValues) {
+    auto transform = [angleShift](const Vector3& pos) {
+      return Vector2(phi(pos) + angleShift, pos.z());
+    };
+    auto itransform = [angleShift, R](const Vector2& loc) {
+      return Vector3(R * std::cos(loc[0] - angleShift),
+                     R * std::sin(loc[0] - angleShift), loc[1]);
+    };
+    auto sl = std::make_unique<SGL>(transform, itransform,
+                                    std::make_tuple(phiAxis, zAxis),
+                                    std::move(bValues));
+    sl->fill(tgContext, brlRaw);
+    return SurfaceArray(std::move(sl), brl);
+  };
+
+  // (phi, z) binning is looked up in cylinder coordinates
+  SurfaceArray sa = makeArray(0., {binPhi, binZ});
+  sa.buildFlatLookup();
+  BOOST_REQUIRE(sa.hasFlatLookup());
+  for (const auto& srf : brl) {
+    Vector3 ctr = srf->binningPosition(tgContext, binR);
+    SurfaceArray::SurfaceRange range = sa.neighborRange(ctr);
+    std::vector<const Surface*> neighbors = sa.neighbors(ctr);
+    BOOST_CHECK_EQUAL(range.size(), neighbors.size());
+    for (const Surface* neighbor : range) {
+      BOOST_CHECK(std::find(neighbors.begin(), neighbors.end(), neighbor) !=
+                  neighbors.end());
+    }
+  }
+
+  // a grid lookup with other local coordinates than the binning values
+  // suggest is rejected
+  SurfaceArray shifted = makeArray(2 * M_PI / 30. / 2., {binPhi, binZ});
+  BOOST_CHECK_THROW(shifted.buildFlatLookup(), std::invalid_argument);
+  BOOST_CHECK(not shifted.hasFlatLookup());
+  SurfaceArray unnamed = makeArray(0., {});
+  BOOST_CHECK_THROW(unnamed.buildFlatLookup(), std::invalid_argument);
+  BOOST_CHECK(not unnamed.hasFlatLookup());
+}
+
 BOOST_AUTO_TEST_CASE(SurfaceArray_singleElement) {
   double w = 3, h = 4;
   auto bounds = std::make_shared<const RectangleBounds>(w, h);
@@ -353,6 +353,51 @@ BOOST_AUTO_TEST_CASE(ZeroFieldForward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ZeroFieldForwardCompaction) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  auto pSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3{-3_m, 0., 0.}, Acts::Vector3{1., 0., 0});
+  options.referenceSurface = &(*pSurface);
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+  options.sourcelinkAccessor.connect<&Fixture::TestSourceLinkAccessor::range>(
+      &slAccessor);
+
+  Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                          Acts::VectorMultiTrajectory{}};
+  Acts::TrackContainer tcCompact{Acts::VectorTrackContainer{},
+                                 Acts::VectorMultiTrajectory{}};
+
+  for (size_t trackId = 0u; trackId < f.startParameters.size(); ++trackId) {
+    options.compactionThreshold = 1;
+    BOOST_REQUIRE(
+        f.ckf.findTracks(f.startParameters.at(trackId), options, tc).ok());
+    options.compactionThreshold = 0;
+    BOOST_REQUIRE(
+        f.ckf.findTracks(f.startParameters.at(trackId), options, tcCompact)
+            .ok());
+  }
+
+  BOOST_REQUIRE_EQUAL(tc.size(), tcCompact.size());
+  BOOST_CHECK_LE(tcCompact.trackStateContainer().size(),
+                 tc.trackStateContainer().size());
+
+  // only the states of the found tracks are left
+  size_t nStates = 0u;
+  for (size_t trackId = 0u; trackId < tc.size(); ++trackId) {
+    const auto track = tc.getTrack(trackId);
+    const auto trackCompact = tcCompact.getTrack(trackId);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), trackCompact.nTrackStates());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), trackCompact.nMeasurements());
+    BOOST_CHECK_EQUAL(track.chi2(), trackCompact.chi2());
+    nStates += trackCompact.nTrackStates();
+  }
+  BOOST_CHECK_EQUAL(tcCompact.trackStateContainer().size(), nStates);
+}
+
 BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   Fixture f(0_T);
 
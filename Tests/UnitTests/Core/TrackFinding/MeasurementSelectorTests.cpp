@@ -0,0 +1,181 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+
+using TrackStateProxy = VectorMultiTrajectory::TrackStateProxy;
+using Projector = ActsMatrix<MultiTrajectoryTraits::MeasurementSizeMax,
+                             eBoundSize>;
+
+// fixed seed for reproducible tests
+std::default_random_engine rng(4242);
+std::uniform_real_distribution<double> uniform(-1, 1);
+
+/// A random symmetric positive definite matrix
+template <int N>
+ActsSymMatrix<N> randomCovariance() {
+  ActsMatrix<N, N> a = ActsMatrix<N, N>::NullaryExpr(
+      [](auto, auto) { return uniform(rng); });
+  return a * a.transpose() + ActsSymMatrix<N>::Identity();
+}
+
+/// Projector on the given bound parameters
+Projector makeProjector(const std::vector<BoundIndices>& indices) {
+  Projector projector = Projector::Zero();
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    projector(i, indices[i]) = 1;
+  }
+  return projector;
+}
+
+/// Fill a random measurement of the given projector into the track state
+void fillMeasurement(TrackStateProxy& ts,
+                     const std::vector<BoundIndices>& indices) {
+  constexpr auto kMax = MultiTrajectoryTraits::MeasurementSizeMax;
+  const auto size = indices.size();
+  // only the effective size is allocated
+  ts.allocateCalibrated(size);
+  const ActsSymMatrix<kMax> covariance = randomCovariance<kMax>();
+  for (std::size_t i = 0; i < size; ++i) {
+    ts.effectiveCalibrated()[i] = uniform(rng);
+    for (std::size_t j = 0; j < size; ++j) {
+      ts.effectiveCalibratedCovariance()(i, j) = covariance(i, j);
+    }
+  }
+  ts.setProjector(makeProjector(indices));
+}
+
+/// Chi2 of a track state computed from scratch
+double referenceChi2(const TrackStateProxy& ts) {
+  const auto size = ts.calibratedSize();
+  const ActsDynamicMatrix H = ts.effectiveProjector();
+  const ActsDynamicVector residual =
+      ts.effectiveCalibrated() - H * ts.predicted();
+  const ActsDynamicMatrix covariance =
+      ts.effectiveCalibratedCovariance() +
+      H * ts.predictedCovariance() * H.transpose();
+  BOOST_REQUIRE_EQUAL(residual.size(), size);
+  return residual.dot(covariance.inverse() * residual);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingMeasurementSelector)
+
+BOOST_AUTO_TEST_CASE(BatchedChi2MatchesScalarChi2) {
+  auto surface = Surface::makeShared<PlaneSurface>(Vector3::Zero(),
+                                                   Vector3::UnitZ());
+  surface->assignGeometryId(GeometryIdentifier().setVolume(1));
+
+  BoundVector predicted;
+  for (unsigned int i = 0; i < eBoundSize; ++i) {
+    predicted[i] = uniform(rng);
+  }
+  predicted[eBoundTheta] = 1.;
+  const BoundSymMatrix predictedCovariance = randomCovariance<eBoundSize>();
+
+  // one and two dimensional measurements with the same projector are batched,
+  // all others use the scalar fallback
+  const std::vector<std::vector<BoundIndices>> measurementIndices = {
+      {eBoundLoc0},
+      {eBoundLoc0},
+      {eBoundLoc0},
+      {eBoundLoc1},
+      {eBoundLoc0, eBoundLoc1},
+      {eBoundLoc0, eBoundLoc1},
+      {eBoundLoc0, eBoundPhi},
+      {eBoundLoc0, eBoundLoc1, eBoundTime},
+      {eBoundLoc0, eBoundLoc1, eBoundPhi, eBoundTheta},
+      {eBoundLoc0, eBoundLoc1, eBoundPhi, eBoundTheta, eBoundQOverP},
+      {eBoundLoc0, eBoundLoc1, eBoundPhi, eBoundTheta, eBoundQOverP,
+       eBoundTime},
+  };
+
+  // the candidates share the predicted parameters like in the CKF, the twins
+  // hold a copy of the same measurement but their own predicted parameters,
+  // which excludes them from the batches
+  VectorMultiTrajectory traj;
+  std::vector<TrackStateProxy> candidates;
+  std::vector<TrackStateProxy> twins;
+  for (const auto& indices : measurementIndices) {
+    auto ts = traj.getTrackState(traj.addTrackState(
+        TrackStatePropMask::Predicted | TrackStatePropMask::Calibrated));
+    if (candidates.empty()) {
+      ts.predicted() = predicted;
+      ts.predictedCovariance() = predictedCovariance;
+    } else {
+      ts.shareFrom(candidates.front(), TrackStatePropMask::Predicted);
+    }
+    ts.setReferenceSurface(surface);
+    fillMeasurement(ts, indices);
+    candidates.push_back(ts);
+
+    auto twin = traj.getTrackState(traj.addTrackState(
+        TrackStatePropMask::Predicted | TrackStatePropMask::Calibrated));
+    twin.predicted() = predicted;
+    twin.predictedCovariance() = predictedCovariance;
+    twin.setReferenceSurface(surface);
+    twin.copyFrom(ts, TrackStatePropMask::Calibrated);
+    twins.push_back(twin);
+  }
+
+  MeasurementSelectorCuts cuts;
+  cuts.chi2CutOff = {std::numeric_limits<double>::max()};
+  cuts.numMeasurementsCutOff = {candidates.size()};
+  MeasurementSelector selector(
+      MeasurementSelector::Config{{GeometryIdentifier(), cuts}});
+  auto logger = getDefaultLogger("MeasurementSelector", Logging::INFO);
+
+  bool isOutlier = true;
+  auto candidatesResult =
+      selector.select<VectorMultiTrajectory>(candidates, isOutlier, *logger);
+  BOOST_REQUIRE(candidatesResult.ok());
+  BOOST_CHECK(not isOutlier);
+  // each twin is evaluated on its own
+  for (auto& twin : twins) {
+    std::vector<TrackStateProxy> single = {twin};
+    BOOST_REQUIRE(
+        selector.select<VectorMultiTrajectory>(single, isOutlier, *logger)
+            .ok());
+  }
+
+  for (std::size_t i = 0; i < measurementIndices.size(); ++i) {
+    BOOST_TEST_CONTEXT("measurement " << i << " of size "
+                                      << measurementIndices[i].size()) {
+      // the candidates were sorted by the selection, but the track states
+      // keep their chi2
+      const auto candidate = traj.getTrackState(2 * i);
+      const auto twin = traj.getTrackState(2 * i + 1);
+      CHECK_CLOSE_REL(candidate.chi2(), twin.chi2(), 1e-12);
+      CHECK_CLOSE_REL(candidate.chi2(), referenceChi2(candidate), 1e-9);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+
+namespace {
+
+const auto approx = makeDefaultBetheHeitlerApprox();
+
+std::string cachePath() {
+  return (std::filesystem::temp_directory_path() / "acts_bethe_heitler.bin")
+      .string();
+}
+
+template <typename tabulated_t>
+void checkAgainstPolynomials(const tabulated_t &tabulated, double x) {
+  const auto expected = approx.mixture(x);
+  const auto cmps = tabulated.mixture(x);
+  BOOST_REQUIRE_EQUAL(cmps.size(), expected.size());
+
+  double weightSum = 0;
+  for (std::size_t i = 0; i < cmps.size(); ++i) {
+    BOOST_CHECK_SMALL(cmps[i].weight - expected[i].weight, 1e-7);
+    BOOST_CHECK_SMALL(cmps[i].mean - expected[i].mean, 1e-7);
+    // The variances vary most, relative to their size
+    BOOST_CHECK_SMALL(cmps[i].var - expected[i].var, 1e-4 * expected[i].var);
+    weightSum += cmps[i].weight;
+  }
+  BOOST_CHECK_CLOSE(weightSum, 1., 1e-10);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(BetheHeitlerApproxTests)
+
+BOOST_AUTO_TEST_CASE(tabulated_vs_polynomials) {
+  const TabulatedBetheHeitlerApprox<6> tabulated(approx);
+
+  BOOST_CHECK_EQUAL(tabulated.numComponents(), approx.numComponents());
+  BOOST_CHECK_EQUAL(tabulated.nodes(),
+                    TabulatedBetheHeitlerApprox<6>::defaultNodes);
+
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<> x(0., 0.25);
+  for (int i = 0; i < 10000; ++i) {
+    const double xx = x(rng);
+    BOOST_CHECK_EQUAL(tabulated.validXOverX0(xx), approx.validXOverX0(xx));
+    checkAgainstPolynomials(tabulated, xx);
+  }
+
+  // the ranges and their limits
+  for (double xx : {0., 0.00005, 0.001, 0.002, 0.05, 0.0999999, 0.1, 0.15,
+                    0.2, 0.3}) {
+    checkAgainstPolynomials(tabulated, xx);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(tabulated_cache_file) {
+  const auto path = cachePath();
+  std::remove(path.c_str());
+
+  // Creates the cache file
+  const auto created =
+      TabulatedBetheHeitlerApprox<6>::loadOrCreate(approx, path, 200);
+  BOOST_CHECK_EQUAL(created.nodes(), 200);
+  BOOST_REQUIRE(std::filesystem::exists(path));
+
+  const auto loaded =
+      TabulatedBetheHeitlerApprox<6>::loadFromFile(path, approx);
+  BOOST_CHECK_EQUAL(loaded.nodes(), 200);
+  for (double x = 0.; x < 0.25; x += 0.0007) {
+    const auto a = created.mixture(x);
+    const auto b = loaded.mixture(x);
+    BOOST_REQUIRE_EQUAL(a.size(), b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      BOOST_CHECK_EQUAL(a[i].weight, b[i].weight);
+      BOOST_CHECK_EQUAL(a[i].mean, b[i].mean);
+      BOOST_CHECK_EQUAL(a[i].var, b[i].var);
+    }
+  }
+
+  // A different number of nodes rebuilds the table and the cache file
+  const auto rebuilt =
+      TabulatedBetheHeitlerApprox<6>::loadOrCreate(approx, path, 300);
+  BOOST_CHECK_EQUAL(rebuilt.nodes(), 300);
+  BOOST_CHECK_EQUAL(
+      TabulatedBetheHeitlerApprox<6>::loadFromFile(path, approx).nodes(), 300);
+
+  // A cache file of another parameterization is rejected
+  const AtlasBetheHeitlerApprox<6, 5> other({}, {}, true, true);
+  BOOST_CHECK_THROW(TabulatedBetheHeitlerApprox<6>::loadFromFile(path, other),
+                    std::invalid_argument);
+
+  // A truncated cache file is rejected
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+  BOOST_CHECK_THROW(TabulatedBetheHeitlerApprox<6>::loadFromFile(path, approx),
+                    std::invalid_argument);
+
+  // A corrupted number of nodes is rejected before allocating the table
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    const std::uint64_t nodes = std::numeric_limits<std::uint64_t>::max() / 4;
+    file.seekp(8 + 2 * sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char *>(&nodes), sizeof(nodes));
+  }
+  BOOST_CHECK_THROW(TabulatedBetheHeitlerApprox<6>::loadFromFile(path, approx),
+                    std::invalid_argument);
+
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW(TabulatedBetheHeitlerApprox<6>::loadFromFile(path, approx),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
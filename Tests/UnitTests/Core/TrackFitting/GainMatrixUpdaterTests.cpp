@@ -22,7 +22,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <random>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -90,4 +92,70 @@ BOOST_AUTO_TEST_CASE(Update) {
   CHECK_CLOSE_ABS(ts.chi2(), 1.33958, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(BatchUpdate) {
+  std::default_random_engine rng(1234);
+  std::normal_distribution<double> normal(0., 1.);
+
+  // same states in two trajectories, one updated state by state, one batched
+  VectorMultiTrajectory scalarTraj;
+  VectorMultiTrajectory batchTraj;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> batch;
+
+  for (unsigned int i = 0; i < 11; ++i) {
+    ParametersVector trkPar;
+    Jacobian A;
+    for (unsigned int r = 0; r < eBoundSize; ++r) {
+      trkPar[r] = normal(rng);
+      for (unsigned int c = 0; c < eBoundSize; ++c) {
+        A(r, c) = normal(rng);
+      }
+    }
+    CovarianceMatrix trkCov =
+        A * A.transpose() + CovarianceMatrix::Identity();
+
+    // mix measurement dimensions and projectors
+    TestSourceLink sourceLink;
+    if (i % 3 == 0) {
+      sourceLink = TestSourceLink(eBoundLoc1, normal(rng), 0.04);
+    } else {
+      Vector2 measPar(normal(rng), normal(rng));
+      SymMatrix2 measCov = Vector2(0.04, 0.1).asDiagonal();
+      measCov(0, 1) = measCov(1, 0) = 0.01;
+      sourceLink = (i % 3 == 1) ? TestSourceLink(eBoundLoc0, eBoundLoc1,
+                                                 measPar, measCov)
+                                : TestSourceLink(eBoundPhi, eBoundQOverP,
+                                                 measPar, measCov);
+    }
+
+    for (auto* traj : {&scalarTraj, &batchTraj}) {
+      auto ts = traj->getTrackState(
+          traj->addTrackState(TrackStatePropMask::All));
+      ts.predicted() = trkPar;
+      ts.predictedCovariance() = trkCov;
+      ts.setUncalibratedSourceLink(SourceLink{sourceLink});
+      testSourceLinkCalibrator<VectorMultiTrajectory>(tgContext, ts);
+    }
+    BOOST_CHECK(GainMatrixUpdater()
+                    .
+                    operator()<VectorMultiTrajectory>(
+                        tgContext, scalarTraj.getTrackState(i))
+                    .ok());
+    batch.push_back(batchTraj.getTrackState(i));
+  }
+
+  auto errors = GainMatrixUpdater().updateBatch<VectorMultiTrajectory>(
+      tgContext, batch);
+  BOOST_REQUIRE_EQUAL(errors.size(), batch.size());
+
+  for (unsigned int i = 0; i < batch.size(); ++i) {
+    BOOST_CHECK(not errors[i]);
+    auto expected = scalarTraj.getTrackState(i);
+    auto ts = batchTraj.getTrackState(i);
+    CHECK_CLOSE_ABS(ts.filtered(), expected.filtered(), 1e-10);
+    CHECK_CLOSE_ABS(ts.filteredCovariance(), expected.filteredCovariance(),
+                    1e-10);
+    CHECK_CLOSE_ABS(ts.chi2(), expected.chi2(), 1e-8);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -173,3 +174,45 @@ BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   BOOST_CHECK_CLOSE(cmps[0].boundPars[eBoundQOverP], 2.5_GeV, 1.e-8);
   BOOST_CHECK_CLOSE(cmps[0].weight, 1.0, 1.e-8);
 }
+
+BOOST_AUTO_TEST_CASE(test_packed_distance_matrix_reduction) {
+  const auto proj = [](auto &a) -> decltype(auto) { return a; };
+  const auto desc = std::tuple<>{};
+
+  // 16 components times 6 Bethe-Heitler components, as in the GSF
+  std::default_random_engine rng(1234);
+  std::uniform_real_distribution<> qop(-1. / 1_GeV, 1. / 1_GeV);
+  std::uniform_real_distribution<> var(1e-3, 1e-1);
+  std::uniform_real_distribution<> weight(0.1, 1.);
+
+  std::vector<DummyComponent> cmps(96);
+  for (auto &cmp : cmps) {
+    cmp.weight = weight(rng);
+    cmp.boundPars[eBoundQOverP] = qop(rng);
+    cmp.boundCov(eBoundQOverP, eBoundQOverP) = var(rng);
+  }
+  // Duplicates give equal distances, so the ties must be resolved the same way
+  cmps[40] = cmps[7];
+  cmps[41] = cmps[7];
+
+  detail::SymmetricKLDistanceMatrix full(cmps, proj);
+  detail::PackedKLDistanceMatrix packed(cmps, proj);
+  for (auto i = 1ul; i < cmps.size(); ++i) {
+    for (auto j = 0ul; j < i; ++j) {
+      BOOST_CHECK_EQUAL(full.at(i, j), packed.at(i, j));
+    }
+  }
+  BOOST_CHECK(full.minDistancePair() == packed.minDistancePair());
+
+  auto expected = cmps;
+  detail::reduceWithKLDistance<detail::SymmetricKLDistanceMatrix>(expected, 16,
+                                                                  proj, desc);
+  detail::reduceWithKLDistance(cmps, 16, proj, desc);
+
+  BOOST_REQUIRE_EQUAL(cmps.size(), 16);
+  for (auto i = 0ul; i < cmps.size(); ++i) {
+    BOOST_CHECK_EQUAL(cmps[i].weight, expected[i].weight);
+    BOOST_CHECK_EQUAL(cmps[i].boundPars, expected[i].boundPars);
+    BOOST_CHECK_EQUAL(cmps[i].boundCov, expected[i].boundCov);
+  }
+}
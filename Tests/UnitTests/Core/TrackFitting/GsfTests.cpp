@@ -26,6 +26,7 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/EventData/detail/TransformationFreeToBound.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/MultiEigenStepperLoop.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
@@ -250,4 +251,78 @@ BOOST_AUTO_TEST_CASE(WithFinalMultiComponentState) {
                   .has_value());
 }
 
+BOOST_AUTO_TEST_CASE(LockStepMatchesComponentLoop) {
+  // a weak field along the track, so that the components bend but still
+  // cross the detector
+  auto makeGsf = [](bool lockStep) {
+    Acts::Navigator::Config cfg{tester.geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    auto field = std::make_shared<Acts::ConstantBField>(
+        Acts::Vector3(0.5_T, 0., 0.05_T));
+    Stepper stepper(std::move(field), MixtureReductionMethod::eMean,
+                    getDefaultLogger("GSF", Logging::INFO), lockStep);
+    return GSF(Acts::Propagator<Stepper, Acts::Navigator>(
+                   std::move(stepper), Acts::Navigator(cfg)),
+               makeDefaultBetheHeitlerApprox());
+  };
+  const GSF gsfLockStep = makeGsf(true);
+  const GSF gsfComponentLoop = makeGsf(false);
+
+  auto multi_pars = makeParameters();
+  auto measurements =
+      createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                         multi_pars, tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+  auto options = makeDefaultGsfOptions();
+  auto targetSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3(-3._m, 0., 0.), Acts::Vector3(1., 0., 0.));
+  options.referenceSurface = targetSurface.get();
+
+  Acts::TrackContainer lockStepTracks{Acts::VectorTrackContainer{},
+                                      Acts::VectorMultiTrajectory{}};
+  Acts::TrackContainer componentLoopTracks{Acts::VectorTrackContainer{},
+                                           Acts::VectorMultiTrajectory{}};
+  auto lockStepRes = gsfLockStep.fit(sourceLinks.begin(), sourceLinks.end(),
+                                     multi_pars, options, lockStepTracks);
+  auto componentLoopRes =
+      gsfComponentLoop.fit(sourceLinks.begin(), sourceLinks.end(), multi_pars,
+                           options, componentLoopTracks);
+  BOOST_REQUIRE(lockStepRes.ok());
+  BOOST_REQUIRE(componentLoopRes.ok());
+
+  // the lock-step stepping reproduces the component loop exactly
+  const auto& lockStepTrack = *lockStepRes;
+  const auto& componentLoopTrack = *componentLoopRes;
+  BOOST_CHECK_EQUAL(lockStepTrack.parameters(),
+                    componentLoopTrack.parameters());
+  BOOST_CHECK_EQUAL(lockStepTrack.covariance(),
+                    componentLoopTrack.covariance());
+  BOOST_REQUIRE_EQUAL(lockStepTrack.nTrackStates(),
+                      componentLoopTrack.nTrackStates());
+  BOOST_CHECK_EQUAL(lockStepTrack.nMeasurements(),
+                    FitterTester::nMeasurements);
+  BOOST_CHECK_EQUAL(lockStepTrack.nMeasurements(),
+                    componentLoopTrack.nMeasurements());
+
+  std::vector<std::pair<BoundVector, BoundSymMatrix>> lockStepStates;
+  for (const auto ts : lockStepTrack.trackStates()) {
+    if (ts.hasFiltered()) {
+      lockStepStates.emplace_back(ts.filtered(), ts.filteredCovariance());
+    }
+  }
+  std::size_t i = 0;
+  for (const auto ts : componentLoopTrack.trackStates()) {
+    if (ts.hasFiltered()) {
+      BOOST_REQUIRE_LT(i, lockStepStates.size());
+      BOOST_CHECK_EQUAL(lockStepStates[i].first, ts.filtered());
+      BOOST_CHECK_EQUAL(lockStepStates[i].second, ts.filteredCovariance());
+      ++i;
+    }
+  }
+  BOOST_CHECK_EQUAL(i, lockStepStates.size());
+  BOOST_CHECK_GT(i, 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -22,7 +22,9 @@
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Tests/CommonHelpers/LineSurfaceStub.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/BatchedKalmanRefitter.hpp"
 #include "Acts/TrackFitting/GainMatrixSmoother.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -37,6 +39,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "FitterTestsCommon.hpp"
 
@@ -259,4 +262,140 @@ BOOST_AUTO_TEST_CASE(GlobalCovariance) {
   tester.test_GlobalCovariance(kfZero, kfOptions, start, rng);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedRefit) {
+  auto start = makeParameters();
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  std::vector<VectorMultiTrajectory::IndexType> trackIndices;
+  for (unsigned int i = 0; i < 5; ++i) {
+    auto measurements =
+        createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                           start, tester.resolutions, rng);
+    auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+    auto res = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                          kfOptions, tracks);
+    BOOST_REQUIRE(res.ok());
+    trackIndices.push_back(res->index());
+  }
+
+  // copy of the fit for comparison
+  auto& trajectory = tracks.trackStateContainer();
+  VectorMultiTrajectory expected = trajectory;
+  const double chi2 = tracks.getTrack(trackIndices[0]).chi2();
+
+  BatchedKalmanRefitter refitter{{}};
+
+  // refit with the same measurements reproduces the fit
+  auto errors = refitter.refit(tester.geoCtx, tracks, trackIndices);
+  for (const auto& error : errors) {
+    BOOST_CHECK(not error);
+  }
+  for (unsigned int i = 0; i < trajectory.size(); ++i) {
+    auto ts = trajectory.getTrackState(i);
+    auto ets = expected.getTrackState(i);
+    CHECK_CLOSE_OR_SMALL(ts.predicted(), ets.predicted(), 1e-6, 1e-9);
+    CHECK_CLOSE_OR_SMALL(ts.smoothed(), ets.smoothed(), 1e-6, 1e-9);
+    CHECK_CLOSE_COVARIANCE(ts.smoothedCovariance(), ets.smoothedCovariance(),
+                           1e-6);
+    if (ts.typeFlags().test(TrackStateFlag::MeasurementFlag)) {
+      CHECK_CLOSE_OR_SMALL(ts.filtered(), ets.filtered(), 1e-6, 1e-9);
+      CHECK_CLOSE_REL(ts.chi2(), ets.chi2(), 1e-6);
+    }
+  }
+  CHECK_CLOSE_REL(tracks.getTrack(trackIndices[0]).chi2(), chi2, 1e-6);
+
+  // larger measurement uncertainties give a smaller chi2
+  for (auto ts : tracks.getTrack(trackIndices[0]).trackStates()) {
+    if (ts.typeFlags().test(TrackStateFlag::MeasurementFlag)) {
+      ts.effectiveCalibratedCovariance() *= 4;
+    }
+  }
+  errors = refitter.refit(tester.geoCtx, tracks, trackIndices);
+  BOOST_CHECK(not errors[0]);
+  BOOST_CHECK_LT(tracks.getTrack(trackIndices[0]).chi2(), chi2);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedRefitWithOutliers) {
+  auto start = makeParameters();
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+  TestOutlierFinder tof{5_mm};
+  kfOptions.extensions.outlierFinder
+      .connect<&TestOutlierFinder::operator()<VectorMultiTrajectory>>(&tof);
+
+  auto measurements = createMeasurements(tester.simPropagator, tester.geoCtx,
+                                         tester.magCtx, start,
+                                         tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+  auto outlierSourceLinks =
+      tester.prepareSourceLinks(measurements.outlierSourceLinks);
+
+  // tracks with an outlier at different positions
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  std::vector<VectorMultiTrajectory::IndexType> trackIndices;
+  for (size_t i = 1; i < sourceLinks.size(); ++i) {
+    auto withOutlier = sourceLinks;
+    withOutlier[i] = outlierSourceLinks[i];
+    auto res = kfZero.fit(withOutlier.begin(), withOutlier.end(), start,
+                          kfOptions, tracks);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE_EQUAL(res->nOutliers(), 1u);
+    trackIndices.push_back(res->index());
+  }
+
+  // the scalar fit of the same measurements
+  auto& trajectory = tracks.trackStateContainer();
+  VectorMultiTrajectory expected = trajectory;
+  std::vector<double> chi2;
+  for (auto index : trackIndices) {
+    chi2.push_back(tracks.getTrack(index).chi2());
+  }
+
+  BatchedKalmanRefitter refitter{{}};
+  auto errors = refitter.refit(tester.geoCtx, tracks, trackIndices);
+  for (const auto& error : errors) {
+    BOOST_CHECK(not error);
+  }
+
+  for (unsigned int i = 0; i < trajectory.size(); ++i) {
+    auto ts = trajectory.getTrackState(i);
+    auto ets = expected.getTrackState(i);
+    BOOST_CHECK_EQUAL(ts.typeFlags().test(TrackStateFlag::OutlierFlag),
+                      ets.typeFlags().test(TrackStateFlag::OutlierFlag));
+    CHECK_CLOSE_OR_SMALL(ts.predicted(), ets.predicted(), 1e-6, 1e-9);
+    CHECK_CLOSE_OR_SMALL(ts.filtered(), ets.filtered(), 1e-6, 1e-9);
+    CHECK_CLOSE_OR_SMALL(ts.smoothed(), ets.smoothed(), 1e-6, 1e-9);
+    CHECK_CLOSE_COVARIANCE(ts.smoothedCovariance(), ets.smoothedCovariance(),
+                           1e-6);
+    if (ts.typeFlags().test(TrackStateFlag::MeasurementFlag)) {
+      CHECK_CLOSE_REL(ts.chi2(), ets.chi2(), 1e-6);
+    }
+    if (ts.typeFlags().test(TrackStateFlag::OutlierFlag)) {
+      // the KalmanFitter does not set the chi2 of outliers, the refit uses
+      // the prediction
+      BOOST_CHECK_EQUAL(ets.chi2(), 0.);
+      const auto H = ts.effectiveProjector();
+      const auto residual =
+          (ts.effectiveCalibrated() - H * ts.predicted()).eval();
+      const auto covariance = (ts.effectiveCalibratedCovariance() +
+                               H * ts.predictedCovariance() * H.transpose())
+                                  .eval();
+      CHECK_CLOSE_REL(
+          ts.chi2(),
+          (residual.transpose() * covariance.inverse() * residual).value(),
+          1e-9);
+      BOOST_CHECK_GT(ts.chi2(), 0.);
+    }
+  }
+
+  // outliers do not enter the track chi2
+  for (size_t t = 0; t < trackIndices.size(); ++t) {
+    auto track = tracks.getTrack(trackIndices[t]);
+    BOOST_CHECK_EQUAL(track.nOutliers(), 1u);
+    CHECK_CLOSE_REL(track.chi2(), chi2[t], 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Tests/CommonHelpers/DataDirectory.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFinding/SeedingAlgorithm.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace ActsExamples;
+using namespace Acts::UnitLiterals;
+
+/// Writes the space points of a seeding fixture to the white board, see
+/// Tests/Data/README.md for the format
+class InputWriter final : public IAlgorithm {
+ public:
+  InputWriter() : IAlgorithm("InputWriter", Acts::Logging::WARNING) {
+    m_spacePoints.initialize("spacepoints");
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    std::ifstream file(Acts::Test::getDataPath(
+                           "seeding_synthetic_barrel_1320_spacepoints.bin"),
+                       std::ios::binary);
+    char magic[4] = {};
+    std::uint32_t nSpacePoints = 0;
+    float varianceR = 0;
+    float varianceZ = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&nSpacePoints), sizeof(nSpacePoints));
+    file.read(reinterpret_cast<char*>(&varianceR), sizeof(varianceR));
+    file.read(reinterpret_cast<char*>(&varianceZ), sizeof(varianceZ));
+
+    SimSpacePointContainer spacePoints;
+    for (std::uint32_t i = 0; i < nSpacePoints; ++i) {
+      float xyz[3] = {};
+      file.read(reinterpret_cast<char*>(xyz), sizeof(xyz));
+      spacePoints.emplace_back(Acts::Vector3(xyz[0], xyz[1], xyz[2]),
+                               varianceR, varianceZ,
+                               boost::container::static_vector<Acts::SourceLink,
+                                                               2>{});
+    }
+    if (not file) {
+      return ProcessCode::ABORT;
+    }
+
+    m_spacePoints(ctx, std::move(spacePoints));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  WriteDataHandle<SimSpacePointContainer> m_spacePoints{this, "SpacePoints"};
+};
+
+/// Reads the seeds from the white board
+class OutputReader final : public IAlgorithm {
+ public:
+  explicit OutputReader(const std::string& key)
+      : IAlgorithm("OutputReader", Acts::Logging::WARNING) {
+    m_seeds.initialize(key);
+  }
+
+  ProcessCode execute(const AlgorithmContext& /*ctx*/) const override {
+    return ProcessCode::SUCCESS;
+  }
+
+  const SimSeedContainer& seeds(const WhiteBoard& wb) const {
+    return m_seeds(wb);
+  }
+
+ private:
+  ReadDataHandle<SimSeedContainer> m_seeds{this, "Seeds"};
+};
+
+/// Pixel barrel configuration matching the fixture
+SeedingAlgorithm::Config makeConfig() {
+  SeedingAlgorithm::Config cfg;
+  cfg.inputSpacePoints = {"spacepoints"};
+
+  auto& finder = cfg.seedFinderConfig;
+  finder.rMax = 160_mm;
+  finder.deltaRMin = 5_mm;
+  finder.deltaRMax = 160_mm;
+  finder.collisionRegionMin = -250_mm;
+  finder.collisionRegionMax = 250_mm;
+  finder.zMin = -2800_mm;
+  finder.zMax = 2800_mm;
+  finder.maxSeedsPerSpM = 5;
+  finder.cotThetaMax = 7.40627;
+  finder.sigmaScattering = 1;
+  finder.minPt = 500_MeV;
+  finder.impactMax = 10_mm;
+
+  cfg.seedFilterConfig.deltaRMin = finder.deltaRMin;
+  cfg.seedFilterConfig.maxSeedsPerSpM = finder.maxSeedsPerSpM;
+
+  cfg.gridConfig.rMax = finder.rMax;
+  cfg.gridConfig.deltaRMax = finder.deltaRMax;
+  cfg.gridConfig.zMin = finder.zMin;
+  cfg.gridConfig.zMax = finder.zMax;
+  cfg.gridConfig.cotThetaMax = finder.cotThetaMax;
+  cfg.gridConfig.minPt = finder.minPt;
+
+  cfg.seedFinderOptions.beamPos = {-0.5_mm, -0.5_mm};
+  cfg.seedFinderOptions.bFieldInZ = 2_T;
+  cfg.gridOptions.bFieldInZ = cfg.seedFinderOptions.bFieldInZ;
+
+  cfg.numPhiNeighbors = 1;
+  return cfg;
+}
+
+/// Run the seeding with the given configuration and output key
+void findSeeds(SeedingAlgorithm::Config cfg, const std::string& key,
+               WhiteBoard& wb) {
+  cfg.outputSeeds = key;
+  SeedingAlgorithm seeding(cfg, Acts::Logging::ERROR);
+  AlgorithmContext ctx(0, 0, wb);
+  BOOST_REQUIRE(seeding.execute(ctx) == ProcessCode::SUCCESS);
+}
+
+void checkSameSeeds(const SimSeedContainer& expected,
+                    const SimSeedContainer& seeds) {
+  BOOST_REQUIRE_EQUAL(seeds.size(), expected.size());
+  for (std::size_t i = 0; i < seeds.size(); ++i) {
+    BOOST_CHECK(seeds[i].sp() == expected[i].sp());
+    BOOST_CHECK_EQUAL(seeds[i].z(), expected[i].z());
+    BOOST_CHECK_EQUAL(seeds[i].seedQuality(), expected[i].seedQuality());
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesSeedingAlgorithm)
+
+BOOST_AUTO_TEST_CASE(ParallelSeedingMatchesSerialSeeding) {
+  WhiteBoard wb;
+  AlgorithmContext ctx(0, 0, wb);
+  BOOST_REQUIRE(InputWriter().execute(ctx) == ProcessCode::SUCCESS);
+
+  for (bool seedConfirmation : {false, true}) {
+    for (bool useSpacePointGridSoA : {false, true}) {
+      BOOST_TEST_CONTEXT("seedConfirmation " << seedConfirmation
+                                             << " useSpacePointGridSoA "
+                                             << useSpacePointGridSoA) {
+        auto cfg = makeConfig();
+        cfg.seedFinderConfig.seedConfirmation = seedConfirmation;
+        cfg.seedFilterConfig.seedConfirmation = seedConfirmation;
+        cfg.useSpacePointGridSoA = useSpacePointGridSoA;
+        const std::string prefix = "seeds_" +
+                                   std::to_string(seedConfirmation) + "_" +
+                                   std::to_string(useSpacePointGridSoA) + "_";
+
+        findSeeds(cfg, prefix + "1", wb);
+        const auto& serial = OutputReader(prefix + "1").seeds(wb);
+        BOOST_CHECK_GT(serial.size(), 0u);
+
+        for (std::size_t numTasks : {2u, 3u, 7u, 1000u}) {
+          BOOST_TEST_CONTEXT("numSeedingTasks " << numTasks) {
+            cfg.numSeedingTasks = numTasks;
+            const std::string key = prefix + std::to_string(numTasks);
+            findSeeds(cfg, key, wb);
+            checkSameSeeds(serial, OutputReader(key).seeds(wb));
+          }
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
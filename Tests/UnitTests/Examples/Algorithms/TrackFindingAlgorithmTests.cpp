@@ -0,0 +1,227 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFinding/TrackFindingAlgorithm.hpp"
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+using namespace ActsExamples;
+
+constexpr std::size_t nHits = 40;
+
+/// Creates a common trunk of track states per seed, which is shared by one
+/// to three branches, without any propagation. The output only depends on
+/// how the containers of the tasks are merged. Every fifth seed fails after
+/// its track states have been created.
+class FakeFinder final : public TrackFindingAlgorithm::TrackFinderFunction {
+ public:
+  TrackFindingAlgorithm::TrackFinderResult operator()(
+      const TrackParameters& initialParameters,
+      const TrackFindingAlgorithm::TrackFinderOptions& /*options*/,
+      TrackContainer& tracks) const override {
+    const auto iseed =
+        static_cast<std::size_t>(initialParameters.parameters()[0]);
+    auto& trajectory = tracks.trackStateContainer();
+
+    auto addState = [&](std::size_t hit,
+                        Acts::MultiTrajectoryTraits::IndexType previous) {
+      auto ts = trajectory.getTrackState(
+          trajectory.addTrackState(Acts::TrackStatePropMask::Predicted |
+                                       Acts::TrackStatePropMask::Filtered,
+                                   previous));
+      ts.predicted() = initialParameters.parameters() * (hit + 1.);
+      ts.predictedCovariance() = Acts::BoundSymMatrix::Identity() * hit;
+      ts.filtered() = ts.predicted() * 0.5;
+      ts.filteredCovariance() = ts.predictedCovariance() * 0.5;
+      auto geoId =
+          Acts::GeometryIdentifier().setVolume(1).setSensitive(hit + 1);
+      ts.setUncalibratedSourceLink(
+          Acts::SourceLink{IndexSourceLink(geoId, hit)});
+      ts.typeFlags().set(Acts::TrackStateFlag::MeasurementFlag);
+      ts.chi2() = hit;
+      return ts.index();
+    };
+
+    auto tip = Acts::MultiTrajectoryTraits::kInvalid;
+    for (std::size_t i = 0; i < iseed % 4; ++i) {
+      tip = addState((iseed + 3 * i) % nHits, tip);
+    }
+
+    if (iseed % 5 == 4) {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+
+    std::vector<TrackContainer::TrackProxy> found;
+    for (std::size_t branch = 0; branch < iseed % 3 + 1; ++branch) {
+      auto track = tracks.getTrack(tracks.addTrack());
+      track.tipIndex() = addState((iseed + 11 * branch) % nHits, tip);
+      track.parameters() = initialParameters.parameters() * (branch + 1.);
+      track.covariance() = Acts::BoundSymMatrix::Identity();
+      track.setReferenceSurface(initialParameters.referenceSurface()
+                                    .getSharedPtr());
+      track.nMeasurements() = iseed % 4 + 1;
+      found.push_back(track);
+    }
+    return found;
+  }
+};
+
+/// Provides the inputs of the finding algorithm
+class InputWriter final : public IAlgorithm {
+ public:
+  InputWriter() : IAlgorithm("InputWriter", Acts::Logging::WARNING) {
+    m_measurements.initialize("measurements");
+    m_sourceLinks.initialize("sourcelinks");
+    m_parameters.initialize("parameters");
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    IndexSourceLinkContainer sourceLinks;
+    for (Index hit = 0; hit < nHits; ++hit) {
+      auto geoId =
+          Acts::GeometryIdentifier().setVolume(1).setSensitive(hit + 1);
+      sourceLinks.insert(sourceLinks.end(), IndexSourceLink(geoId, hit));
+    }
+
+    auto surface =
+        Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero());
+    TrackParametersContainer parameters;
+    for (std::size_t iseed = 0; iseed < 30; ++iseed) {
+      Acts::BoundVector params = Acts::BoundVector::Zero();
+      params[Acts::eBoundLoc0] = iseed;
+      params[Acts::eBoundTheta] = 1.;
+      params[Acts::eBoundQOverP] = 1.;
+      parameters.emplace_back(surface, params);
+    }
+
+    m_measurements(ctx, MeasurementContainer{});
+    m_sourceLinks(ctx, std::move(sourceLinks));
+    m_parameters(ctx, std::move(parameters));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  WriteDataHandle<MeasurementContainer> m_measurements{this, "Measurements"};
+  WriteDataHandle<IndexSourceLinkContainer> m_sourceLinks{this, "SourceLinks"};
+  WriteDataHandle<TrackParametersContainer> m_parameters{this, "Parameters"};
+};
+
+/// Reads the found tracks from the white board
+class OutputReader final : public IAlgorithm {
+ public:
+  OutputReader() : IAlgorithm("OutputReader", Acts::Logging::WARNING) {
+    m_tracks.initialize("tracks");
+  }
+
+  ProcessCode execute(const AlgorithmContext& /*ctx*/) const override {
+    return ProcessCode::SUCCESS;
+  }
+
+  const ConstTrackContainer& tracks(const WhiteBoard& wb) const {
+    return m_tracks(wb);
+  }
+
+ private:
+  ReadDataHandle<ConstTrackContainer> m_tracks{this, "Tracks"};
+};
+
+/// Run the finding algorithm on a fresh white board
+void findTracks(std::size_t numFindingTasks, WhiteBoard& wb) {
+  TrackFindingAlgorithm::Config cfg;
+  cfg.inputMeasurements = "measurements";
+  cfg.inputSourceLinks = "sourcelinks";
+  cfg.inputInitialTrackParameters = "parameters";
+  cfg.outputTracks = "tracks";
+  cfg.findTracks = std::make_shared<FakeFinder>();
+  cfg.computeSharedHits = true;
+  cfg.numFindingTasks = numFindingTasks;
+  TrackFindingAlgorithm finding(cfg, Acts::Logging::FATAL);
+
+  AlgorithmContext ctx(0, 0, wb);
+  BOOST_REQUIRE(InputWriter().execute(ctx) == ProcessCode::SUCCESS);
+  BOOST_REQUIRE(finding.execute(ctx) == ProcessCode::SUCCESS);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesTrackFindingAlgorithm)
+
+BOOST_AUTO_TEST_CASE(ParallelFindingMatchesSerialFinding) {
+  OutputReader reader;
+  WhiteBoard serialBoard;
+  findTracks(1, serialBoard);
+  const auto& serial = reader.tracks(serialBoard);
+  BOOST_CHECK_GT(serial.size(), 0u);
+
+  Acts::ConstTrackAccessor<unsigned int> seedNumber("trackGroup");
+
+  for (std::size_t numTasks : {2u, 3u, 7u, 30u}) {
+    BOOST_TEST_CONTEXT("numFindingTasks " << numTasks) {
+      WhiteBoard parallelBoard;
+      findTracks(numTasks, parallelBoard);
+      const auto& parallel = reader.tracks(parallelBoard);
+
+      BOOST_REQUIRE_EQUAL(parallel.size(), serial.size());
+      const auto& serialStates = serial.trackStateContainer();
+      const auto& parallelStates = parallel.trackStateContainer();
+      BOOST_REQUIRE_EQUAL(parallelStates.size(), serialStates.size());
+
+      for (std::size_t i = 0; i < serial.size(); ++i) {
+        auto serialTrack = serial.getTrack(i);
+        auto parallelTrack = parallel.getTrack(i);
+        BOOST_CHECK_EQUAL(parallelTrack.tipIndex(), serialTrack.tipIndex());
+        BOOST_CHECK_EQUAL(parallelTrack.parameters(), serialTrack.parameters());
+        BOOST_CHECK_EQUAL(parallelTrack.nMeasurements(),
+                          serialTrack.nMeasurements());
+        BOOST_CHECK_EQUAL(seedNumber(parallelTrack), seedNumber(serialTrack));
+      }
+
+      for (std::size_t i = 0; i < serialStates.size(); ++i) {
+        auto serialState = serialStates.getTrackState(i);
+        auto parallelState = parallelStates.getTrackState(i);
+        BOOST_CHECK_EQUAL(parallelState.previous(), serialState.previous());
+        BOOST_CHECK_EQUAL(parallelState.predicted(), serialState.predicted());
+        BOOST_CHECK_EQUAL(parallelState.filteredCovariance(),
+                          serialState.filteredCovariance());
+        BOOST_CHECK_EQUAL(parallelState.chi2(), serialState.chi2());
+        BOOST_CHECK_EQUAL(
+            parallelState.typeFlags().test(Acts::TrackStateFlag::SharedHitFlag),
+            serialState.typeFlags().test(Acts::TrackStateFlag::SharedHitFlag));
+        BOOST_CHECK_EQUAL(parallelState.getUncalibratedSourceLink()
+                              .template get<IndexSourceLink>()
+                              .index(),
+                          serialState.getUncalibratedSourceLink()
+                              .template get<IndexSourceLink>()
+                              .index());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,240 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/MeasurementCalibration.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
+#include "ActsExamples/TrackFitting/TrackFittingAlgorithm.hpp"
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+using namespace ActsExamples;
+
+/// Creates one track state per source link without any propagation, so that
+/// the output only depends on how the containers of the fits are merged.
+/// Proto tracks with an odd number of hits fail after their track states
+/// have been created.
+class FakeFitter final : public TrackFitterFunction {
+ public:
+  TrackFitterResult operator()(
+      const std::vector<Acts::SourceLink>& sourceLinks,
+      const TrackParameters& initialParameters,
+      const GeneralFitterOptions& options,
+      const MeasurementCalibratorAdapter& /*calibrator*/,
+      TrackContainer& tracks) const override {
+    auto& trajectory = tracks.trackStateContainer();
+    auto tip = Acts::MultiTrajectoryTraits::kInvalid;
+    for (const auto& sourceLink : sourceLinks) {
+      auto ts = trajectory.getTrackState(
+          trajectory.addTrackState(Acts::TrackStatePropMask::Predicted, tip));
+      const auto hit = sourceLink.template get<IndexSourceLink>().index();
+      ts.predicted() = initialParameters.parameters() * (hit + 1.);
+      ts.predictedCovariance() = Acts::BoundSymMatrix::Identity() * hit;
+      ts.setUncalibratedSourceLink(sourceLink);
+      ts.chi2() = hit;
+      tip = ts.index();
+    }
+
+    if (sourceLinks.size() % 2 == 1) {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+
+    auto track = tracks.getTrack(tracks.addTrack());
+    track.tipIndex() = tip;
+    track.parameters() = initialParameters.parameters();
+    track.covariance() = Acts::BoundSymMatrix::Identity();
+    track.setReferenceSurface(options.referenceSurface->getSharedPtr());
+    track.nMeasurements() = sourceLinks.size();
+    return track;
+  }
+
+  TrackFitterResult operator()(
+      const std::vector<Acts::SourceLink>& /*sourceLinks*/,
+      const TrackParameters& /*initialParameters*/,
+      const GeneralFitterOptions& /*options*/,
+      const RefittingCalibrator& /*calibrator*/,
+      const std::vector<const Acts::Surface*>& /*surfaceSequence*/,
+      TrackContainer& /*tracks*/) const override {
+    return std::make_error_code(std::errc::not_supported);
+  }
+};
+
+/// Provides the inputs of the fitting algorithm
+class InputWriter final : public IAlgorithm {
+ public:
+  InputWriter() : IAlgorithm("InputWriter", Acts::Logging::WARNING) {
+    m_measurements.initialize("measurements");
+    m_sourceLinks.initialize("sourcelinks");
+    m_protoTracks.initialize("prototracks");
+    m_parameters.initialize("parameters");
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    const std::size_t nHits = 60;
+    IndexSourceLinkContainer sourceLinks;
+    for (Index hit = 0; hit < nHits; ++hit) {
+      auto geoId =
+          Acts::GeometryIdentifier().setVolume(1).setSensitive(hit + 1);
+      sourceLinks.insert(sourceLinks.end(), IndexSourceLink(geoId, hit));
+    }
+
+    auto surface =
+        Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero());
+    ProtoTrackContainer protoTracks;
+    TrackParametersContainer parameters;
+    for (std::size_t itrack = 0; itrack < 25; ++itrack) {
+      // track lengths of 0 to 4 hits, including empty and failing tracks
+      ProtoTrack protoTrack;
+      for (std::size_t i = 0; i < itrack % 5; ++i) {
+        protoTrack.push_back((itrack + 7 * i) % nHits);
+      }
+      protoTracks.push_back(std::move(protoTrack));
+      Acts::BoundVector params = Acts::BoundVector::Zero();
+      params[Acts::eBoundLoc0] = itrack;
+      params[Acts::eBoundTheta] = 1.;
+      params[Acts::eBoundQOverP] = 1.;
+      parameters.emplace_back(surface, params);
+    }
+
+    m_measurements(ctx, MeasurementContainer{});
+    m_sourceLinks(ctx, std::move(sourceLinks));
+    m_protoTracks(ctx, std::move(protoTracks));
+    m_parameters(ctx, std::move(parameters));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  WriteDataHandle<MeasurementContainer> m_measurements{this, "Measurements"};
+  WriteDataHandle<IndexSourceLinkContainer> m_sourceLinks{this, "SourceLinks"};
+  WriteDataHandle<ProtoTrackContainer> m_protoTracks{this, "ProtoTracks"};
+  WriteDataHandle<TrackParametersContainer> m_parameters{this, "Parameters"};
+};
+
+/// Reads the fitted tracks from the white board
+class OutputReader final : public IAlgorithm {
+ public:
+  OutputReader() : IAlgorithm("OutputReader", Acts::Logging::WARNING) {
+    m_tracks.initialize("tracks");
+  }
+
+  ProcessCode execute(const AlgorithmContext& /*ctx*/) const override {
+    return ProcessCode::SUCCESS;
+  }
+
+  const ConstTrackContainer& tracks(const WhiteBoard& wb) const {
+    return m_tracks(wb);
+  }
+
+ private:
+  ReadDataHandle<ConstTrackContainer> m_tracks{this, "Tracks"};
+};
+
+/// Run the fitting algorithm on a fresh white board
+void fitTracks(std::size_t numFittingTasks, WhiteBoard& wb) {
+  TrackFittingAlgorithm::Config cfg;
+  cfg.inputMeasurements = "measurements";
+  cfg.inputSourceLinks = "sourcelinks";
+  cfg.inputProtoTracks = "prototracks";
+  cfg.inputInitialTrackParameters = "parameters";
+  cfg.outputTracks = "tracks";
+  cfg.fit = std::make_shared<FakeFitter>();
+  cfg.calibrator = std::make_shared<PassThroughCalibrator>();
+  cfg.numFittingTasks = numFittingTasks;
+  TrackFittingAlgorithm fitting(cfg, Acts::Logging::FATAL);
+
+  AlgorithmContext ctx(0, 0, wb);
+  BOOST_REQUIRE(InputWriter().execute(ctx) == ProcessCode::SUCCESS);
+  BOOST_REQUIRE(fitting.execute(ctx) == ProcessCode::SUCCESS);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesTrackFittingAlgorithm)
+
+BOOST_AUTO_TEST_CASE(ParallelFitMatchesSerialFit) {
+  OutputReader reader;
+  WhiteBoard serialBoard;
+  fitTracks(1, serialBoard);
+  const auto& serial = reader.tracks(serialBoard);
+
+  // 2 and 4 hit proto tracks are fitted, 1 and 3 hit proto tracks fail
+  BOOST_CHECK_EQUAL(serial.size(), 10u);
+  // the track states of failed fits stay in the container
+  BOOST_CHECK_EQUAL(serial.trackStateContainer().size(), 50u);
+
+  for (std::size_t numTasks : {2u, 3u, 7u, 25u}) {
+    BOOST_TEST_CONTEXT("numFittingTasks " << numTasks) {
+      WhiteBoard parallelBoard;
+      fitTracks(numTasks, parallelBoard);
+      const auto& parallel = reader.tracks(parallelBoard);
+
+      BOOST_REQUIRE_EQUAL(parallel.size(), serial.size());
+      const auto& serialStates = serial.trackStateContainer();
+      const auto& parallelStates = parallel.trackStateContainer();
+      BOOST_REQUIRE_EQUAL(parallelStates.size(), serialStates.size());
+
+      for (std::size_t i = 0; i < serial.size(); ++i) {
+        auto serialTrack = serial.getTrack(i);
+        auto parallelTrack = parallel.getTrack(i);
+        BOOST_CHECK_EQUAL(parallelTrack.tipIndex(), serialTrack.tipIndex());
+        BOOST_CHECK_EQUAL(parallelTrack.parameters(), serialTrack.parameters());
+        BOOST_CHECK_EQUAL(parallelTrack.covariance(), serialTrack.covariance());
+        // every run creates its own target surface
+        BOOST_CHECK_EQUAL(parallelTrack.referenceSurface().type(),
+                          serialTrack.referenceSurface().type());
+        BOOST_CHECK_EQUAL(
+            parallelTrack.referenceSurface().center(Acts::GeometryContext()),
+            serialTrack.referenceSurface().center(Acts::GeometryContext()));
+        BOOST_CHECK_EQUAL(parallelTrack.nMeasurements(),
+                          serialTrack.nMeasurements());
+        BOOST_CHECK_EQUAL(parallelTrack.nTrackStates(),
+                          serialTrack.nTrackStates());
+      }
+
+      for (std::size_t i = 0; i < serialStates.size(); ++i) {
+        auto serialState = serialStates.getTrackState(i);
+        auto parallelState = parallelStates.getTrackState(i);
+        BOOST_CHECK_EQUAL(parallelState.previous(), serialState.previous());
+        BOOST_CHECK_EQUAL(parallelState.predicted(), serialState.predicted());
+        BOOST_CHECK_EQUAL(parallelState.predictedCovariance(),
+                          serialState.predictedCovariance());
+        BOOST_CHECK_EQUAL(parallelState.chi2(), serialState.chi2());
+        BOOST_CHECK_EQUAL(parallelState.getUncalibratedSourceLink()
+                              .template get<IndexSourceLink>()
+                              .index(),
+                          serialState.getUncalibratedSourceLink()
+                              .template get<IndexSourceLink>()
+                              .index());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+std::shared_ptr<Acts::PlaneSurface> makeSurface(Acts::GeometryIdentifier id) {
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Transform3::Identity(),
+      std::make_shared<Acts::RectangleBounds>(1., 1.));
+  surface->assignGeometryId(id);
+  return surface;
+}
+
+// compare the dense lookup with the binary search for the given ids
+void checkLookup(const IndexSourceLinkContainer& sourceLinks,
+                 const std::vector<Acts::GeometryIdentifier>& ids) {
+  IndexSourceLinkAccessor reference;
+  reference.container = &sourceLinks;
+  DenseIndexSourceLinkAccessor dense(sourceLinks);
+
+  for (const auto& id : ids) {
+    auto surface = makeSurface(id);
+    auto [refBegin, refEnd] = reference.range(*surface);
+    auto [begin, end] = dense.range(*surface);
+    // empty ranges may point to different positions
+    BOOST_CHECK_EQUAL(end - begin, refEnd - refBegin);
+    if (refBegin != refEnd) {
+      BOOST_CHECK(refBegin == begin);
+      BOOST_CHECK(refEnd == end);
+    }
+    BOOST_CHECK_EQUAL(dense.count(*surface), sourceLinks.count(id));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesIndexSourceLink)
+
+BOOST_AUTO_TEST_CASE(DenseLookupEmpty) {
+  IndexSourceLinkContainer sourceLinks;
+  auto id =
+      Acts::GeometryIdentifier().setVolume(1).setLayer(2).setSensitive(3);
+  checkLookup(sourceLinks, {Acts::GeometryIdentifier(), id});
+}
+
+BOOST_AUTO_TEST_CASE(DenseLookupDense) {
+  // every sensitive surface of a few layers has source links
+  IndexSourceLinkContainer sourceLinks;
+  std::vector<Acts::GeometryIdentifier> ids;
+  Index index = 0;
+  for (unsigned int vol = 1; vol <= 3; ++vol) {
+    for (unsigned int lay = 2; lay <= 6; lay += 2) {
+      for (unsigned int sen = 1; sen <= 20; ++sen) {
+        auto id = Acts::GeometryIdentifier()
+                      .setVolume(vol)
+                      .setLayer(lay)
+                      .setSensitive(sen);
+        ids.push_back(id);
+        for (unsigned int i = 0; i < sen % 3 + 1; ++i) {
+          sourceLinks.insert(IndexSourceLink(id, index++));
+        }
+      }
+    }
+  }
+  checkLookup(sourceLinks, ids);
+}
+
+BOOST_AUTO_TEST_CASE(DenseLookupSparseAndMissing) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<unsigned int> volume(1, 20);
+  std::uniform_int_distribution<unsigned int> layer(1, 30);
+  std::uniform_int_distribution<unsigned int> sensitive(1, 2000);
+  std::uniform_int_distribution<unsigned int> flag(0, 9);
+
+  auto randomId = [&]() {
+    auto id = Acts::GeometryIdentifier()
+                  .setVolume(volume(rng))
+                  .setLayer(layer(rng))
+                  .setSensitive(sensitive(rng));
+    // a few non-sensitive surfaces that use the binary search
+    switch (flag(rng)) {
+      case 0:
+        id.setBoundary(1 + flag(rng));
+        break;
+      case 1:
+        id.setApproach(1 + flag(rng));
+        break;
+      case 2:
+        id.setExtra(1 + flag(rng));
+        break;
+      default:
+        break;
+    }
+    return id;
+  };
+
+  IndexSourceLinkContainer sourceLinks;
+  std::vector<Acts::GeometryIdentifier> ids;
+  for (Index i = 0; i < 5000; ++i) {
+    auto id = randomId();
+    sourceLinks.insert(IndexSourceLink(id, i));
+    ids.push_back(id);
+  }
+  // surfaces that most likely have no source links
+  for (int i = 0; i < 5000; ++i) {
+    ids.push_back(randomId());
+  }
+  // identifiers beyond the range covered by the tables
+  ids.push_back(Acts::GeometryIdentifier().setVolume(200).setLayer(1));
+  ids.push_back(Acts::GeometryIdentifier().setVolume(1).setLayer(200));
+  ids.push_back(
+      Acts::GeometryIdentifier().setVolume(1).setLayer(1).setSensitive(9000));
+  ids.push_back(Acts::GeometryIdentifier().setVolume(0));
+
+  checkLookup(sourceLinks, ids);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,80 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/ObjectPool.hpp"
+
+#include <string>
+#include <vector>
+
+using ActsExamples::ObjectPool;
+
+BOOST_AUTO_TEST_SUITE(ExamplesObjectPool)
+
+BOOST_AUTO_TEST_CASE(AcquireRelease) {
+  ObjectPool pool;
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 0u);
+
+  auto a = pool.acquire<std::vector<int>>();
+  BOOST_CHECK(a.empty());
+  a.resize(1000, 1);
+  const auto capacity = a.capacity();
+  pool.release(std::move(a));
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 1u);
+  pool.finishEvent();
+
+  // recycled objects are empty but keep their capacity
+  auto b = pool.acquire<std::vector<int>>();
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 0u);
+  BOOST_CHECK(b.empty());
+  BOOST_CHECK_EQUAL(b.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(OnlyAcquiredObjects) {
+  ObjectPool pool;
+
+  // types that were never acquired are not retained
+  pool.release(std::string("abc"));
+  BOOST_CHECK_EQUAL(pool.available<std::string>(), 0u);
+
+  // at most as many objects as were acquired during the event
+  auto a = pool.acquire<std::vector<int>>();
+  pool.release(std::move(a));
+  pool.release(std::vector<int>(10));
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 1u);
+
+  // acquired objects that were not released are forgotten after the event
+  auto b = pool.acquire<std::vector<int>>();
+  auto c = pool.acquire<std::vector<int>>();
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 0u);
+  pool.release(std::move(b));
+  pool.finishEvent();
+  pool.release(std::move(c));
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 1u);
+
+  // objects without clear() are never retained
+  BOOST_CHECK_EQUAL(pool.acquire<int>(), 0);
+  pool.release(42);
+  BOOST_CHECK_EQUAL(pool.available<int>(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(MaxAvailable) {
+  ObjectPool pool(2);
+
+  std::vector<std::vector<int>> objects;
+  for (int i = 0; i < 4; ++i) {
+    objects.push_back(pool.acquire<std::vector<int>>());
+  }
+  for (auto& object : objects) {
+    pool.release(std::move(object));
+  }
+  BOOST_CHECK_EQUAL(pool.available<std::vector<int>>(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,300 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+namespace Test {
+
+/// Access to the element dependencies derived by the sequencer
+struct SequencerFixture {
+  static const std::vector<std::size_t>& dependencies(const Sequencer& seq,
+                                                      std::size_t element) {
+    return seq.m_elementDependencies.at(element);
+  }
+};
+
+namespace {
+
+/// Records the order in which the algorithms of all events are executed
+struct ExecutionLog {
+  std::mutex mutex;
+  std::vector<std::pair<std::size_t, std::string>> entries;
+
+  /// Position of the algorithm in the log of the given event
+  std::size_t position(std::size_t event, const std::string& name) const {
+    std::size_t pos = 0;
+    for (const auto& [entryEvent, entryName] : entries) {
+      if (entryEvent != event) {
+        continue;
+      }
+      if (entryName == name) {
+        return pos;
+      }
+      ++pos;
+    }
+    return SIZE_MAX;
+  }
+};
+
+/// Sums up its inputs and writes the result to all its outputs
+class SumAlgorithm final : public IAlgorithm {
+ public:
+  SumAlgorithm(const std::string& name, const std::vector<std::string>& inputs,
+               const std::vector<std::string>& outputs, ExecutionLog& log)
+      : IAlgorithm(name, Acts::Logging::WARNING), m_log(log) {
+    for (const auto& key : inputs) {
+      m_inputs.push_back(std::make_unique<ReadDataHandle<int>>(this, key));
+      m_inputs.back()->initialize(key);
+    }
+    for (const auto& key : outputs) {
+      m_outputs.push_back(std::make_unique<WriteDataHandle<int>>(this, key));
+      m_outputs.back()->initialize(key);
+    }
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    int sum = 1;
+    for (const auto& input : m_inputs) {
+      sum += (*input)(ctx);
+    }
+    for (const auto& output : m_outputs) {
+      (*output)(ctx, int{sum});
+    }
+    std::lock_guard<std::mutex> lock(m_log.mutex);
+    m_log.entries.emplace_back(ctx.eventNumber, name());
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::unique_ptr<ReadDataHandle<int>>> m_inputs;
+  std::vector<std::unique_ptr<WriteDataHandle<int>>> m_outputs;
+  ExecutionLog& m_log;
+};
+
+/// Writes a container which depends on the event and on its inputs
+class FillAlgorithm final : public IAlgorithm {
+ public:
+  FillAlgorithm(const std::string& name,
+                const std::vector<std::string>& inputs,
+                const std::string& output)
+      : IAlgorithm(name, Acts::Logging::WARNING), m_output(this, output) {
+    for (const auto& key : inputs) {
+      m_inputs.push_back(
+          std::make_unique<ReadDataHandle<std::vector<int>>>(this, key));
+      m_inputs.back()->initialize(key);
+    }
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    auto values = ctx.acquire<std::vector<int>>();
+    values.push_back(static_cast<int>(ctx.eventNumber));
+    for (const auto& input : m_inputs) {
+      for (int value : (*input)(ctx)) {
+        values.push_back(2 * value + 1);
+      }
+    }
+    m_output(ctx, std::move(values));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::unique_ptr<ReadDataHandle<std::vector<int>>>> m_inputs;
+  WriteDataHandle<std::vector<int>> m_output;
+};
+
+/// Copies its input of every event
+class CollectAlgorithm final : public IAlgorithm {
+ public:
+  using Output = std::map<std::size_t, std::vector<int>>;
+
+  CollectAlgorithm(const std::string& input, Output& output)
+      : IAlgorithm("collect", Acts::Logging::WARNING),
+        m_input(this, input),
+        m_output(output) {
+    m_input.initialize(input);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_output[ctx.eventNumber] = m_input(ctx);
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  ReadDataHandle<std::vector<int>> m_input;
+  Output& m_output;
+  mutable std::mutex m_mutex;
+};
+
+/// Runs a chain with two independent branches and returns its output
+CollectAlgorithm::Output runChain(const Sequencer::Config& cfg) {
+  CollectAlgorithm::Output output;
+  Sequencer seq(cfg);
+  seq.addAlgorithm(std::make_shared<FillAlgorithm>(
+      "a", std::vector<std::string>{}, "A"));
+  seq.addAlgorithm(std::make_shared<FillAlgorithm>(
+      "b", std::vector<std::string>{"A"}, "B"));
+  seq.addAlgorithm(std::make_shared<FillAlgorithm>(
+      "c", std::vector<std::string>{"A"}, "C"));
+  seq.addAlgorithm(std::make_shared<FillAlgorithm>(
+      "d", std::vector<std::string>{"B", "C"}, "D"));
+  seq.addAlgorithm(std::make_shared<CollectAlgorithm>("D", output));
+  BOOST_REQUIRE_EQUAL(seq.run(), EXIT_SUCCESS);
+  return output;
+}
+
+/// Configuration without any of the concurrency and recycling options
+Sequencer::Config makeDefaultConfig() {
+  Sequencer::Config cfg;
+  cfg.events = 32;
+  cfg.numThreads = 4;
+  cfg.logLevel = Acts::Logging::WARNING;
+  return cfg;
+}
+
+Sequencer::Config makeConfig() {
+  Sequencer::Config cfg;
+  cfg.events = 8;
+  cfg.numThreads = 2;
+  cfg.logLevel = Acts::Logging::WARNING;
+  cfg.concurrentElements = true;
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesSequencer)
+
+BOOST_FIXTURE_TEST_CASE(DependencyOrdering, SequencerFixture) {
+  ExecutionLog log;
+  Sequencer seq(makeConfig());
+  // a -> b -> c and a -> d are independent branches joined in e
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "a", std::vector<std::string>{}, std::vector<std::string>{"A"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "b", std::vector<std::string>{"A"}, std::vector<std::string>{"B"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "c", std::vector<std::string>{"B"}, std::vector<std::string>{"C"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "d", std::vector<std::string>{"A"}, std::vector<std::string>{"D"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "e", std::vector<std::string>{"C", "D"}, std::vector<std::string>{},
+      log));
+
+  using Indices = std::vector<std::size_t>;
+  BOOST_CHECK(dependencies(seq, 0) == Indices{});
+  BOOST_CHECK(dependencies(seq, 1) == Indices{0});
+  BOOST_CHECK(dependencies(seq, 2) == Indices{1});
+  // the second branch does not wait for the first one
+  BOOST_CHECK(dependencies(seq, 3) == Indices{0});
+  BOOST_CHECK(dependencies(seq, 4) == (Indices{2, 3}));
+
+  BOOST_REQUIRE_EQUAL(seq.run(), EXIT_SUCCESS);
+  BOOST_REQUIRE_EQUAL(log.entries.size(), 8u * 5u);
+  for (std::size_t event = 0; event < 8; ++event) {
+    BOOST_CHECK_LT(log.position(event, "a"), log.position(event, "b"));
+    BOOST_CHECK_LT(log.position(event, "b"), log.position(event, "c"));
+    BOOST_CHECK_LT(log.position(event, "a"), log.position(event, "d"));
+    BOOST_CHECK_LT(log.position(event, "c"), log.position(event, "e"));
+    BOOST_CHECK_LT(log.position(event, "d"), log.position(event, "e"));
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(ElementsWithoutHandles, SequencerFixture) {
+  ExecutionLog log;
+  Sequencer seq(makeConfig());
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "a", std::vector<std::string>{}, std::vector<std::string>{"A"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "b", std::vector<std::string>{}, std::vector<std::string>{"B"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "barrier", std::vector<std::string>{}, std::vector<std::string>{}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "c", std::vector<std::string>{}, std::vector<std::string>{"C"}, log));
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "d", std::vector<std::string>{"A"}, std::vector<std::string>{}, log));
+
+  using Indices = std::vector<std::size_t>;
+  // an element without handles waits for all previous elements ...
+  BOOST_CHECK(dependencies(seq, 2) == (Indices{0, 1}));
+  // ... and all later elements wait for it
+  BOOST_CHECK(dependencies(seq, 3) == Indices{2});
+  BOOST_CHECK(dependencies(seq, 4) == (Indices{0, 2}));
+
+  BOOST_REQUIRE_EQUAL(seq.run(), EXIT_SUCCESS);
+  for (std::size_t event = 0; event < 8; ++event) {
+    BOOST_CHECK_LT(log.position(event, "a"), log.position(event, "barrier"));
+    BOOST_CHECK_LT(log.position(event, "b"), log.position(event, "barrier"));
+    BOOST_CHECK_LT(log.position(event, "barrier"), log.position(event, "c"));
+    BOOST_CHECK_LT(log.position(event, "barrier"), log.position(event, "d"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MissingProducer) {
+  ExecutionLog log;
+  auto cfg = makeConfig();
+  // the undeclared read is rejected even without the data flow checks
+  cfg.runDataFlowChecks = false;
+  Sequencer seq(cfg);
+  seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "a", std::vector<std::string>{}, std::vector<std::string>{"A"}, log));
+  BOOST_CHECK_THROW(seq.addAlgorithm(std::make_shared<SumAlgorithm>(
+                        "b", std::vector<std::string>{"X"},
+                        std::vector<std::string>{}, log)),
+                    SequenceConfigurationException);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentElementsSameOutput) {
+  const auto expected = runChain(makeDefaultConfig());
+  BOOST_REQUIRE_EQUAL(expected.size(), 32u);
+
+  auto cfg = makeDefaultConfig();
+  cfg.concurrentElements = true;
+  BOOST_CHECK(runChain(cfg) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(WhiteBoardSlotsSameOutput) {
+  const auto expected = runChain(makeDefaultConfig());
+
+  auto cfg = makeDefaultConfig();
+  cfg.useWhiteBoardSlots = true;
+  BOOST_CHECK(runChain(cfg) == expected);
+  cfg.concurrentElements = true;
+  BOOST_CHECK(runChain(cfg) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(RecycleContainersSameOutput) {
+  const auto expected = runChain(makeDefaultConfig());
+
+  auto cfg = makeDefaultConfig();
+  cfg.recycleContainers = true;
+  BOOST_CHECK(runChain(cfg) == expected);
+  cfg.concurrentElements = true;
+  cfg.useWhiteBoardSlots = true;
+  BOOST_CHECK(runChain(cfg) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace ActsExamples
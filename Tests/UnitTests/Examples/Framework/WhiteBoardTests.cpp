@@ -0,0 +1,125 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+namespace Test {
+
+/// Access to the white board internals which are otherwise only used
+/// through the data handles
+struct WhiteBoardFixture {
+  using Large = std::array<double, 512>;
+
+  static WhiteBoard makeWhiteBoard() {
+    return WhiteBoard(
+        Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO), {},
+        {{"hits", 0}, {"tracks", 1}, {"large", 2}});
+  }
+
+  template <typename T>
+  static void add(WhiteBoard& wb, const std::string& name, T&& object) {
+    wb.add(name, std::forward<T>(object));
+  }
+
+  template <typename T>
+  static const T& get(const WhiteBoard& wb, const std::string& name) {
+    return wb.get<T>(name);
+  }
+
+  template <typename T>
+  static void addToSlot(WhiteBoard& wb, std::size_t slot,
+                        const std::string& name, T&& object) {
+    wb.addToSlot(slot, name, std::forward<T>(object));
+  }
+
+  template <typename T>
+  static const T& getFromSlot(const WhiteBoard& wb, std::size_t slot,
+                              const std::string& name) {
+    return wb.getFromSlot<T>(slot, name);
+  }
+
+  static std::size_t numChunks(const WhiteBoard& wb) {
+    return wb.m_arena.numChunks();
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(ExamplesWhiteBoard)
+
+BOOST_FIXTURE_TEST_CASE(SlotAddGetExists, WhiteBoardFixture) {
+  WhiteBoard wb = makeWhiteBoard();
+  BOOST_CHECK_EQUAL(wb.numSlots(), 3u);
+  BOOST_CHECK(not wb.exists("hits"));
+
+  addToSlot(wb, 0, "hits", std::vector<int>{1, 2, 3});
+  BOOST_CHECK(wb.exists("hits"));
+  BOOST_CHECK(not wb.exists("tracks"));
+  BOOST_CHECK_EQUAL(getFromSlot<std::vector<int>>(wb, 0, "hits").size(), 3u);
+  // access by name resolves the slot
+  BOOST_CHECK_EQUAL(get<std::vector<int>>(wb, "hits").at(2), 3);
+
+  // adding by name ends up in the slot
+  add(wb, "tracks", 42);
+  BOOST_CHECK(wb.exists("tracks"));
+  BOOST_CHECK_EQUAL(getFromSlot<int>(wb, 1, "tracks"), 42);
+
+  // names without slot use the regular store
+  add(wb, "other", 1.5);
+  BOOST_CHECK(wb.exists("other"));
+  BOOST_CHECK_EQUAL(get<double>(wb, "other"), 1.5);
+
+  BOOST_CHECK_THROW(addToSlot(wb, 1, "tracks", 43), std::invalid_argument);
+  BOOST_CHECK_THROW(add(wb, "hits", std::vector<int>{}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(getFromSlot<int>(wb, 2, "large"), std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(SlotTypeMismatch, WhiteBoardFixture) {
+  WhiteBoard wb = makeWhiteBoard();
+  addToSlot(wb, 1, "tracks", 42);
+  BOOST_CHECK_THROW(getFromSlot<double>(wb, 1, "tracks"), std::out_of_range);
+  BOOST_CHECK_THROW(get<double>(wb, "tracks"), std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(ArenaReset, WhiteBoardFixture) {
+  WhiteBoard wb = makeWhiteBoard();
+  BOOST_CHECK_EQUAL(numChunks(wb), 0u);
+
+  auto fill = [&]() {
+    addToSlot(wb, 0, "hits", std::vector<int>(100, 1));
+    addToSlot(wb, 1, "tracks", 7);
+    addToSlot(wb, 2, "large", Large{});
+  };
+
+  fill();
+  const std::size_t nChunks = numChunks(wb);
+  BOOST_CHECK_GT(nChunks, 0u);
+
+  // clearing empties the slots but keeps the arena memory
+  for (int i = 0; i < 3; ++i) {
+    wb.clear();
+    BOOST_CHECK(not wb.exists("hits"));
+    BOOST_CHECK(not wb.exists("large"));
+    fill();
+    BOOST_CHECK_EQUAL(numChunks(wb), nChunks);
+    BOOST_CHECK_EQUAL(getFromSlot<int>(wb, 1, "tracks"), 7);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace ActsExamples